@@ -1,29 +1,31 @@
-#pragma once
-
-// Dependencies
-#include "runtime/Interpreter.hpp"
-
-namespace ns {
-	extern Interpreter interpreter;
-	extern std::string sourceCode;
-	extern std::string terminalInput; 
-	extern bool terminalOpen; 
-	extern bool insideConsole;
-	extern bool jumpToConsole;
-
-	void initNoodleScriptMsg(); 
-	void initTerminalMsg(); 
-	void initConsoleMsg(); 
-
-	void prepareTerminalMsg(); 
-	void prepareConsoleMsg(); 
-
-	void executeTerminal(const std::string& input); 
-	void executeConsole(const std::string& input); 
-
-	void initTerminal(int argc, const char** argv); 
-	bool isTerminalOpen(); 
-	void runSourceFile(const std::string& filepath); 
-	void updateTerminal(); 
-	void closeTerminal(); 
+#pragma once
+
+// Dependencies
+#include "runtime/Interpreter.hpp"
+
+namespace ns {
+	extern Interpreter interpreter;
+	extern std::string sourceCode;
+	extern std::string terminalInput; 
+	extern bool terminalOpen; 
+	extern bool insideConsole;
+	extern bool jumpToConsole;
+
+	void initNoodleScriptMsg(); 
+	void initTerminalMsg(); 
+	void initConsoleMsg(); 
+
+	void prepareTerminalMsg(); 
+	void prepareConsoleMsg(); 
+
+	void executeTerminal(const std::string& input); 
+	void executeConsole(const std::string& input); 
+
+	void initTerminal(int argc, const char** argv); 
+	bool isTerminalOpen(); 
+	std::string readSourceFile(const std::string& filepath); 
+	void runSourceFile(const std::string& filepath); 
+	void compileSourceFile(const std::string& filepath, const std::string& outputPath); 
+	void updateTerminal(); 
+	void closeTerminal(); 
 }
\ No newline at end of file
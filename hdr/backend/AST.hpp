@@ -1,134 +1,215 @@
-#pragma once
-
-// Dependencies
-#include "Lexer.hpp"
-
-namespace ns {
-	enum class NodeType {
-		// Statements
-		Program,
-		VarDeclaration,
-		FuncDeclaration,
-		IfStatement,
-		WhileStatement,
-
-		// Expressions
-		NullLiteral,
-		NumLiteral,
-		StringLiteral,
-		ListLiteral,
-		Identifier,
-		ListAccesser, 
-		UnaryExpr, 
-		BinaryExpr,
-		AssignmentExpr, 
-		FuncCall
-	};
-	enum class ValueType {
-		Null,
-		Number,
-		Bool,
-		String,
-		List, 
-		FuncValue
-	};
-
-	struct Statement {
-		NodeType nodeType; 
-
-		virtual ~Statement() {}
-	};
-	struct Expr : public Statement {};
-
-	struct Program : public Statement {
-		std::vector<Statement*> statements; 
-
-		Program(); 
-	};
-	struct VarDeclaration : public Statement {
-		bool constant; 
-		ValueType valueType; 
-		std::string identifier; 
-		Expr* expr; 
-
-		VarDeclaration(); 
-	};
-	struct FuncDeclaration : public Statement {
-		std::string name; 
-		bool nativeFunc; 
-		std::vector<std::string> parameters; 
-		std::vector<Statement*> statements; 
-
-		FuncDeclaration(); 
-	};
-	struct IfStatement : public Statement {
-		Expr* condition; 
-		std::vector<Statement*> ifStatements;
-		std::vector<Statement*> elseStatements; 
-
-		IfStatement(); 
-	};
-	struct WhileStatement : public Statement {
-		Expr* condition; 
-		std::vector<Statement*> statements; 
-
-		WhileStatement(); 
-	};
-
-	struct NullLiteral : public Expr {
-		NullLiteral(); 
-	};
-	struct NumLiteral : public Expr {
-		double value; 
-
-		NumLiteral(); 
-	};
-	struct StringLiteral : public Expr {
-		std::string value; 
-
-		StringLiteral();
-	};
-	struct ListLiteral : public Expr {
-		std::vector<Expr*> elements; 
-
-		ListLiteral(); 
-	};
-	struct Identifier : public Expr {
-		std::string name; 
-
-		Identifier(); 
-	};
-	struct ListAccesser : public Expr {
-		std::string name; 
-		int index; 
-
-		ListAccesser(); 
-	};
-	struct UnaryExpr : public Expr {
-		Expr* expr; 
-		std::string operation; 
-
-		UnaryExpr(); 
-	};
-	struct BinaryExpr : public Expr {
-		Expr* leftExpr;
-		Expr* rightExpr;
-		std::string operation;
-
-		BinaryExpr(); 
-	};
-	struct AssignmentExpr : public Expr {
-		Expr* assigne; 
-		Expr* value; 
-
-		AssignmentExpr(); 
-	};
-	struct FuncCall : public Expr {
-		std::string caller; 
-		std::vector<Expr*> arguments; 
-
-		FuncCall(); 
-	};
-
-	std::ostream& operator<<(std::ostream& ostream, const Statement* statement); 
+#pragma once
+
+// Dependencies
+#include "Lexer.hpp"
+
+namespace ns {
+	enum class NodeType {
+		// Statements
+		Program,
+		VarDeclaration,
+		FuncDeclaration,
+		DishDeclaration,
+		IfStatement,
+		WhileStatement,
+		ForStatement, 
+		BreakStatement, 
+		ContinueStatement, 
+		ReturnStatement, 
+
+		// Expressions
+		NullLiteral,
+		NumLiteral,
+		StringLiteral,
+		ListLiteral,
+		Identifier,
+		ListAccesser, 
+		FieldAccesser, 
+		UnaryExpr, 
+		BinaryExpr,
+		AssignmentExpr, 
+		FuncCall,
+		InlinedCall
+	};
+	enum class ValueType {
+		Null,
+		Number,
+		Bool,
+		String,
+		List, 
+		FuncValue,
+		Map,
+		Set,
+		Dish
+	};
+	enum class BinaryOperation {
+		Add, Subtract, Multiply, Divide, Modulo, Power,
+		Equal, NotEqual, Greater, Less, GreaterEqual, LessEqual, And, Or
+	};
+	struct DishShape; 
+
+	struct Statement {
+		NodeType nodeType; 
+
+		virtual ~Statement() {}
+	};
+	struct Expr : public Statement {};
+
+	struct Program : public Statement {
+		std::vector<Statement*> statements; 
+
+		Program(); 
+	};
+	struct VarDeclaration : public Statement {
+		bool constant; 
+		ValueType valueType; 
+		std::string identifier; 
+		Expr* expr; 
+
+		VarDeclaration(); 
+	};
+	struct FuncDeclaration : public Statement {
+		std::string name; 
+		bool nativeFunc; 
+		// Set when declared with pure, so calls with the same arguments share one result
+		bool pure; 
+		std::vector<std::string> parameters; 
+		std::vector<Statement*> statements; 
+
+		FuncDeclaration(); 
+	};
+	struct DishDeclaration : public Statement {
+		std::string name; 
+		std::vector<VarDeclaration*> fields; 
+
+		DishDeclaration(); 
+	};
+	struct IfStatement : public Statement {
+		Expr* condition; 
+		std::vector<Statement*> ifStatements;
+		std::vector<Statement*> elseStatements; 
+
+		IfStatement(); 
+	};
+	struct WhileStatement : public Statement {
+		Expr* condition; 
+		std::vector<Statement*> statements; 
+		// Expressions in the loop that evaluate to the same value on every iteration, which
+		// are evaluated once before the first
+		std::vector<Expr*> invariants; 
+
+		WhileStatement(); 
+	};
+	// Loop over the numbers counting from start up to end, or down to it when step is negative, 
+	// or over the elements of a list when iterable is set, binding each to the noodle in turn. 
+	// The bounds are evaluated once before the first iteration.
+	struct ForStatement : public Statement {
+		std::string identifier; 
+		Expr* start; 
+		Expr* end; 
+		Expr* step; 
+		Expr* iterable; 
+		std::vector<Statement*> statements; 
+
+		ForStatement(); 
+	};
+	// Leaves the loop it's in, which then results in null
+	struct BreakStatement : public Statement {
+		BreakStatement(); 
+	};
+	// Skips the rest of the loop's body, checking its condition again
+	struct ContinueStatement : public Statement {
+		ContinueStatement(); 
+	};
+	// Leaves the recipe it's in, which results in the value of the expression
+	struct ReturnStatement : public Statement {
+		Expr* expr; 
+
+		ReturnStatement(); 
+	};
+
+	struct NullLiteral : public Expr {
+		NullLiteral(); 
+	};
+	struct NumLiteral : public Expr {
+		double value; 
+		// Set by the lexer's classification of the literal, when it's written as an integer
+		bool integral; 
+		int64_t integer; 
+
+		NumLiteral(); 
+	};
+	struct StringLiteral : public Expr {
+		std::string value; 
+
+		StringLiteral();
+	};
+	struct ListLiteral : public Expr {
+		std::vector<Expr*> elements; 
+
+		ListLiteral(); 
+	};
+	struct Identifier : public Expr {
+		std::string name; 
+
+		Identifier(); 
+	};
+	struct ListAccesser : public Expr {
+		std::string name; 
+		int index; 
+
+		ListAccesser(); 
+	};
+	struct FieldAccesser : public Expr {
+		Expr* object; 
+		std::string field; 
+		// Inline cache of the slot the field was found at for the last dish shape accessed
+		const DishShape* cachedShape; 
+		int cachedSlot; 
+
+		FieldAccesser(); 
+	};
+	struct UnaryExpr : public Expr {
+		Expr* expr; 
+		std::string operation; 
+
+		UnaryExpr(); 
+	};
+	struct BinaryExpr : public Expr {
+		Expr* leftExpr;
+		Expr* rightExpr;
+		std::string operation;
+		// After its first evaluation, the expression rewrites itself into one specialized for 
+		// the operand types it saw, and into a generic one if they ever change
+		enum class Specialization { 
+			Unspecialized, Number, Bool, String, Generic 
+		} specialization; 
+		BinaryOperation binaryOperation; 
+
+		BinaryExpr(); 
+	};
+	struct AssignmentExpr : public Expr {
+		Expr* assigne; 
+		Expr* value; 
+
+		AssignmentExpr(); 
+	};
+	struct FuncCall : public Expr {
+		std::string caller; 
+		std::vector<Expr*> arguments; 
+
+		FuncCall(); 
+	};
+	// Call to a small recipe that was replaced by its body, whose parameters are renamed so that
+	// binding them in the caller's scope can't clash with its noodles
+	struct InlinedCall : public Expr {
+		std::string caller; 
+		std::vector<Expr*> arguments; 
+		std::vector<std::string> parameters; 
+		std::vector<Statement*> statements; 
+
+		InlinedCall(); 
+	};
+
+	std::ostream& operator<<(std::ostream& ostream, const Statement* statement); 
 }
\ No newline at end of file
@@ -1,52 +1,65 @@
-#pragma once
-
-// Depdencencies
-#include <string>
-#include <vector>
-#include <iostream>
-
-namespace ns {
-	enum class TokenType {
-		Number,
-		Bool, 
-		String,
-		Const, 
-		Var, 
-		Func, 
-		EndStatement,  
-		If,
-		Else,
-		While, 
-		Equals,
-		UnaryOperator, 
-		BinaryOperator,
-		OpenParen,
-		CloseParen,
-		OpenBracket, 
-		CloseBracket, 
-		Identifier,
-		Comment, 
-		EndOfLine, 
-		EndOfFile,
-		Invalid
-	};
-	struct TokenIdentifier {
-		std::vector<std::string> identifiers; 
-
-		static TokenIdentifier tokenIdentifiers[static_cast<int>(TokenType::Invalid)];
-	};
-	struct Token {
-		TokenType type; 
-		std::string string; 
-	};
-
-	void processEscapeCharacters(std::string& string); 
-	void unprocessEscapeCharacters(std::string& string); 
-	std::string extractNextIdentifier(std::string& line, char seperator = ' ');
-	std::vector<std::string>& extractWords(const std::string& string);
-	Token determineTokenType(const std::string& nextIdentifier);
-	std::vector<Token>& tokenize(const std::string& sourceCode);
-
-	std::ostream& operator<<(std::ostream& ostream, Token token); 
-	std::ostream& operator<<(std::ostream& ostream, const std::vector<Token>& tokens);
+#pragma once
+
+// Depdencencies
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <iostream>
+
+namespace ns {
+	enum class TokenType {
+		Number,
+		Bool, 
+		String,
+		Const, 
+		Pure, 
+		Var, 
+		Func, 
+		Dish, 
+		EndStatement,  
+		If,
+		Else,
+		While, 
+		For, 
+		In, 
+		Break, 
+		Continue, 
+		Return, 
+		Equals,
+		UnaryOperator, 
+		BinaryOperator,
+		OpenParen,
+		CloseParen,
+		OpenBracket, 
+		CloseBracket, 
+		Identifier,
+		Comment, 
+		EndOfLine, 
+		EndOfFile,
+		Invalid
+	};
+	struct TokenIdentifier {
+		std::vector<std::string> identifiers; 
+
+		static TokenIdentifier tokenIdentifiers[static_cast<int>(TokenType::Invalid)];
+	};
+	struct Token {
+		TokenType type; 
+		std::string string; 
+	};
+
+	void processEscapeCharacters(std::string& string); 
+	void unprocessEscapeCharacters(std::string& string); 
+	// Returns the identifier at the position in the source, moving the position past it
+	std::string extractNextIdentifier(
+		const std::string& source, size_t& position, char seperator = ' '
+	);
+	std::vector<std::string>& extractWords(const std::string& string);
+	Token determineTokenType(const std::string& nextIdentifier);
+	// Returns false if the number token isn't written as an integer, or doesn't fit in 64 bits
+	bool parseIntegerLiteral(const std::string& number, int64_t& integer); 
+	std::vector<Token>& tokenize(const std::string& sourceCode);
+
+	std::ostream& operator<<(std::ostream& ostream, Token token); 
+	std::ostream& operator<<(std::ostream& ostream, const std::vector<Token>& tokens);
 }
\ No newline at end of file
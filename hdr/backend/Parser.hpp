@@ -1,40 +1,53 @@
-#pragma once
-
-// Dependencies
-#include "../util/Memory.hpp"
-#include "AST.hpp"
-
-namespace ns {
-	class Parser {
-	public:
-		std::vector<Token>* tokens; 
-
-		Parser(); 
-
-		std::vector<Token>* lexSourceCode(const std::string& sourceCode); 
-		Program* produceAST(); 
-	private:
-		Token prvsToken; 
-
-		Statement* parseStatement(); 
-		Statement* parseVarDeclaration(); 
-		Statement* parseFuncDeclaration();
-		Statement* parseIfStatement(); 
-		Statement* parseWhileStatement(); 
-
-		Expr* parseExpr(); 
-		Expr* parseAssignmentExpr(); 
-		Expr* parseConditionalExpr(); 
-		Expr* parsePrimaryConditionalExpr(); 
-		Expr* parseAdditiveExpr();
-		Expr* parseMultiplicativeExpr(); 
-		Expr* parseAdditiveUnaryExpr(); 
-		Expr* parseFuncCallExpr(); 
-		Expr* parsePrimaryExpr();
-
-		Token getToken(int index = 0) const; 
-		Token popToken(int index = 0); 
-		Token expectToken(TokenType tokenType, int index = 0);
-		bool atEOF() const; 
-	};
+#pragma once
+
+// Dependencies
+#include "../util/Memory.hpp"
+#include "AST.hpp"
+
+namespace ns {
+	class Parser {
+	public:
+		std::vector<Token>* tokens; 
+
+		Parser(); 
+
+		std::vector<Token>* lexSourceCode(const std::string& sourceCode); 
+		Program* produceAST(); 
+	private:
+		Token prvsToken; 
+		// Tokens before it were already parsed. They're skipped rather than erased, which would
+		// move every token after them.
+		size_t nextTokenIndex; 
+		// Loops and recipes the statements being parsed are nested in, as break and continue 
+		// statements can only be used in a loop, and return statements in a recipe. Recipes
+		// start counting loops again, as they can't leave the loops they're declared in.
+		int loopDepth; 
+		int recipeDepth; 
+
+		Statement* parseStatement(); 
+		Statement* parseVarDeclaration(); 
+		Statement* parseFuncDeclaration();
+		Statement* parseDishDeclaration(); 
+		Statement* parseIfStatement(); 
+		Statement* parseWhileStatement(); 
+		Statement* parseForStatement(); 
+		Statement* parseLoopControlStatement(); 
+		Statement* parseReturnStatement(); 
+
+		Expr* parseExpr(); 
+		Expr* parseAssignmentExpr(); 
+		Expr* parseConditionalExpr(); 
+		Expr* parsePrimaryConditionalExpr(); 
+		Expr* parseAdditiveExpr();
+		Expr* parseMultiplicativeExpr(); 
+		Expr* parseAdditiveUnaryExpr(); 
+		Expr* parseFuncCallExpr(); 
+		Expr* parsePrimaryExpr();
+		Expr* parseIdentifier(const std::string& identifierName); 
+
+		Token getToken(int index = 0) const; 
+		Token popToken(int index = 0); 
+		Token expectToken(TokenType tokenType, int index = 0);
+		bool atEOF() const; 
+	};
 }
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+// Dependencies
+#include <string>
+
+namespace ns {
+	// Recipe calls currently running, which tail calls don't add to
+	extern int callDepth; 
+	// How deeply recipe calls can be nested before an error is thrown
+	extern int callDepthLimit; 
+
+	// Marks where the native stack starts, once a program starts running
+	void markNativeStackBase(); 
+	// Counts a call about to start, throwing if calls are nested too deeply. Calls that nest on
+	// the native stack are also checked against how much of it is left.
+	void enterRecipeCall(const std::string& caller, bool nestsNatively); 
+	void leaveRecipeCall(); 
+}
\ No newline at end of file
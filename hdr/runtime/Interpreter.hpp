@@ -1,40 +1,86 @@
-#pragma once
-
-// Dependencies
-#include "eval/Expressions.hpp"
-
-namespace ns {
-	class Interpreter {
-	public:
-		Interpreter(); 
-		~Interpreter(); 
-
-		void generateProgram(const std::string& sourceCode); 
-		void runProgram(); 
-		void deleteProgramMemory(); 
-		void logTokens() const; 
-		void logAST() const; 
-
-		void enableTokenLogging(bool shouldLogTokens); 
-		void enableASTLogging(bool shouldLogAST); 
-		void enableRuntimeValueLogging(bool shouldLogRuntimeValue); 
-
-		bool isTokenLoggingEnabled() const; 
-		bool isASTLoggingEnabled() const; 
-		bool isRuntimeValueLoggingEnabled() const; 
-	private:
-		Memory memory; 
-		Parser parser; 
-		Program* program; 
-		Scope* globalScope; 
-		RuntimeValue* runtimeValue; 
-		std::vector<Token> tokens; 
-		bool shouldLogTokens; 
-		bool shouldLogAST; 
-		bool shouldLogRuntimeValue; 
-
-		void initGlobalScope(bool reallocate = true);
-		void copyTokens(const std::vector<Token>* tokens); 
-		void logRuntimeValue(); 
-	};
+#pragma once
+
+// Dependencies
+#include "aot/Transpiler.hpp"
+#include "Optimizer.hpp"
+#include "vm/Compiler.hpp"
+#include "vm/VirtualMachine.hpp"
+
+namespace ns {
+	class Interpreter {
+	public:
+		Interpreter(); 
+		~Interpreter(); 
+
+		void generateProgram(const std::string& sourceCode); 
+		void runProgram(); 
+		// Transpiles the program to C++ next to the output path, and builds it into an executable
+		// there with the system compiler
+		void compileProgram(const std::string& outputPath); 
+		void deleteProgramMemory(); 
+		void logTokens() const; 
+		void logAST() const; 
+		void logBytecode() const; 
+
+		void enableTokenLogging(bool shouldLogTokens); 
+		void enableASTLogging(bool shouldLogAST); 
+		void enableRuntimeValueLogging(bool shouldLogRuntimeValue); 
+		void enableBytecode(bool shouldUseBytecode); 
+		void enableBytecodeLogging(bool shouldLogBytecode); 
+		void enableSuperinstructions(bool shouldUseSuperinstructions); 
+		void enableJit(bool shouldUseJit); 
+		void enableInlining(bool shouldInline); 
+		void enableHoisting(bool shouldHoist); 
+		void enableSimplification(bool shouldSimplify); 
+		void enablePruning(bool shouldPrune); 
+		// Limits how deeply recipe calls can be nested, ignoring limits that aren't positive
+		void setCallDepthLimit(int callDepthLimit); 
+
+		bool isTokenLoggingEnabled() const; 
+		bool isASTLoggingEnabled() const; 
+		bool isRuntimeValueLoggingEnabled() const; 
+		bool isBytecodeEnabled() const; 
+		bool isBytecodeLoggingEnabled() const; 
+		bool isSuperinstructionsEnabled() const; 
+		bool isJitEnabled() const; 
+		bool isInliningEnabled() const; 
+		bool isHoistingEnabled() const; 
+		bool isSimplificationEnabled() const; 
+		bool isPruningEnabled() const; 
+		int getCallDepthLimit() const; 
+	private:
+		Memory memory; 
+		Parser parser; 
+		Program* program; 
+		Chunk* chunk; 
+		Scope* globalScope; 
+		RuntimeValue* runtimeValue; 
+		std::vector<Token> tokens; 
+		bool shouldLogTokens; 
+		bool shouldLogAST; 
+		bool shouldLogRuntimeValue; 
+		// When unset, programs are evaluated by walking the AST instead
+		bool shouldUseBytecode; 
+		bool shouldLogBytecode; 
+		// When unset, loop idioms aren't fused into superinstructions, for comparing them
+		bool shouldUseSuperinstructions; 
+		// When unset, hot chunks are never compiled to native code
+		bool shouldUseJit; 
+		// When unset, small recipes are called instead of being inlined where they're called
+		bool shouldInline; 
+		// When unset, expressions that don't change in a loop are evaluated on every iteration
+		bool shouldHoist; 
+		// When unset, expressions are evaluated as written, even where they repeat or reduce to
+		// cheaper ones
+		bool shouldSimplify; 
+		// When unset, recipes that are never called and branches that are never taken are kept,
+		// so the terminal can still call the recipes once the program ran
+		bool shouldPrune; 
+		// Nodes removed from the program, as they could never run
+		int prunedNodeCount; 
+
+		void initGlobalScope(bool reallocate = true);
+		void copyTokens(const std::vector<Token>* tokens); 
+		void logRuntimeValue(); 
+	};
 }
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+// Dependencies
+#include "Values.hpp"
+
+namespace ns {
+	// Calls to pure recipes whose result was found in their cache, and calls it was missing from
+	extern size_t recipeCacheHits; 
+	extern size_t recipeCacheMisses; 
+
+	// Writes the type and exact value of each argument into the key. Returns false if one isn't a 
+	// number, bool, string or null, as other values can be modified and are compared by identity.
+	bool makeRecipeCacheKey(RuntimeValue* const* arguments, size_t argumentCount, std::string& key); 
+	// Returns a copy of the result cached for the arguments, or null if the call wasn't cached
+	RuntimeValue* findCachedResult(FuncValue* funcValue, const std::string& key); 
+	// Results are stored as copies, so the caller modifying its own can't change them. Lists, 
+	// maps, sets and dishes are never stored, as they could still hold values the caller shares.
+	void storeCachedResult(FuncValue* funcValue, const std::string& key, RuntimeValue* result); 
+}
\ No newline at end of file
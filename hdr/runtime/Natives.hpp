@@ -0,0 +1,27 @@
+#pragma once
+
+// Dependencies
+#include <functional>
+
+#include "Values.hpp"
+
+namespace ns {
+	// Number of arguments each native is called with, or -1 if they aren't counted
+	extern const int nativeFuncArities[numOfNativeFuncs]; 
+
+	// Returns -1 if no native has the given name
+	int findNativeFunc(const std::string& name); 
+	// Whether the noodle holds the native it's named after, rather than a recipe shadowing it
+	bool isNativeFunc(const RuntimeValue* callee, const std::string& name);
+	// Whether the native modifies the noodle passed in, so it's checked for being frozen first
+	bool checksFrozenArgument(int nativeIndex); 
+	void verifyNativeArgumentCount(int nativeIndex, const std::string& caller, size_t argumentCount); 
+	void serveRuntimeValue(const RuntimeValue* runtimeValue); 
+	// Calls a native with arguments that were already evaluated. Natives modifying an interned 
+	// string modify their own copy, which is passed to storeStringArgument to be stored where the 
+	// first argument came from. serveRaw prints its arguments' source, so it's left to callers.
+	RuntimeValue* callNativeFunc(
+		int nativeIndex, RuntimeValue* const* arguments, size_t argumentCount, 
+		const std::function<void(StringValue*)>& storeStringArgument
+	); 
+}
\ No newline at end of file
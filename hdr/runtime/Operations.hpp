@@ -0,0 +1,75 @@
+#pragma once
+
+// Dependencies
+#include "Values.hpp"
+
+namespace ns {
+	// Names of the binary operations, in the order they're listed in BinaryOperation
+	extern const char* binaryOperationNames[]; 
+
+	RuntimeValue* evaluateUnaryValue(RuntimeValue* nodeEvaluated, const std::string& operation); 
+	RuntimeValue* evaluateNumericUnaryExpr(NumValue* numberValue, const std::string& operation); 
+	RuntimeValue* evaluateConditionalUnaryExpr(BoolValue* boolValue, const std::string& operation);
+	RuntimeValue* evaluateBinaryValues(
+		RuntimeValue* leftNodeEvaluated, RuntimeValue* rightNodeEvaluated, 
+		const std::string& operation
+	); 
+	RuntimeValue* evaluateNumericBinaryExpr(
+		NumValue* leftNumValue, NumValue* rightNumValue, const std::string& operation
+	);
+	// Returns nullptr if the result isn't an integer, so it's evaluated with doubles instead
+	RuntimeValue* evaluateIntegerBinaryExpr(int64_t left, int64_t right, const std::string& operation); 
+	RuntimeValue* evaluateConditionalBinaryExpr(
+		BoolValue* leftBoolValue, BoolValue* rightBoolValue, const std::string& operation
+	); 
+	RuntimeValue* evaluateStringBinaryExpr(
+		StringValue* leftStringValue, StringValue* rightStringValue, const std::string& operation
+	); 
+	bool equalStringValues(const StringValue* leftStringValue, const StringValue* rightStringValue); 
+	// Evaluates operations on numbers once the operation is known, which specialized 
+	// expressions and the virtual machine use to skip looking it up by name
+	RuntimeValue* evaluateNumberOperation(
+		const NumValue* leftNumValue, const NumValue* rightNumValue, BinaryOperation operation
+	); 
+	// Stores the number raised to the exponent in the power, which is an exact integer when
+	// an integer is raised to a whole power that fits in one
+	void raiseNumber(const NumValue* base, const NumValue* exponent, NumValue* power); 
+	bool compareNumbers(
+		const NumValue* leftNumValue, const NumValue* rightNumValue, BinaryOperation operation
+	); 
+	DishValue* createDishValue(
+		const DishShape* dishShape, RuntimeValue* const* arguments, size_t argumentCount
+	); 
+	// Finds the slot of the field in the dish, which is cached for the next dish accessed if it 
+	// has the same shape
+	DishValue* resolveDishField(
+		RuntimeValue* object, const std::string& field, const DishShape*& cachedShape, 
+		int& cachedSlot
+	); 
+	// Whether the callee is a recipe with more or fewer parameters than the call has arguments.
+	// The tree walker throws before evaluating any of the arguments when there are fewer, and
+	// never evaluates the ones left over when there are more.
+	bool takesOtherArgumentCount(const RuntimeValue* callee, size_t argumentCount); 
+	// Thrown once a while loop's condition results in anything but a bool
+	void throwLoopConditionError(); 
+	// Checks that the bounds of a for loop's range are numbers and that it steps, replacing each
+	// with a copy the loop owns, so that the start can be counted in place and changes to the 
+	// noodles the bounds came from don't change how many times the loop runs
+	void prepareRange(RuntimeValue*& start, RuntimeValue*& end, RuntimeValue*& step); 
+	// Returns false once the count passes the end, which it counts up to when the step is 
+	// positive and down to otherwise. Until then, assigns the count to the loop's noodle and 
+	// steps it. The noodle's number is updated in place as long as it still holds the one the 
+	// loop assigned it last, which ownedValue keeps track of.
+	bool advanceRange(
+		RuntimeValue*& noodleValue, RuntimeValue*& ownedValue, NumValue* count, 
+		const NumValue* end, const NumValue* step
+	); 
+	ListValue* expectIterable(RuntimeValue* iterable); 
+	// Like advanceRange, but assigns the element at the index, which counts up to the list's 
+	// size as it is when checked. Numbers are read straight out of numeric lists, without 
+	// boxing them first, and other elements are copied like an assignment would.
+	bool advanceElement(
+		RuntimeValue*& noodleValue, RuntimeValue*& ownedValue, const ListValue* list, 
+		int64_t& index
+	); 
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#pragma once
+
+// Dependencies
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Values.hpp"
+
+namespace ns {
+	// Rewrites programs once they're parsed, in ways that only change how fast they run
+	class Optimizer {
+	public:
+		Optimizer(
+			bool shouldInline = true, bool shouldHoist = true, bool shouldSimplify = true, 
+			bool shouldPrune = true
+		);
+
+		void optimizeProgram(Program* program);
+		// How many nodes the last program optimized had removed, as they could never run
+		int getPrunedNodeCount() const;
+		// Expressions the statements evaluate in more than one place, as they were found to
+		// have the same value there. Lists of statements nested in them have their own.
+		static std::vector<const Expr*> findCommonExprs(const std::vector<Statement*>& statements);
+	private:
+		// Recipe whose calls are replaced by its body, with the parameters renamed
+		struct InlinedRecipe {
+			std::vector<std::string> parameters;
+			std::vector<Statement*> statements;
+		};
+		// What running a loop's condition and body once can change
+		struct LoopEffects {
+			// Noodles that are assigned, declared or updated in place
+			std::unordered_set<std::string> changedNames;
+			// Set when a list, map, set, string or dish that may be held elsewhere is updated in 
+			// place, which only changes what's read from inside values that may be held elsewhere
+			bool changesSharedValues;
+			// Set when a number that may be held elsewhere is updated in place, which could change
+			// any noodle that may be holding it, and what's read from inside any value
+			bool changesSharedNumbers;
+			// Recipes can assign to any noodle of their caller, so nothing is hoisted past them
+			bool callsRecipes;
+
+			LoopEffects();
+		};
+
+		// When unset, recipe calls are left as they are, for debugging
+		bool shouldInline;
+		// When unset, loop invariant expressions are evaluated on every iteration
+		bool shouldHoist;
+		// When unset, expressions are evaluated as they're written
+		bool shouldSimplify;
+		// When unset, recipes that are never called and branches that are never taken are kept
+		bool shouldPrune;
+		int prunedNodeCount;
+		// How many times each name is declared as a noodle, recipe, dish or parameter
+		std::unordered_map<std::string, int> declarationCounts;
+		std::unordered_set<std::string> assignedNames;
+		// Only recipes declared before the statement being optimized, which are always declared
+		// by the time it runs
+		std::unordered_map<std::string, InlinedRecipe> inlinedRecipes;
+		// Noodles whose value may also be held by another noodle, a parameter or a list, as
+		// declarations and calls don't copy the values they're given
+		std::unordered_set<std::string> sharedNames;
+		// Expressions already hoisted out of an enclosing loop
+		std::unordered_set<const Expr*> hoistedExprs;
+		// Names declared once at the top level, as a pure recipe or as a frozen noodle whose
+		// value nothing else holds, so they always have the same value when pure recipes read them
+		std::unordered_set<std::string> pureNames;
+
+		// Nodes a recipe's body can have, once the calls in it are inlined, for it to be inlined
+		static const int inlinedNodeLimit = 24;
+
+		void countDeclarations(Statement* statement);
+		void inlineStatements(std::vector<Statement*>& statements);
+		// Returns the statement, or the inlined call replacing it
+		Statement* inlineStatement(Statement* statement);
+		// Recipes are only inlined when their name always refers to them, and their body
+		// declares nothing and calls no other recipes, so it can run in the caller's scope
+		bool isInlinable(FuncDeclaration* funcDeclaration);
+		// Whether the name always refers to the native it's named after
+		bool isNativeName(const std::string& name) const;
+
+		// Throws if a recipe declared pure could have side effects, or read a noodle that could
+		// change between its calls, as calls with the same arguments would then share a result
+		void verifyPureRecipes(Program* program);
+		void verifyPureRecipe(const FuncDeclaration* funcDeclaration);
+
+		// Removes the branches of if statements whose condition is always the same bool, then
+		// the recipes declared at the top level that nothing left refers to
+		void pruneProgram(Program* program);
+		// Frozen noodles declared at the top level with a bool are only folded in the statements
+		// after their declaration, which are the only ones that can read them
+		void pruneBranches(
+			Statement* statement, const std::unordered_map<std::string, bool>& constantNames
+		);
+		void pruneUnusedRecipes(Program* program);
+		void removeStatements(std::vector<Statement*>& statements);
+		// Returns 1 or 0 when the condition always results in true or false, or -1 otherwise
+		int foldCondition(
+			const Expr* condition, const std::unordered_map<std::string, bool>& constantNames
+		) const;
+
+		// Noodles are shared when their value is stored elsewhere without being copied, which
+		// includes the statements whose value escapes as a result
+		void findSharedNames(Statement* statement, bool escapes = false);
+		// Shares the noodle whose own value the expression results in, if there is one
+		void shareIdentifier(const Expr* expr);
+		// Hoists invariant expressions out of every while loop nested in the statement
+		void hoistInvariants(Statement* statement);
+		void findLoopEffects(Statement* statement, LoopEffects& loopEffects) const;
+		void findInvariants(
+			Statement* statement, const LoopEffects& loopEffects, std::vector<Expr*>& invariants
+		);
+		// Hoists the operand if it's worth computing once, or looks for invariants inside it.
+		// Operands are only read where they're used, so the hoisted value is never stored.
+		void findInvariantOperand(
+			Expr* operand, const LoopEffects& loopEffects, std::vector<Expr*>& invariants
+		);
+		bool isInvariant(const Expr* expr, const LoopEffects& loopEffects) const;
+		// Whether the expression may result in a value held elsewhere, rather than a new one or
+		// the value of a noodle no one else holds
+		bool mayHoldSharedValue(const Expr* expr) const;
+
+		// Rewrites the expressions nested in the statement into cheaper ones with the same result
+		void reduceExpressions(Statement* statement);
+		// Returns the expression, or a cheaper one replacing it
+		Expr* reduceExpression(Expr* expr) const;
+		// Makes the same pure expression evaluated again in a list of statements, with nothing
+		// it reads changed in between, share the node of its first evaluation
+		void eliminateCommonExprs(Statement* statement);
+		// Finds the common expressions of one statement in a list, in the order it evaluates
+		// them, where availableExprs holds the expressions evaluated so far by their text
+		void findCommonExprs(
+			Statement* statement, std::unordered_map<std::string, Expr*>& availableExprs
+		);
+		// Replaces the operand with an earlier expression if one is available. Like hoisted
+		// expressions, operands are only read where they're used, so their value is never stored.
+		void findCommonOperand(
+			Expr*& operand, std::unordered_map<std::string, Expr*>& availableExprs
+		);
+		// Forgets the available expressions that the statement could change the value of
+		void forgetChangedExprs(
+			Statement* statement, std::unordered_map<std::string, Expr*>& availableExprs
+		) const;
+
+		static std::string renameParameter(const std::string& recipe, const std::string& parameter);
+		// Copies a body that declares nothing, renaming the noodles it reads and assigns
+		static Statement* cloneStatement(
+			Statement* statement, const std::unordered_map<std::string, std::string>& renamedNames
+		);
+		static int countNodes(Statement* statement);
+		// Writes the expression out, so that expressions with the same text are equal
+		static std::string describeExpr(const Expr* expr);
+		// Whether the expression always results in a new number, or in null
+		static bool isNumeric(const Expr* expr);
+		static void collectCommonExprs(
+			Statement* statement, std::unordered_set<const Statement*>& visitedNodes,
+			std::vector<const Expr*>& commonExprs
+		);
+	};
+}
\ No newline at end of file
@@ -1,30 +1,57 @@
-#pragma once
-
-// Dependencies
-#include <unordered_map>
-
-#include "Values.hpp"
-
-namespace ns {
-	class Scope {
-	public:
-		Scope();
-
-		Scope* assignParent(Scope* parent); 
-		RuntimeValue* declareVariable(
-			const std::string& variableName, RuntimeValue* runtimeValue, bool constant = false
-		); 
-		RuntimeValue* assignVariable(const std::string& variableName, RuntimeValue* runtimeValue); 
-		Scope* resolveVariable(const std::string& variableName); 
-		RuntimeValue* getVariableValue(const std::string& variableName);
-		bool isVariableConst(const std::string& variableName); 
-	private:
-		struct Variable {
-			bool constant; 
-			RuntimeValue* runtimeValue; 
-		};
-
-		Scope* parent; 
-		std::unordered_map<std::string, Variable> variables; 
-	};
+#pragma once
+
+// Dependencies
+#include <unordered_map>
+
+#include "Values.hpp"
+
+namespace ns {
+	class Scope {
+	public:
+		struct Variable {
+			bool constant; 
+			RuntimeValue* runtimeValue; 
+		};
+
+		Scope();
+
+		Scope* assignParent(Scope* parent); 
+		RuntimeValue* declareVariable(
+			const std::string& variableName, RuntimeValue* runtimeValue, bool constant = false
+		); 
+		RuntimeValue* assignVariable(const std::string& variableName, RuntimeValue* runtimeValue); 
+		Scope* resolveVariable(const std::string& variableName); 
+		RuntimeValue* getVariableValue(const std::string& variableName);
+		bool isVariableConst(const std::string& variableName); 
+		// Variables are never removed from a scope, so the returned variable stays valid
+		Variable* findVariable(const std::string& variableName); 
+		// Returns null rather than throwing if the variable isn't defined
+		Variable* lookupVariable(const std::string& variableName); 
+		// Assigns the variable wherever it's found, or declares it in this scope otherwise
+		Variable* bindVariable(const std::string& variableName, RuntimeValue* runtimeValue); 
+		// Declares the noodle of a for loop, or assigns it if this scope already declares it, as
+		// it does when the loop is run again
+		Variable* declareLoopVariable(const std::string& variableName, RuntimeValue* runtimeValue); 
+
+		static RuntimeValue* assignVariable(
+			Variable* variable, const std::string& variableName, RuntimeValue* runtimeValue
+		); 
+	private:
+		// Variable found in an ancestor, which stays valid until a scope with children declares
+		// a variable, as that may shadow it
+		struct CachedVariable {
+			Variable* variable; 
+			unsigned int declarationEpoch; 
+		};
+
+		Scope* parent; 
+		// Set once the scope becomes a parent, as its declarations may then shadow the variables
+		// cached by its descendants
+		bool hasChildren; 
+		std::unordered_map<std::string, Variable> variables; 
+		// Only filled by lookups walking long chains of scopes, such as from deep recursion
+		std::unordered_map<std::string, CachedVariable> cachedVariables; 
+
+		static unsigned int declarationEpoch; 
+	};
 }
\ No newline at end of file
@@ -1,57 +1,204 @@
-#pragma once
-
-// Dependencies
-#include "../backend/AST.hpp"
-
-namespace ns {
-	constexpr int numOfNativeFuncs = 17; 
-	extern const char* nativeFuncNames[numOfNativeFuncs]; 
-	class Scope; 
-
-	struct RuntimeValue {
-		ValueType valueType; 
-
-		virtual ~RuntimeValue() {}; 
-	};
-	struct NullValue : public RuntimeValue {
-		std::string value; 
-
-		NullValue();
-	};
-	struct NumValue : public RuntimeValue {
-		double value; 
-
-		NumValue(); 
-		NumValue(double value); 
-	};
-	struct BoolValue : public RuntimeValue {
-		bool state; 
-
-		BoolValue(); 
-		BoolValue(bool state); 
-	};
-	struct StringValue : public RuntimeValue {
-		std::string value; 
-
-		StringValue(); 
-		StringValue(const std::string& value); 
-	};
-	struct ListValue : public RuntimeValue {
-		std::vector<RuntimeValue*> elements; 
-
-		ListValue(); 
-	};
-	struct FuncValue : public RuntimeValue {
-		std::string name;
-		std::vector<std::string> parameters; 
-		std::vector<Statement*> statements;
-		Scope* scope; 
-		bool nativeFunc; 
-
-		FuncValue(); 
-	};
-
-	RuntimeValue* cloneRuntimeValue(RuntimeValue* runtimeValue); 
-
-	std::ostream& operator<<(std::ostream& ostream, const RuntimeValue* runtimeValue); 
+#pragma once
+
+// Dependencies
+#include <cstdint>
+
+#include "../backend/AST.hpp"
+#include "../util/HashTable.hpp"
+#include "../util/LruCache.hpp"
+#include "../util/PersistentVector.hpp"
+#include "../util/RingBuffer.hpp"
+
+namespace ns {
+	constexpr int numOfNativeFuncs = 37; 
+	extern const char* nativeFuncNames[numOfNativeFuncs]; 
+	class Scope; 
+	struct Chunk; 
+
+	struct RuntimeValue {
+		ValueType valueType; 
+
+		virtual ~RuntimeValue() {}; 
+	};
+	struct NullValue : public RuntimeValue {
+		std::string value; 
+
+		NullValue();
+	};
+	struct NumValue : public RuntimeValue {
+		double value; 
+		// When set, the number is stored exactly as an integer, and value holds the closest double
+		bool integral; 
+		int64_t integer; 
+
+		NumValue(); 
+		NumValue(double value); 
+
+		void setInteger(int64_t integer); 
+		// Whole numbers are stored as integers if the double holds them exactly
+		void setNumber(double number); 
+		// Truncates the number, without converting integers through a double
+		int64_t toInteger() const; 
+	};
+	struct BoolValue : public RuntimeValue {
+		bool state; 
+
+		BoolValue(); 
+		BoolValue(bool state); 
+	};
+	// Immutable node of a concatenation tree, which can be shared between string values
+	struct StringRope {
+		std::string leaf; 
+		const StringRope* left; 
+		const StringRope* right; 
+		// When set, the node is a slice of the source leaf starting at the offset
+		const StringRope* source; 
+		size_t offset; 
+		size_t length; 
+
+		StringRope(); 
+	};
+	struct StringValue : public RuntimeValue {
+		// Flattening a rope only changes the representation, so it's allowed on const values
+		mutable std::string value; 
+		// When set, the string is represented by the rope and value is out of date
+		mutable const StringRope* rope; 
+		// Interned strings are shared by every noodle holding them, so they're never modified
+		bool interned; 
+
+		StringValue(); 
+		StringValue(const std::string& value); 
+
+		size_t length() const; 
+		// Returns the characters without copying them, unless the string is a concatenation
+		const char* data() const; 
+		const std::string& flatten() const; 
+	};
+	// Number stored unboxed in a numeric list. Whether it's an exact integer is kept with it, so 
+	// it's read back as the number that was stored rather than guessed from its double.
+	struct ListNumber {
+		union {
+			double value; 
+			int64_t integer; 
+		}; 
+		bool integral; 
+
+		ListNumber(); 
+		ListNumber(const NumValue* numValue); 
+
+		void unbox(NumValue* numValue) const; 
+	};
+	struct ListValue : public RuntimeValue {
+		// Lists store unboxed numbers until a non-number is stored, and are ring buffers until 
+		// they are snapshotted, after which both lists share a persistent vector. Views are 
+		// slices of a snapshot, which are copied into a ring buffer once they're modified.
+		enum class Representation { 
+			Vector, Numeric, Persistent, PersistentNumeric, View, NumericView
+		} representation; 
+		RingBuffer<RuntimeValue*> elements; 
+		RingBuffer<ListNumber> numbers; 
+		PersistentVector<RuntimeValue*> persistentElements; 
+		PersistentVector<ListNumber> persistentNumbers; 
+		size_t viewOffset; 
+		size_t viewLength; 
+
+		ListValue(); 
+
+		bool isNumeric() const; 
+		bool isView() const; 
+		size_t size() const; 
+		ListNumber numberAt(size_t index) const; 
+		RuntimeValue* at(size_t index) const; 
+		// Unboxes numbers into the given value rather than a new one, for callers that only read
+		// the element before its next use
+		RuntimeValue* at(size_t index, NumValue* numValue) const; 
+		void set(size_t index, RuntimeValue* element); 
+		void append(RuntimeValue* element); 
+		void prepend(RuntimeValue* element); 
+		RuntimeValue* pop(size_t index); 
+		RuntimeValue* popFront(); 
+		ListValue* snapshot(); 
+		// Returns a view of the elements from start up to, but not including, end
+		ListValue* slice(size_t start, size_t end); 
+
+		// Boxes every number, after which any value can be stored
+		void generalize(); 
+		// Moves the elements into a persistent vector so they can be shared
+		void share(); 
+		// Moves the elements out of the persistent vector, which copies a view's elements
+		void unshare(); 
+	};
+	// Hashes numbers, bools and strings by value, and every other value by identity
+	struct RuntimeValueHash {
+		size_t operator()(const RuntimeValue* runtimeValue) const; 
+	};
+	struct RuntimeValueEqual {
+		bool operator()(const RuntimeValue* leftValue, const RuntimeValue* rightValue) const; 
+	};
+	struct MapValue : public RuntimeValue {
+		HashTable<RuntimeValue*, RuntimeValue*, RuntimeValueHash, RuntimeValueEqual> entries; 
+
+		MapValue(); 
+	};
+	struct SetValue : public RuntimeValue {
+		// Sets don't map their elements to anything, so the values are left unused
+		HashTable<RuntimeValue*, char, RuntimeValueHash, RuntimeValueEqual> elements; 
+
+		SetValue(); 
+	};
+	// Hidden class shared by every dish created from the same declaration, which maps each of 
+	// its field names to the slot the field is stored at
+	struct DishShape {
+		std::string name; 
+		std::vector<std::string> fields; 
+		std::vector<bool> constantFields; 
+		// Default value expressions, evaluated in the scope the dish was declared in
+		std::vector<Expr*> defaultExprs; 
+		Scope* scope; 
+		// Returns the default value of the field at the slot, or nullptr if it has none
+		RuntimeValue* (*evaluateDefault)(const DishShape* dishShape, size_t slot); 
+
+		DishShape(); 
+
+		// Returns -1 if the dish has no field with the given name
+		int findSlot(const std::string& field) const; 
+	};
+	struct DishValue : public RuntimeValue {
+		const DishShape* shape; 
+		std::vector<RuntimeValue*> slots; 
+
+		DishValue(); 
+	};
+	// Results of a pure recipe's most recent calls, keyed on the values they were called with
+	using RecipeCache = LruCache<std::string, RuntimeValue*, 1024>; 
+	struct FuncValue : public RuntimeValue {
+		std::string name;
+		std::vector<std::string> parameters; 
+		std::vector<Statement*> statements;
+		Scope* scope; 
+		bool nativeFunc; 
+		// Set when the recipe constructs dishes of this shape
+		const DishShape* dishShape; 
+		// Set when the recipe's body was compiled to bytecode
+		const Chunk* chunk; 
+		// Set when the recipe's body was compiled to C++ ahead of time
+		RuntimeValue* (*compiledBody)(Scope* scope); 
+		// Set when the recipe's body declares no noodles, so its scope only holds its 
+		// parameters and can be reused when it calls itself in tail position
+		bool reusesScope; 
+		// Set when the recipe is pure, so calls with arguments it was already called with 
+		// return the result they had then
+		RecipeCache* cache; 
+
+		FuncValue(); 
+	};
+
+	StringValue* concatStringValues(StringValue* leftStringValue, StringValue* rightStringValue); 
+	// Returns a view of the characters from start up to, but not including, end
+	StringValue* sliceStringValue(StringValue* stringValue, size_t start, size_t end); 
+	// Returns the shared string holding just the given character
+	StringValue* internChrValue(char chr); 
+	RuntimeValue* cloneRuntimeValue(RuntimeValue* runtimeValue); 
+
+	std::ostream& operator<<(std::ostream& ostream, const RuntimeValue* runtimeValue); 
 }
\ No newline at end of file
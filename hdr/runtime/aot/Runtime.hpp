@@ -0,0 +1,171 @@
+#pragma once
+
+// Dependencies
+#include "../CallStack.hpp"
+#include "../Memoization.hpp"
+#include "../Natives.hpp"
+#include "../Operations.hpp"
+#include "../Scope.hpp"
+#include "../../util/CheckedInteger.hpp"
+#include "../../util/Error.hpp"
+
+// Runtime library of programs transpiled to C++, which only needs the values, scopes, natives
+// and operations of the interpreter
+namespace ns {
+	// Body of a recipe compiled to C++, which runs in the scope its parameters are declared in
+	typedef RuntimeValue* (*CompiledBody)(Scope* scope);
+
+	// Runs the program in a global scope holding the natives, and prints any error it throws
+	int runCompiledProgram(void (*createConstants)(), CompiledBody program);
+
+	RuntimeValue* createCompiledInteger(int64_t integer);
+	RuntimeValue* createCompiledNumber(double number);
+	RuntimeValue* createCompiledString(const char* string, size_t length);
+
+	// Noodles are looked up the first time they're used, and kept for the rest of the call
+	inline Scope::Variable* loadVariable(
+		Scope* scope, const char* name, Scope::Variable*& variable)
+	{
+		return variable != nullptr ? variable : variable = scope->findVariable(name);
+	}
+	void declareCompiledVariable(
+		Scope* scope, const char* name, RuntimeValue* runtimeValue, bool constant,
+		Scope::Variable*& variable
+	);
+	// Binds a parameter of an inlined recipe wherever it was declared, or in the scope
+	void bindCompiledVariable(
+		Scope* scope, const char* name, RuntimeValue* runtimeValue, Scope::Variable*& variable
+	);
+	// Throws if the noodle is frozen
+	void verifyVariableAssignable(Scope::Variable* variable, const char* name);
+	// Throws if the dish's field is frozen
+	void verifyFieldAssignable(const DishValue* dishValue, int slot, const char* field);
+	RuntimeValue* declareCompiledRecipe(
+		Scope* scope, const char* name, const std::vector<std::string>& parameters,
+		CompiledBody compiledBody, bool pure, Scope::Variable*& variable
+	);
+	RuntimeValue* declareCompiledDish(
+		Scope* scope, const char* name, const std::vector<std::string>& fields,
+		const std::vector<bool>& constantFields,
+		RuntimeValue* (*evaluateDefault)(const DishShape* dishShape, size_t slot),
+		Scope::Variable*& variable
+	);
+	// Calls a recipe, dish or native with arguments that were already evaluated
+	RuntimeValue* callCompiledRecipe(
+		RuntimeValue* callee, const char* caller, RuntimeValue* const* arguments,
+		size_t argumentCount, Scope* scope
+	);
+	// Returns null after preparing a call to a compiled recipe, which the recipe making it runs
+	// once it returns, rather than nesting the call. Anything else is called right away.
+	RuntimeValue* tailCallCompiledRecipe(
+		RuntimeValue* callee, const char* caller, RuntimeValue* const* arguments, 
+		size_t argumentCount, Scope* scope
+	);
+
+	// Whether the noodle holds the native it's named after, rather than a recipe shadowing it
+	inline bool isCompiledNative(const RuntimeValue* callee, int nativeIndex) {
+		return callee->valueType == ValueType::FuncValue
+			&& static_cast<const FuncValue*>(callee)->nativeFunc
+				&& static_cast<const FuncValue*>(callee)->name == nativeFuncNames[nativeIndex];
+	}
+	// How many of a call's arguments are evaluated, which for recipes is only those they take,
+	// and none when they take more than the call has, as the call throws
+	inline size_t countCompiledArguments(const RuntimeValue* callee, size_t argumentCount) {
+		if (!takesOtherArgumentCount(callee, argumentCount))
+			return argumentCount; 
+
+		const size_t parameterCount = static_cast<const FuncValue*>(callee)->parameters.size(); 
+		return parameterCount < argumentCount ? parameterCount : 0; 
+	}
+	// Returns 1 or 0 for bools, and -1 for anything else
+	inline int testCompiledCondition(const RuntimeValue* condition) {
+		return condition->valueType == ValueType::Bool
+			? static_cast<const BoolValue*>(condition)->state : -1;
+	}
+	// Passes on the state of a while loop's condition, throwing if it wasn't a bool
+	inline int expectLoopCondition(int state) {
+		if (state == -1)
+			throwLoopConditionError();
+
+		return state;
+	}
+	// Compares the values without storing the result as a bool, returning it like
+	// testCompiledCondition
+	inline int compareCompiledValues(
+		RuntimeValue* leftValue, RuntimeValue* rightValue, BinaryOperation operation)
+	{
+		if (leftValue->valueType == ValueType::Number && rightValue->valueType == ValueType::Number) {
+			return compareNumbers(
+				static_cast<NumValue*>(leftValue), static_cast<NumValue*>(rightValue), operation
+			);
+		}
+
+		return testCompiledCondition(evaluateBinaryValues(
+			leftValue, rightValue, binaryOperationNames[static_cast<int>(operation)]
+		));
+	}
+	inline RuntimeValue* evaluateCompiledBinary(
+		RuntimeValue* leftValue, RuntimeValue* rightValue, BinaryOperation operation)
+	{
+		if (leftValue->valueType == ValueType::Number && rightValue->valueType == ValueType::Number) {
+			const NumValue* leftNumValue = static_cast<NumValue*>(leftValue);
+			const NumValue* rightNumValue = static_cast<NumValue*>(rightValue);
+			int64_t integer;
+
+			// Integers that don't overflow are added, subtracted and multiplied here, where the
+			// operation is known when this is inlined
+			if (leftNumValue->integral && rightNumValue->integral
+				&& ((operation == BinaryOperation::Add
+					&& checkedAdd(leftNumValue->integer, rightNumValue->integer, integer))
+				|| (operation == BinaryOperation::Subtract
+					&& checkedSubtract(leftNumValue->integer, rightNumValue->integer, integer))
+				|| (operation == BinaryOperation::Multiply
+					&& checkedMultiply(leftNumValue->integer, rightNumValue->integer, integer))))
+			{
+				NumValue* numberValue = globalMemory->create<NumValue>();
+				numberValue->setInteger(integer);
+				return numberValue;
+			}
+
+			return evaluateNumberOperation(leftNumValue, rightNumValue, operation);
+		}
+
+		return evaluateBinaryValues(
+			leftValue, rightValue, binaryOperationNames[static_cast<int>(operation)]
+		);
+	}
+	// Increments or decrements the noodle's number in place
+	inline RuntimeValue* stepCompiledVariable(RuntimeValue* runtimeValue, bool increments) {
+		if (runtimeValue->valueType == ValueType::Number
+			&& static_cast<NumValue*>(runtimeValue)->integral
+			&& static_cast<NumValue*>(runtimeValue)->integer != (increments ? INT64_MAX : INT64_MIN))
+		{
+			NumValue* numValue = static_cast<NumValue*>(runtimeValue);
+			numValue->setInteger(numValue->integer + (increments ? 1 : -1));
+			return numValue;
+		}
+
+		return evaluateUnaryValue(runtimeValue, increments ? "++" : "--");
+	}
+	// Counts integers inline, leaving other counts, steps that would overflow and noodles no
+	// longer holding the number assigned last to advanceRange
+	inline bool advanceCompiledRange(
+		RuntimeValue*& noodleValue, RuntimeValue*& ownedValue, NumValue* count,
+		const NumValue* end, const NumValue* step)
+	{
+		int64_t nextCount;
+
+		if (count->integral && end->integral && step->integral && noodleValue == ownedValue
+			&& checkedAdd(count->integer, step->integer, nextCount))
+		{
+			if (step->integer > 0 ? count->integer >= end->integer : count->integer <= end->integer)
+				return false;
+
+			static_cast<NumValue*>(ownedValue)->setInteger(count->integer);
+			count->setInteger(nextCount);
+			return true;
+		}
+
+		return advanceRange(noodleValue, ownedValue, count, end, step);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+#pragma once
+
+// Dependencies
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "../Values.hpp"
+
+namespace ns {
+	// Sources of the runtime library transpiled programs are linked with, relative to the
+	// repository's root
+	constexpr int numOfRuntimeSources = 9; 
+	extern const char* runtimeSources[numOfRuntimeSources]; 
+
+	// Transpiles programs to C++, where every statement is evaluated into a local holding the 
+	// value the virtual machine would evaluate it to
+	class Transpiler {
+	public:
+		Transpiler(); 
+
+		// Returns the source of an executable running the program, once it's built with the
+		// runtime library
+		std::string transpileProgram(Program* program); 
+	private:
+		struct Loop {
+			// Local holding the loop's value, which break and continue statements set to null
+			std::string value; 
+			// Label continue statements jump to, which is empty when the loop checks its 
+			// condition at the top, so they continue the C++ loop itself
+			std::string continueLabel; 
+		}; 
+		// Recipe, dish defaults or program being transpiled
+		struct Function {
+			std::ostringstream code; 
+			// Noodles the function looks up, each cached in its own local
+			std::vector<std::string> names; 
+			std::unordered_set<std::string> nameSet; 
+			int valueCount; 
+			int indentation; 
+			// Whether the statement about to be transpiled is the last one the recipe evaluates,
+			// so a call there can return to the recipe's caller
+			bool tailPosition; 
+			// Loops being transpiled, innermost last
+			std::vector<Loop> loops; 
+
+			Function(); 
+		};
+
+		Function* function; 
+		std::ostringstream prototypes; 
+		std::ostringstream definitions; 
+		std::ostringstream constants; 
+		int constantCount; 
+		int recipeCount; 
+		int dishCount; 
+		// Field accesses each cache the shape they last saw in their own statics
+		int fieldSiteCount; 
+		// Locals holding the invariant expressions of the loops being transpiled, and the common
+		// expressions already evaluated in the statement lists being transpiled
+		std::unordered_map<const Statement*, std::string> reusedValues; 
+		// Common expressions of the statement lists being transpiled, not yet evaluated
+		std::unordered_set<const Statement*> commonExprs; 
+
+		// Defines a function evaluating the statements, returning the value of the last. Recipe
+		// bodies return null once they reach a call in tail position, which their caller runs.
+		void transpileFunction(
+			const std::string& signature, const std::vector<Statement*>& statements, 
+			bool recipeBody = false
+		); 
+		// Evaluates the statements into the given local, which holds the value of the last. 
+		// Expressions they share are only evaluated the first time they're reached.
+		void transpileStatements(const std::vector<Statement*>& statements, const std::string& target); 
+		// Returns the local or constant the statement is evaluated into
+		std::string transpileStatement(Statement* statement); 
+		// Returns a value of the statement's own, as constants can be modified in place
+		std::string transpileStoredValue(Statement* statement); 
+		// Returns a copy of the value assigned, so the noodle it came from isn't modified with it
+		std::string transpileAssignedValue(Expr* expr); 
+		std::string transpileFuncDeclaration(FuncDeclaration* funcDeclaration); 
+		std::string transpileDishDeclaration(DishDeclaration* dishDeclaration); 
+		std::string transpileIfStatement(IfStatement* ifStatement, bool tailPosition); 
+		std::string transpileWhileStatement(WhileStatement* whileStatement); 
+		// Each iteration starts by moving the loop on, so continue statements continue the C++
+		// loop itself
+		std::string transpileForStatement(ForStatement* forStatement); 
+		// Returns a local holding 1 or 0 if the condition is a bool, and -1 otherwise
+		std::string transpileCondition(Expr* condition); 
+		std::string transpileFieldAccesser(FieldAccesser* fieldAccesser, std::string& dish); 
+		std::string transpileAssignmentExpr(AssignmentExpr* assignmentExpr); 
+		std::string transpileFuncCall(FuncCall* funcCall, bool tailPosition); 
+		std::string transpileInlinedCall(InlinedCall* inlinedCall); 
+		std::string transpileNativeFuncCall(FuncCall* funcCall, int nativeIndex); 
+		// Evaluates the arguments of a call to the callee into an array, returning its name or 
+		// nullptr if there are none. Only the arguments the recipe takes are evaluated, like the
+		// tree walker does.
+		std::string transpileArguments(
+			const std::vector<Expr*>& arguments, const std::string& callee
+		); 
+
+		std::ostream& line(); 
+		std::string allocateValue(); 
+		std::string addConstant(const std::string& creation); 
+		// Returns the local the noodle's variable is cached in
+		std::string findVariable(const std::string& name); 
+		// Returns an expression loading the noodle's variable
+		std::string loadVariable(const std::string& name); 
+
+		static bool isConstant(const std::string& value); 
+		// Parameters of inlined recipes are named after the recipe, with a colon C++ doesn't
+		// allow in its names, so their locals are named after both
+		static std::string variableLocal(const std::string& name); 
+		static std::string quoteString(const std::string& string); 
+	};
+}
\ No newline at end of file
@@ -1,26 +1,50 @@
-#pragma once
-
-// Dependencies
-#include "Statements.hpp"
-
-namespace ns {
-	RuntimeValue* evaluateFuncCallExpr(FuncCall* funcCall, Scope* scope); 
-	RuntimeValue* evaluateNativeFuncCallExpr(
-		FuncValue* funcValue, FuncCall* funcCall, Scope* scope
-	); 
-	RuntimeValue* evaluateAssignmentExpr(AssignmentExpr* assignmentExpr, Scope* scope);
-	RuntimeValue* evaluateUnaryExprNode(UnaryExpr* unaryExpr, Scope* scope); 
-	RuntimeValue* evaluateNumericUnaryExpr(NumValue* numberValue, const std::string& operation); 
-	RuntimeValue* evaluateConditionalUnaryExpr(BoolValue* boolValue, const std::string& operation);
-	RuntimeValue* evaluateBinaryExprNode(BinaryExpr* binaryExpr, Scope* scope);
-	RuntimeValue* evaluateNumericBinaryExpr(
-		NumValue* leftNumValue, NumValue* rightNumValue, const std::string& operation
-	);
-	RuntimeValue* evaluateConditionalBinaryExpr(
-		BoolValue* leftBoolValue, BoolValue* rightBoolValue, const std::string& operation
-	); 
-	RuntimeValue* evaluateStringBinaryExpr(
-		StringValue* leftStringValue, StringValue* rightStringValue, const std::string& operation
-	); 
-	RuntimeValue* evaluateIdentifier(Identifier* identifier, Scope* scope);
+#pragma once
+
+// Dependencies
+#include "Statements.hpp"
+#include "../CallStack.hpp"
+#include "../Memoization.hpp"
+#include "../Natives.hpp"
+#include "../Operations.hpp"
+
+namespace ns {
+	RuntimeValue* evaluateFuncCallExpr(FuncCall* funcCall, Scope* scope); 
+	// Evaluates the recipe's body, where calls to other recipes in tail position replace it 
+	// rather than nesting on the native stack
+	RuntimeValue* evaluateRecipeBody(FuncValue* funcValue, Scope* funcScope); 
+	// Evaluates the statements, except for a recipe call in tail position, which is returned 
+	// through tailCall to be made by the caller
+	RuntimeValue* evaluateTailStatements(
+		const std::vector<Statement*>& statements, Scope* scope, FuncCall*& tailCall
+	); 
+	// Returns the scope the recipe is called in, with its parameters declared. Recipes reusing
+	// their scope have their parameters assigned in the given scope instead.
+	Scope* createCallScope(
+		FuncValue* funcValue, FuncCall* funcCall, Scope* scope, bool reusesScope = false
+	); 
+	// Writes the key a call to a pure recipe is cached under, from the parameters bound in the 
+	// scope it's called in. Returns false if the call can't be cached.
+	bool makeCallCacheKey(FuncValue* funcValue, Scope* funcScope, std::string& key); 
+	RuntimeValue* evaluateNativeFuncCallExpr(
+		FuncValue* funcValue, FuncCall* funcCall, Scope* scope
+	); 
+	RuntimeValue* evaluateDishConstruction(FuncValue* funcValue, FuncCall* funcCall, Scope* scope); 
+	// Binds the renamed parameters in the caller's scope, then evaluates the inlined body there
+	RuntimeValue* evaluateInlinedCall(InlinedCall* inlinedCall, Scope* scope); 
+	RuntimeValue* evaluateAssignmentExpr(AssignmentExpr* assignmentExpr, Scope* scope);
+	RuntimeValue* evaluateUnaryExprNode(UnaryExpr* unaryExpr, Scope* scope); 
+	RuntimeValue* evaluateBinaryExprNode(BinaryExpr* binaryExpr, Scope* scope);
+	// Evaluates an operand of a binary expression, unboxing a number at reads from a numeric
+	// list into the element rather than a new value
+	RuntimeValue* evaluateOperandNode(Expr* operand, Scope* scope, NumValue* element); 
+	// Specializes the expression for the types of its first evaluated operands
+	void specializeBinaryExpr(
+		BinaryExpr* binaryExpr, const RuntimeValue* leftNodeEvaluated, 
+		const RuntimeValue* rightNodeEvaluated
+	); 
+	RuntimeValue* evaluateIdentifier(Identifier* identifier, Scope* scope);
+	RuntimeValue* evaluateFieldAccesser(FieldAccesser* fieldAccesser, Scope* scope); 
+	DishValue* evaluateFieldObject(FieldAccesser* fieldAccesser, Scope* scope, int& slot); 
+	// Finds the slot of the field in an already evaluated object, using the accesser's cache
+	DishValue* resolveFieldSlot(FieldAccesser* fieldAccesser, RuntimeValue* object, int& slot); 
 }
\ No newline at end of file
@@ -1,14 +1,27 @@
-#pragma once
-
-// Dependencies
-#include "../Scope.hpp"
-#include "../../backend/Parser.hpp"
-
-namespace ns {
-	RuntimeValue* evaluateProgramNode(Program* program, Scope* scope);
-	RuntimeValue* evaluateVarDeclarationNode(VarDeclaration* varDeclaration, Scope* scope);
-	RuntimeValue* evaluateFuncDeclaration(FuncDeclaration* funcDeclaration, Scope* scope); 
-	RuntimeValue* evaluateIfStatementNode(IfStatement* ifStatement, Scope* scope); 
-	RuntimeValue* evaluateWhileStatementNode(WhileStatement* whileStatement, Scope* scope); 
-	RuntimeValue* evaluateASTNode(Statement* astNode, Scope* scope);
+#pragma once
+
+// Dependencies
+#include "../Scope.hpp"
+#include "../../backend/Parser.hpp"
+
+namespace ns {
+	// Set by break, continue and return statements once they're evaluated, so the statement 
+	// lists enclosing them stop until the loop or recipe they leave is reached, which clears it
+	enum class ControlTransfer { None, Break, Continue, Return }; 
+	extern ControlTransfer pendingTransfer; 
+
+	RuntimeValue* evaluateProgramNode(Program* program, Scope* scope);
+	RuntimeValue* evaluateVarDeclarationNode(VarDeclaration* varDeclaration, Scope* scope);
+	RuntimeValue* evaluateFuncDeclaration(FuncDeclaration* funcDeclaration, Scope* scope); 
+	RuntimeValue* evaluateDishDeclaration(DishDeclaration* dishDeclaration, Scope* scope); 
+	RuntimeValue* evaluateIfStatementNode(IfStatement* ifStatement, Scope* scope); 
+	RuntimeValue* evaluateWhileStatementNode(WhileStatement* whileStatement, Scope* scope); 
+	RuntimeValue* evaluateForStatementNode(ForStatement* forStatement, Scope* scope); 
+	RuntimeValue* evaluateReturnStatement(ReturnStatement* returnStatement, Scope* scope); 
+	// Evaluates the statements in order, returning the value of the last one evaluated, which
+	// is null if there are none. Stops once a control transfer is pending.
+	RuntimeValue* evaluateStatements(const std::vector<Statement*>& statements, Scope* scope); 
+	RuntimeValue* evaluateASTNode(Statement* astNode, Scope* scope);
+	// Whether any of the statements, or those nested in them, declare a noodle, recipe or dish
+	bool declaresNoodles(const std::vector<Statement*>& statements); 
 }
\ No newline at end of file
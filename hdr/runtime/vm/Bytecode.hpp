@@ -0,0 +1,169 @@
+#pragma once
+
+// Dependencies
+#include "../Values.hpp"
+
+namespace ns {
+	// Every chunk has its own registers, which are its noodles followed by its constants and
+	// then its temporaries. A noodle's register holds the value of the variable it names, which
+	// is looked up the first time it's used. Constant registers are never written to.
+	enum class OpCode {
+		// R(a) = R(b)
+		Move,
+		// R(a) = a copy of R(b)
+		Clone,
+		LoadNull,
+		// Declares noodle a with R(b), which is frozen if c is set
+		DeclareVariable,
+		// R(a) = a copy of R(c), which is assigned to noodle b
+		AssignVariable,
+		// Sets noodle a to R(b) wherever it's declared, or declares it if it isn't, for the
+		// parameters of inlined recipes
+		BindVariable,
+		// Declares recipes[b], named by noodle c, and sets R(a) to its recipe value
+		DeclareRecipe,
+		// R(a) = nodes[b] evaluated by the tree walker. If c is set, the node may declare
+		// noodles, so they're all looked up again.
+		Evaluate,
+		// R(a) = the operation applied to R(b)
+		Negate,
+		Increment,
+		Decrement,
+		Not,
+		// R(a) = the operation applied to R(b) and R(c)
+		Add,
+		Subtract,
+		Multiply,
+		Divide,
+		Modulo,
+		Power,
+		Equal,
+		NotEqual,
+		Greater,
+		Less,
+		GreaterEqual,
+		LessEqual,
+		And,
+		Or,
+		// R(a) = a list of the c registers starting at R(b)
+		MakeList,
+		// R(a) = the field of the dish in R(b) accessed by nodes[c]
+		GetField,
+		// R(c) = R(b), the recipe called by nodes[e]. Recipes called with more or fewer
+		// arguments than they have parameters are instead called by the tree walker, which
+		// only evaluates the arguments they take, setting R(a) and jumping to d.
+		LoadCallee,
+		// R(a) = R(c) called with the registers after it, for the call in nodes[b]
+		Call,
+		// Call whose result is returned right away, so the callee replaces the chunk's frame
+		TailCall,
+		// R(a) = the native named by noodle c called by nodes[b], which evaluates its own
+		// arguments
+		CallNative,
+		// Jumps to a
+		Jump,
+		// Jumps to c if R(a) is false, or to d if it isn't a bool
+		JumpIfFalse,
+		// Superinstructions fused from common loop idioms, which skip boxing numbers
+		// Jumps to c unless R(a) compared with R(b) is true, or to d if the comparison isn't
+		// between numbers and doesn't result in a bool
+		JumpUnlessEqual,
+		JumpUnlessNotEqual,
+		JumpUnlessGreater,
+		JumpUnlessLess,
+		JumpUnlessGreaterEqual,
+		JumpUnlessLessEqual,
+		// R(a) = noodle b after it's updated in place
+		IncrementVariable,
+		DecrementVariable,
+		// R(a) = element R(c) of the list in R(b), for the call to the native named by noodle e
+		// in nodes[d]
+		LoadElement,
+		// Sets element R(b) of the list in noodle a to R(c), for the call to the native named by
+		// noodle e in nodes[d]
+		StoreElement,
+		// For loops keep their state in the registers from R(a), and their noodle is noodle b,
+		// which is declared, or assigned if the chunk's scope already declares it
+		// Checks that R(a), R(a + 1) and R(a + 2) are numbers, and replaces them with copies the
+		// loop counts with, then declares noodle b with a copy of R(a)
+		PrepareRange,
+		// Jumps to c once R(a) has passed R(a + 1). Otherwise assigns it to noodle b, in place
+		// while the noodle still holds the number assigned last, and adds R(a + 2) to it.
+		NextInRange,
+		// Checks that R(a) is a list, and sets R(a + 1) to the first index and noodle b to null
+		PrepareElements,
+		// Jumps to c once R(a + 1) reaches the size of the list in R(a). Otherwise assigns the
+		// element at it to noodle b, and moves on to the next.
+		NextElement,
+		// Throws, as the condition of a while loop wasn't a bool
+		FailLoopCondition,
+		// Returns R(a) from the chunk
+		Return,
+		End
+	};
+
+	extern const char* opCodeNames[];
+	// Operator of each op code from Negate to Or
+	extern const char* operationNames[];
+	// Which of a, b and c are registers for each op code, as bit flags
+	extern const int registerOperands[];
+
+	struct Instruction {
+		OpCode opCode;
+		int a;
+		int b;
+		int c;
+		int d;
+		int e;
+		// Address of the code handling the op code, which is set the first time the chunk runs
+		// when instructions are direct threaded
+		mutable const void* handler;
+	};
+	struct Chunk;
+	struct NativeCode;
+
+	// Recipe declared by a chunk, with its body compiled into its own chunk
+	struct CompiledRecipe {
+		FuncDeclaration* funcDeclaration;
+		const Chunk* chunk;
+	};
+	struct Chunk {
+		std::vector<Instruction> instructions;
+		// Every noodle name referenced by the chunk, which are its first registers
+		std::vector<std::string> names;
+		std::vector<RuntimeValue*> constants;
+		int temporaryCount;
+		std::vector<Statement*> nodes;
+		std::vector<CompiledRecipe> recipes;
+		mutable bool threaded;
+		// Chunks count their calls and loop iterations until they're hot, and are then compiled
+		// to native code if they only work on numbers. Otherwise they're interpreted for good.
+		enum class Tier {
+			Counting, Native, Interpreted
+		};
+		mutable Tier tier;
+		mutable int hotness;
+		mutable NativeCode* nativeCode;
+
+		Chunk();
+
+		int firstConstant() const;
+		int firstTemporary() const;
+		int registerCount() const;
+	};
+
+	inline bool isBinaryOperation(OpCode opCode) {
+		return opCode >= OpCode::Add && opCode <= OpCode::Or;
+	}
+	inline BinaryOperation toBinaryOperation(OpCode opCode) {
+		return opCode >= OpCode::JumpUnlessEqual
+			? static_cast<BinaryOperation>(static_cast<int>(opCode)
+				- static_cast<int>(OpCode::JumpUnlessEqual)
+					+ static_cast<int>(BinaryOperation::Equal))
+			: static_cast<BinaryOperation>(
+				static_cast<int>(opCode) - static_cast<int>(OpCode::Add)
+			);
+	}
+
+	std::ostream& operator<<(std::ostream& ostream, const Chunk* chunk);
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+
+// Dependencies
+#include <unordered_map>
+
+#include "Bytecode.hpp"
+
+namespace ns {
+	// Compiles statements into a chunk, where every statement is evaluated into a register
+	// holding the value the tree walker would evaluate it to
+	class Compiler {
+	public:
+		Compiler(bool shouldUseSuperinstructions = true, bool shouldUseJit = true);
+
+		Chunk* compileProgram(Program* program);
+		Chunk* compileRecipe(FuncDeclaration* funcDeclaration);
+	private:
+		Chunk* chunk;
+		std::unordered_map<std::string, int> nameSlots;
+		// Temporaries are allocated like a stack, and freed once the expression using them is
+		// compiled
+		int nextTemporary;
+		// Temporaries holding expressions that are evaluated once and then read again, which are
+		// the invariants of the loops being compiled and the common expressions of the lists of
+		// statements being compiled. They're kept until the loop or list ends.
+		std::unordered_map<const Statement*, int> reusedRegisters;
+		// Temporaries reserved for common expressions that weren't evaluated yet
+		std::unordered_map<const Statement*, int> commonRegisters;
+		// Loops being compiled, innermost last. Their break and continue statements jump to
+		// their end and their condition, which are only known once the loop is compiled.
+		struct Loop {
+			int target;
+			std::vector<int> breakJumps;
+			std::vector<int> continueJumps;
+		};
+		std::vector<Loop> loops;
+		// When set, common loop idioms are fused into superinstructions
+		bool shouldUseSuperinstructions;
+		// When unset, hot chunks aren't compiled to native code
+		bool shouldUseJit;
+
+		// Until the chunk is finished, constants and temporaries are numbered from these
+		// offsets, as the number of noodles isn't known yet
+		static const int constantOffset = 1 << 20;
+		static const int temporaryOffset = 1 << 21;
+		// Target of statements whose value is never used
+		static const int discarded = -2;
+
+		Chunk* compileChunk(const std::vector<Statement*>& statements);
+		// Evaluates the statements into the given register, which holds the value of the last.
+		// Expressions they have in common are evaluated once, into their own temporaries.
+		void compileStatements(const std::vector<Statement*>& statements, int target);
+		// Returns the register the statement is evaluated into, which is the target if one is
+		// given. Otherwise it may be a noodle or constant register.
+		int compileStatement(Statement* statement, int target = -1);
+		void compileIfStatement(IfStatement* ifStatement, int target);
+		// Loops with invariant expressions check their condition once before evaluating them,
+		// and then at the end of each iteration
+		void compileWhileStatement(WhileStatement* whileStatement, int target);
+		// Each iteration starts by moving the loop on, which is also where continue statements
+		// jump to
+		void compileForStatement(ForStatement* forStatement, int target);
+		// Sets the value of the innermost loop to null, and jumps to its end or condition
+		int compileLoopControlStatement(Statement* statement);
+		// Points the innermost loop's break statements at the next instruction emitted, and its
+		// continue statements at its condition, then leaves it
+		void finishLoop(int conditionIndex);
+		// Returns the jump taken when the condition is false, whose targets are left to be set
+		int compileConditionJump(Expr* condition);
+		int compileFuncCall(FuncCall* funcCall, int target);
+		// Compiles calls to at and set into indexed loads and stores, returning -1 if the call
+		// doesn't fit
+		int compileElementAccess(FuncCall* funcCall, int target);
+		// Binds the inlined recipe's parameters in the chunk's scope, then compiles its body
+		// in place of the call
+		int compileInlinedCall(InlinedCall* inlinedCall, int target);
+
+		int emit(OpCode opCode, int a = 0, int b = 0, int c = 0, int d = 0, int e = 0);
+		int emitEvaluate(Statement* node, int target, bool declares = false);
+		// Copies the value of a register into another, giving constants their own copy as values
+		// can be modified in place
+		void emitCopy(int target, int source);
+		int findNameSlot(const std::string& name);
+		int addConstant(RuntimeValue* constant);
+		int addNode(Statement* node);
+		int allocateTemporary();
+		int allocateTemporaries(int count);
+		// Returns the target if one is given, or a new temporary otherwise
+		int resolveTarget(int target);
+		// Points the jump at the given instruction to the next instruction emitted
+		void patchJump(int jumpIndex);
+		int nextInstructionIndex() const;
+		// Renumbers constants and temporaries to follow the chunk's noodles
+		void relocateRegisters();
+		// Turns calls whose result is returned right away into tail calls
+		void markTailCalls();
+
+		static bool isNameRegister(int index);
+		static bool isConstantRegister(int index);
+		// Whether evaluating the statement could assign to a noodle, so that noodles read
+		// before it need their values kept in a temporary
+		static bool mayAssignVariables(const Statement* statement);
+		// Whether the statement can be evaluated again without changing anything, so that
+		// superinstructions can fall back to the tree walker
+		static bool isPure(const Statement* statement);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+// Dependencies
+#include <exception>
+
+#include "Bytecode.hpp"
+#include "../Scope.hpp"
+
+namespace ns {
+	// Registers of a running chunk, which native code shares with the interpreter so that either
+	// can continue where the other stopped
+	struct NativeFrame {
+		const Chunk* chunk;
+		Scope* scope;
+		RuntimeValue*** registers;
+		Scope::Variable** variables;
+		// Number native code last assigned to each noodle, which it updates in place as long as
+		// nothing else refers to it
+		RuntimeValue** ownedValues;
+		// Value the chunk returned, once native code reaches its Return
+		RuntimeValue* result;
+		// Error thrown while native code ran, which is rethrown once it's left
+		std::exception_ptr exception;
+	};
+	// x86-64 code compiled from a chunk, which is entered at its first instruction or where a
+	// loop jumps back to
+	struct NativeCode {
+		void* memory;
+		size_t size;
+		// Offset of the code for each instruction. Where native code is entered, it first
+		// checks that the registers it inferred to hold numbers do.
+		std::vector<size_t> entries;
+		// How many times a type guard failed, and the interpreter took over
+		int deoptimizationCount;
+	};
+
+	// Returned by native code once the chunk returns or throws. Otherwise native code returns
+	// the instruction the interpreter resumes at, after a type guard or entry check failed.
+	const int nativeReturned = -1;
+	const int nativeThrew = -2;
+	// Calls and loop iterations before a chunk is compiled to native code
+	const int hotChunkThreshold = 1000;
+	// Guard failures before native code is thrown away, and the chunk is only interpreted
+	const int deoptimizationLimit = 10;
+
+	// Returns null if the chunk doesn't only work on numbers, or if native code isn't supported
+	// on this platform
+	NativeCode* compileNativeCode(const Chunk* chunk);
+	void freeNativeCode(NativeCode* nativeCode);
+	int runNativeCode(const NativeCode* nativeCode, NativeFrame* frame, int instructionIndex);
+}
\ No newline at end of file
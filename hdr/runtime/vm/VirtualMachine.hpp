@@ -0,0 +1,16 @@
+#pragma once
+
+// Dependencies
+#include "Jit.hpp"
+#include "../eval/Expressions.hpp"
+
+namespace ns {
+	// Runs the chunk in the given scope, and returns the value of its last statement
+	RuntimeValue* executeChunk(const Chunk* chunk, Scope* scope);
+	// Calls a recipe or dish with arguments that were already evaluated
+	RuntimeValue* callRecipe(
+		RuntimeValue* callee, RuntimeValue* const* arguments, FuncCall* funcCall, Scope* scope
+	);
+	// Calls a native that evaluates its own arguments, or the recipe shadowing it
+	RuntimeValue* callNative(RuntimeValue* callee, FuncCall* funcCall, Scope* scope);
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+// Dependencies
+#include <cstdint>
+
+namespace ns {
+	// Each returns false instead of storing the result if the operation would overflow
+
+	inline bool checkedAdd(int64_t left, int64_t right, int64_t& result) {
+		if (right > 0 ? left > INT64_MAX - right : left < INT64_MIN - right)
+			return false; 
+
+		result = left + right; 
+		return true; 
+	}
+	inline bool checkedSubtract(int64_t left, int64_t right, int64_t& result) {
+		if (right < 0 ? left > INT64_MAX + right : left < INT64_MIN + right)
+			return false; 
+
+		result = left - right; 
+		return true; 
+	}
+	inline bool checkedMultiply(int64_t left, int64_t right, int64_t& result) {
+		if (left != 0 && right != 0) {
+			const bool overflow = left > 0
+				? (right > 0 ? left > INT64_MAX / right : right < INT64_MIN / left)
+				: (right > 0 ? left < INT64_MIN / right : right < INT64_MAX / left); 
+
+			if (overflow)
+				return false; 
+		}
+
+		result = left * right; 
+		return true; 
+	}
+	// Matches the remainder of doubles, which is zero for a denominator of zero
+	inline int64_t integerRemainder(int64_t left, int64_t right) {
+		return right == 0 || right == -1 ? 0 : left % right; 
+	}
+}
\ No newline at end of file
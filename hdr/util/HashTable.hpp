@@ -0,0 +1,222 @@
+#pragma once
+
+// Dependencies
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NS_HASH_TABLE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace ns {
+	// Open addressing hash table, where each slot has a control byte holding 7 bits of its 
+	// key's hash. Slots are probed in groups of 16, so a single SSE2 comparison finds every slot
+	// in a group whose tag matches, and keys are only compared once their tags already match.
+	template <typename Key, typename Value, typename Hash, typename Equal>
+	class HashTable {
+	public:
+		HashTable() :
+			count(0),
+			deletedCount(0)
+		{
+		}
+
+		size_t size() const {
+			return count; 
+		}
+		Value* find(const Key& key) {
+			size_t slot; 
+			return findSlot(key, hashKey(key), slot) ? &values[slot] : nullptr; 
+		}
+		bool contains(const Key& key) const {
+			size_t slot; 
+			return findSlot(key, hashKey(key), slot); 
+		}
+		// Returns whether the key was newly added, otherwise its value is replaced
+		bool insert(const Key& key, const Value& value) {
+			const size_t hash = hashKey(key); 
+			size_t slot; 
+
+			if (findSlot(key, hash, slot)) {
+				values[slot] = value; 
+				return false; 
+			}
+
+			// Keeps the table at most 7/8 full, counting deleted slots as they lengthen probes
+			if ((count + deletedCount + 1) * 8 > controls.size() * 7)
+				rehash(count * 2 < controls.size() / 2 ? controls.size() : controls.size() * 2); 
+
+			insertNew(key, value, hash); 
+			return true; 
+		}
+		bool erase(const Key& key) {
+			size_t slot; 
+
+			if (!findSlot(key, hashKey(key), slot))
+				return false; 
+
+			controls[slot] = deletedControl; 
+			keys[slot] = Key(); 
+			values[slot] = Value(); 
+			count--; 
+			deletedCount++; 
+			return true; 
+		}
+		void reserve(size_t capacity) {
+			size_t slotCount = groupWidth; 
+
+			while (slotCount * 7 < capacity * 8)
+				slotCount *= 2; 
+
+			if (slotCount > controls.size())
+				rehash(slotCount); 
+		}
+		template <typename Callback>
+		void forEach(Callback callback) const {
+			for (size_t slot = 0; slot < controls.size(); slot++) {
+				if (controls[slot] < emptyControl)
+					callback(keys[slot], values[slot]); 
+			}
+		}
+	private:
+		static constexpr int tagBits = 7; 
+		static constexpr size_t tagMask = (static_cast<size_t>(1) << tagBits) - 1; 
+		static constexpr size_t groupWidth = 16; 
+		// Full slots hold a tag below 0x80, so both special controls have the high bit set
+		static constexpr uint8_t emptyControl = 0x80; 
+		static constexpr uint8_t deletedControl = 0xFE; 
+
+		std::vector<uint8_t> controls; 
+		std::vector<Key> keys; 
+		std::vector<Value> values; 
+		size_t count; 
+		size_t deletedCount; 
+
+		static size_t hashKey(const Key& key) {
+			// Mixes the hash, so keys like small integers spread over the whole table
+			uint64_t hash = static_cast<uint64_t>(Hash()(key)); 
+
+			hash ^= hash >> 33; 
+			hash *= 0xFF51AFD7ED558CCDull; 
+			hash ^= hash >> 33; 
+			hash *= 0xC4CEB9FE1A85EC53ull; 
+			hash ^= hash >> 33; 
+			return static_cast<size_t>(hash); 
+		}
+		// Returns a bitmask of the slots in the group whose control byte equals the given byte
+		static uint32_t matchControls(const uint8_t* group, uint8_t control) {
+#ifdef NS_HASH_TABLE_SSE2
+			const __m128i groupControls = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group)); 
+			const __m128i matches = _mm_cmpeq_epi8(
+				groupControls, _mm_set1_epi8(static_cast<char>(control))
+			); 
+			return static_cast<uint32_t>(_mm_movemask_epi8(matches)); 
+#else
+			uint32_t mask = 0; 
+
+			for (size_t slot = 0; slot < groupWidth; slot++) {
+				if (group[slot] == control)
+					mask |= static_cast<uint32_t>(1) << slot; 
+			}
+
+			return mask; 
+#endif
+		}
+		// Returns a bitmask of the empty or deleted slots in the group
+		static uint32_t matchFreeControls(const uint8_t* group) {
+#ifdef NS_HASH_TABLE_SSE2
+			const __m128i groupControls = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group)); 
+			return static_cast<uint32_t>(_mm_movemask_epi8(groupControls)); 
+#else
+			uint32_t mask = 0; 
+
+			for (size_t slot = 0; slot < groupWidth; slot++) {
+				if (group[slot] >= emptyControl)
+					mask |= static_cast<uint32_t>(1) << slot; 
+			}
+
+			return mask; 
+#endif
+		}
+		static int lowestSetBit(uint32_t mask) {
+#if defined(_MSC_VER)
+			unsigned long bit; 
+			_BitScanForward(&bit, mask); 
+			return static_cast<int>(bit); 
+#else
+			return __builtin_ctz(mask); 
+#endif
+		}
+		bool findSlot(const Key& key, size_t hash, size_t& slot) const {
+			if (controls.empty())
+				return false; 
+
+			const uint8_t tag = static_cast<uint8_t>(hash & tagMask); 
+			const size_t groupMask = controls.size() / groupWidth - 1; 
+
+			for (size_t group = (hash >> tagBits) & groupMask; ; group = (group + 1) & groupMask) {
+				const uint8_t* groupControls = controls.data() + group * groupWidth; 
+
+				for (uint32_t matches = matchControls(groupControls, tag); matches != 0; 
+					matches &= matches - 1) 
+				{
+					slot = group * groupWidth + lowestSetBit(matches); 
+
+					if (Equal()(keys[slot], key))
+						return true; 
+				}
+
+				// An empty slot ends the probe sequence, while deleted slots are skipped over
+				if (matchControls(groupControls, emptyControl) != 0)
+					return false; 
+			}
+		}
+		void insertNew(const Key& key, const Value& value, size_t hash) {
+			const size_t groupMask = controls.size() / groupWidth - 1; 
+			size_t group = (hash >> tagBits) & groupMask; 
+			uint32_t freeSlots = matchFreeControls(controls.data() + group * groupWidth); 
+
+			// Reuses the first empty or deleted slot along the probe sequence
+			while (freeSlots == 0) {
+				group = (group + 1) & groupMask; 
+				freeSlots = matchFreeControls(controls.data() + group * groupWidth); 
+			}
+
+			const size_t slot = group * groupWidth + lowestSetBit(freeSlots); 
+
+			if (controls[slot] == deletedControl)
+				deletedCount--; 
+
+			controls[slot] = static_cast<uint8_t>(hash & tagMask); 
+			keys[slot] = key; 
+			values[slot] = value; 
+			count++; 
+		}
+		void rehash(size_t capacity) {
+			const std::vector<uint8_t> oldControls = std::move(controls); 
+			const std::vector<Key> oldKeys = std::move(keys); 
+			const std::vector<Value> oldValues = std::move(values); 
+
+			if (capacity < groupWidth)
+				capacity = groupWidth; 
+
+			controls.assign(capacity, emptyControl); 
+			keys.assign(capacity, Key()); 
+			values.assign(capacity, Value()); 
+			count = 0; 
+			deletedCount = 0; 
+
+			// Keys are already known to be unique, so they're placed without being looked up
+			for (size_t slot = 0; slot < oldControls.size(); slot++) {
+				if (oldControls[slot] < emptyControl)
+					insertNew(oldKeys[slot], oldValues[slot], hashKey(oldKeys[slot])); 
+			}
+		}
+	};
+}
\ No newline at end of file
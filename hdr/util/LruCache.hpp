@@ -0,0 +1,53 @@
+#pragma once
+
+// Dependencies
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace ns {
+	// Map holding at most a fixed number of entries, which evicts the one used least recently
+	// to make room for a new one. Entries are kept in a list ordered from most to least recently
+	// used, which the map indexes into, so finding, inserting and evicting are all O(1).
+	template <typename Key, typename Value, size_t capacity, typename Hash = std::hash<Key>>
+	class LruCache {
+	public:
+		size_t size() const {
+			return entries.size(); 
+		}
+		// Marks the entry as the most recently used
+		Value* find(const Key& key) {
+			auto index = indices.find(key); 
+
+			if (index == indices.end())
+				return nullptr; 
+
+			entries.splice(entries.begin(), entries, index->second); 
+			return &index->second->second; 
+		}
+		void insert(const Key& key, const Value& value) {
+			auto index = indices.find(key); 
+
+			if (index != indices.end()) {
+				index->second->second = value; 
+				entries.splice(entries.begin(), entries, index->second); 
+				return; 
+			}
+
+			if (entries.size() == capacity) {
+				indices.erase(entries.back().first); 
+				entries.pop_back(); 
+			}
+
+			entries.emplace_front(key, value); 
+			indices[key] = entries.begin(); 
+		}
+	private:
+		using Entry = std::pair<Key, Value>; 
+
+		std::list<Entry> entries; 
+		std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> indices; 
+	}; 
+}
\ No newline at end of file
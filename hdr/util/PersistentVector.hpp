@@ -0,0 +1,243 @@
+#pragma once
+
+// Dependencies
+#include <cstddef>
+
+#include "Memory.hpp"
+
+namespace ns {
+	// A 32-way trie with a separate tail leaf, where snapshots share all of their nodes. Nodes
+	// are tagged with the edit they were created by, so a vector keeps updating its own nodes in
+	// place and only copies the path to a node that is shared with a snapshot.
+	template <typename Type>
+	class PersistentVector {
+	public:
+		PersistentVector() :
+			root(nullptr),
+			tail(nullptr),
+			count(0),
+			shift(bitsPerLevel),
+			edit(createEdit())
+		{
+		}
+
+		size_t size() const {
+			return count; 
+		}
+		const Type& at(size_t index) const {
+			return leafFor(index)->values[index & levelMask]; 
+		}
+		void set(size_t index, const Type& value) {
+			// Updates inside of the tail don't touch the trie
+			if (index >= tailOffset()) {
+				tail = editableLeaf(tail); 
+				tail->values[index & levelMask] = value; 
+				return; 
+			}
+
+			root = editableBranch(root); 
+			Branch* branch = root; 
+
+			// Copies each branch on the path to the leaf that isn't owned by this vector
+			for (int level = shift; level > bitsPerLevel; level -= bitsPerLevel) {
+				void*& child = branch->children[(index >> level) & levelMask]; 
+				child = editableBranch(static_cast<Branch*>(child)); 
+				branch = static_cast<Branch*>(child); 
+			}
+
+			void*& leafChild = branch->children[(index >> bitsPerLevel) & levelMask]; 
+			Leaf* leaf = editableLeaf(static_cast<Leaf*>(leafChild)); 
+
+			leafChild = leaf; 
+			leaf->values[index & levelMask] = value; 
+		}
+		void pushBack(const Type& value) {
+			if (tail == nullptr)
+				tail = createLeaf(); 
+
+			// Room is left in the tail
+			if (count - tailOffset() < levelWidth) {
+				tail = editableLeaf(tail); 
+				tail->values[count - tailOffset()] = value; 
+				count++; 
+				return; 
+			}
+
+			// Otherwise, the full tail is moved into the trie
+			if (root == nullptr)
+				root = createBranch(); 
+
+			// Adds a level to the trie when the root has no room left
+			if ((count >> bitsPerLevel) > (static_cast<size_t>(1) << shift)) {
+				Branch* newRoot = createBranch(); 
+
+				newRoot->children[0] = root; 
+				newRoot->children[1] = createPath(shift, tail); 
+				root = newRoot; 
+				shift += bitsPerLevel; 
+			}
+			else
+				root = pushTail(shift, root, tail); 
+
+			tail = createLeaf(); 
+			tail->values[0] = value; 
+			count++; 
+		}
+		void popBack() {
+			if (count <= 1) {
+				root = nullptr; 
+				tail = nullptr; 
+				count = 0; 
+				shift = bitsPerLevel; 
+				return; 
+			}
+
+			// Elements remain in the tail
+			if (count - tailOffset() > 1) {
+				count--; 
+				return; 
+			}
+
+			// Otherwise, the last leaf of the trie becomes the new tail
+			Leaf* newTail = leafFor(count - 2); 
+			Branch* newRoot = popTail(shift, root); 
+			int newShift = shift; 
+
+			// Removes a level from the trie when the root only has one child left
+			if (newRoot != nullptr && shift > bitsPerLevel && newRoot->children[1] == nullptr) {
+				newRoot = static_cast<Branch*>(newRoot->children[0]); 
+				newShift -= bitsPerLevel; 
+			}
+
+			root = newRoot; 
+			tail = newTail; 
+			shift = newRoot == nullptr ? bitsPerLevel : newShift; 
+			count--; 
+		}
+		PersistentVector snapshot() {
+			PersistentVector copiedVector = *this; 
+
+			// Neither vector owns the shared nodes anymore, so both copy before updating them
+			edit = createEdit(); 
+			copiedVector.edit = createEdit(); 
+			return copiedVector; 
+		}
+	private:
+		static constexpr int bitsPerLevel = 5; 
+		static constexpr size_t levelWidth = static_cast<size_t>(1) << bitsPerLevel; 
+		static constexpr size_t levelMask = levelWidth - 1; 
+
+		struct Branch {
+			unsigned int owner; 
+			void* children[levelWidth]; 
+		}; 
+		struct Leaf {
+			unsigned int owner; 
+			Type values[levelWidth]; 
+		}; 
+
+		Branch* root; 
+		Leaf* tail; 
+		size_t count; 
+		int shift; 
+		unsigned int edit; 
+
+		static unsigned int createEdit() {
+			static unsigned int edits = 0; 
+			return ++edits; 
+		}
+
+		size_t tailOffset() const {
+			return count < levelWidth ? 0 : ((count - 1) >> bitsPerLevel) << bitsPerLevel; 
+		}
+		Leaf* leafFor(size_t index) const {
+			if (index >= tailOffset())
+				return tail; 
+
+			const Branch* branch = root; 
+
+			for (int level = shift; level > bitsPerLevel; level -= bitsPerLevel)
+				branch = static_cast<const Branch*>(branch->children[(index >> level) & levelMask]); 
+
+			return static_cast<Leaf*>(branch->children[(index >> bitsPerLevel) & levelMask]); 
+		}
+		Branch* createBranch() {
+			Branch* branch = globalMemory->create<Branch>(); 
+			branch->owner = edit; 
+			return branch; 
+		}
+		Leaf* createLeaf() {
+			Leaf* leaf = globalMemory->create<Leaf>(); 
+			leaf->owner = edit; 
+			return leaf; 
+		}
+		Branch* editableBranch(Branch* branch) {
+			if (branch->owner == edit)
+				return branch; 
+
+			Branch* copiedBranch = createBranch(); 
+
+			for (size_t childIndex = 0; childIndex < levelWidth; childIndex++)
+				copiedBranch->children[childIndex] = branch->children[childIndex]; 
+
+			return copiedBranch; 
+		}
+		Leaf* editableLeaf(Leaf* leaf) {
+			if (leaf->owner == edit)
+				return leaf; 
+
+			Leaf* copiedLeaf = createLeaf(); 
+
+			for (size_t valueIndex = 0; valueIndex < levelWidth; valueIndex++)
+				copiedLeaf->values[valueIndex] = leaf->values[valueIndex]; 
+
+			return copiedLeaf; 
+		}
+		void* createPath(int level, void* node) {
+			if (level == 0)
+				return node; 
+
+			Branch* branch = createBranch(); 
+			branch->children[0] = createPath(level - bitsPerLevel, node); 
+			return branch; 
+		}
+		Branch* pushTail(int level, Branch* parent, Leaf* tailLeaf) {
+			Branch* branch = editableBranch(parent); 
+			const size_t childIndex = ((count - 1) >> level) & levelMask; 
+
+			if (level == bitsPerLevel)
+				branch->children[childIndex] = tailLeaf; 
+			else {
+				Branch* child = static_cast<Branch*>(parent->children[childIndex]); 
+
+				branch->children[childIndex] = child != nullptr
+					? pushTail(level - bitsPerLevel, child, tailLeaf)
+					: createPath(level - bitsPerLevel, tailLeaf); 
+			}
+
+			return branch; 
+		}
+		Branch* popTail(int level, Branch* parent) {
+			const size_t childIndex = ((count - 2) >> level) & levelMask; 
+
+			if (level > bitsPerLevel) {
+				Branch* child = popTail(
+					level - bitsPerLevel, static_cast<Branch*>(parent->children[childIndex])
+				); 
+
+				if (child == nullptr && childIndex == 0)
+					return nullptr; 
+
+				Branch* branch = editableBranch(parent); 
+				branch->children[childIndex] = child; 
+				return branch; 
+			}
+			else if (childIndex == 0)
+				return nullptr; 
+
+			Branch* branch = editableBranch(parent); 
+			branch->children[childIndex] = nullptr; 
+			return branch; 
+		}
+	}; 
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+#pragma once
+
+// Dependencies
+#include <cstddef>
+#include <vector>
+
+namespace ns {
+	// Double ended queue stored in a power of two sized ring, so elements can be added and 
+	// removed at both ends in amortized O(1) while indexing stays O(1)
+	template <typename Type>
+	class RingBuffer {
+	public:
+		RingBuffer() :
+			head(0),
+			count(0)
+		{
+		}
+
+		size_t size() const {
+			return count; 
+		}
+		Type& operator[](size_t index) {
+			return buffer[(head + index) & (buffer.size() - 1)]; 
+		}
+		const Type& operator[](size_t index) const {
+			return buffer[(head + index) & (buffer.size() - 1)]; 
+		}
+		void pushBack(const Type& value) {
+			if (count == buffer.size())
+				reserve(count * 2); 
+
+			count++; 
+			(*this)[count - 1] = value; 
+		}
+		void pushFront(const Type& value) {
+			if (count == buffer.size())
+				reserve(count * 2); 
+
+			head = (head + buffer.size() - 1) & (buffer.size() - 1); 
+			count++; 
+			(*this)[0] = value; 
+		}
+		void popBack() {
+			count--; 
+		}
+		void popFront() {
+			head = (head + 1) & (buffer.size() - 1); 
+			count--; 
+		}
+		void erase(size_t index) {
+			// Shifts whichever side of the removed element is shorter
+			if (index < count / 2) {
+				for (size_t shiftIndex = index; shiftIndex > 0; shiftIndex--)
+					(*this)[shiftIndex] = (*this)[shiftIndex - 1]; 
+
+				popFront(); 
+			}
+			else {
+				for (size_t shiftIndex = index; shiftIndex + 1 < count; shiftIndex++)
+					(*this)[shiftIndex] = (*this)[shiftIndex + 1]; 
+
+				popBack(); 
+			}
+		}
+		void reserve(size_t capacity) {
+			size_t newCapacity = minCapacity; 
+
+			while (newCapacity < capacity)
+				newCapacity *= 2; 
+
+			if (newCapacity <= buffer.size())
+				return; 
+
+			std::vector<Type> newBuffer(newCapacity); 
+
+			// Unwraps the elements to the start of the new buffer
+			for (size_t index = 0; index < count; index++)
+				newBuffer[index] = (*this)[index]; 
+
+			buffer.swap(newBuffer); 
+			head = 0; 
+		}
+	private:
+		static constexpr size_t minCapacity = 8; 
+
+		std::vector<Type> buffer; 
+		size_t head; 
+		size_t count; 
+	};
+}
\ No newline at end of file
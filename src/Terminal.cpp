@@ -1,196 +1,310 @@
-﻿#include "../hdr/Terminal.hpp"
-
-#include <fstream>
-
-namespace ns {
-	Interpreter interpreter;
-	std::string sourceCode;
-	std::string terminalInput;
-	bool terminalOpen = false;
-	bool insideConsole = false;
-	bool jumpToConsole = false;
-
-	void initNoodleScriptMsg() {
-		std::cout << "\nNoodleScript Terminal - Created by CodeNoodles (2024)\n\n";
-
-		std::cout << " @@@@@@@@@@@@@@@@@@@@@\n";
-		std::cout << " @@@@@@@@@@@@@@@@@@@@@\n"; 
-		std::cout << " @@@@@@@@@@@@@@@@@@@@@\n";
-		std::cout << " @@@@@@@@@@@@@@@@@@@@@\n";
-		std::cout << " @@@@@@@@@@@@@@@@@@@@@\n";
-		std::cout << " @@@@@@@@ @@@ @@@   @@\n";
-		std::cout << " @@@@@@@@  @@ @@  @@@@\n";
-		std::cout << " @@@@@@@@ @ @ @@@  @@@\n";
-		std::cout << " @@@@@@@@ @@  @@@@  @@\n";
-		std::cout << " @@@@@@@@ @@@ @@   @@@\n";
-		std::cout << " @@@@@@@@@@@@@@@@@@@@@\n\n";
-
-		std::cout << "type `help` to view a list of commands.\n\n";
-	}
-	void initTerminalMsg() {
-		std::cout << "\nNoodleScript Terminal\n\n";
-		insideConsole = false;
-	}
-	void initConsoleMsg() {
-		std::cout << "\nNoodleScript Console\n\n";
-		insideConsole = true;
-	}
-
-	void prepareTerminalMsg() {
-		std::cout << "> ";
-	}
-	void prepareConsoleMsg() {
-		if (!jumpToConsole)
-			std::cout << ">>> ";
-	}
-
-	void executeTerminal(const std::string& input) {
-		const std::vector<std::string> words = extractWords(input);
-		const int wordCount = words.size();
-
-		if (wordCount == 0)
-			return;
-
-		if (words[0] == "help") {
-			std::cout << "\nHere are a list of commands:\n\n"
-				" console -> Enters a console where code can be written\n"
-				" terminal -> Reenters the terminal\n"
-				" run [string] -> Runs a .ns script, if the file path is given\n"
-				" set -> Allows for the modification of enviroment variables\n"
-				"     logTokens [true | false] -> Specifies whether lexed tokens should be outputed\n"
-				"     logAST [true | false] -> Specifies whether to output the AST\n"
-				"     logRuntimeValue [true | false] -> Specifies whether to ouput the program value\n"
-				" show -> Shows the state of certain enviroment variables\n"
-				"     logTokens -> Shows whether lexed tokens should be outputed\n"
-				"     logAST -> Shows whether to output the AST\n"
-				"     logRuntimeValue -> Shows whether to ouput the program value\n"
-				"     globalMemorySize -> Shows how many runtime values are currently allocated\n"
-				" clear -> Clears the terminal\n"
-				" exit -> Closes the terminal\n\n";
-		}
-		else if (words[0] == "console")
-			initConsoleMsg();
-		else if (words[0] == "run") {
-			if (wordCount < 2)
-				return;
-
-			runSourceFile(words[1]); 
-		}
-		else if (words[0] == "set") {
-			if (wordCount < 3)
-				return;
-
-			const bool condition = words[2] == "true";
-
-			if (words[1] == "logTokens")
-				interpreter.enableTokenLogging(condition);
-			else if (words[1] == "logAST")
-				interpreter.enableASTLogging(condition);
-			else if (words[1] == "logRuntimeValue")
-				interpreter.enableRuntimeValueLogging(condition);
-		}
-		else if (words[0] == "show") {
-			auto showEnviromentVariable = [](const std::string& variableName,
-				const std::string& value) -> void
-			{
-				std::cout << " Enviroment variable `" << variableName << "` is currently set to " 
-					<< value << "\n"; 
-			};
-
-			if (wordCount < 2)
-				return; 
-
-			if (words[1] == "logTokens")
-				showEnviromentVariable(
-					"shouldLogTokens", interpreter.isTokenLoggingEnabled() ? "true" : "false"
-				); 
-			else if (words[1] == "logAST")
-				showEnviromentVariable(
-					"shouldLogAST", interpreter.isASTLoggingEnabled() ? "true" : "false"
-				);
-			else if (words[1] == "logRuntimeValue")
-				showEnviromentVariable(
-					"shouldLogRuntimeValue", interpreter.isRuntimeValueLoggingEnabled() 
-						? "true" : "false"
-				);
-			else if (words[1] == "globalMemorySize") {
-				const int allocatedRuntimeValues = globalMemory->getPointerCount();
-				std::cout << " Currently, there are " << allocatedRuntimeValues
-					<< " runtimeValues allocated\n"; 
-			}
-		}
-		else if (words[0] == "clear") {
-			// Clears terminal in Windows
-			system("cls");
-			initNoodleScriptMsg();
-		}
-	}
-	void executeConsole(const std::string& input) {
-		if (input == "terminal") {
-			initTerminalMsg();
-			return;
-		}
-
-		if (sourceCode == "")
-			sourceCode = input;
-
-		interpreter.generateProgram(sourceCode);
-		interpreter.runProgram();
-
-		sourceCode = "";
-		jumpToConsole = false;
-	}
-
-	void initTerminal(int argc, const char** argv) {
-		terminalOpen = true;
-
-		// Attempts running a source file if an extra parameter is passed into the command prompt
-		if (argc == 2) {
-			const std::string filepath = argv[1];
-			runSourceFile(filepath); 
-		}
-		else 
-			initNoodleScriptMsg();
-	}
-	bool isTerminalOpen() {
-		return terminalOpen; 
-	}
-	void runSourceFile(const std::string& filepath) {
-		insideConsole = true;
-
-		std::ifstream sourceFile(filepath);
-		std::string line;
-
-		while (std::getline(sourceFile, line)) {
-			if (line.empty())
-				continue;
-
-			// Adds \n to ensure an EOL token is lexed
-			sourceCode += line + " \n";
-		}
-
-		sourceFile.close();
-		initConsoleMsg();
-		jumpToConsole = true;
-	}
-	void updateTerminal() {
-		if (insideConsole) prepareConsoleMsg();
-		else prepareTerminalMsg();
-
-		// Skips input handling when a script is ready to be run
-		if (!jumpToConsole) {
-			std::getline(std::cin, terminalInput);
-
-			// Exits terminal when `exit` is typed
-			if (terminalInput == "exit") {
-				terminalOpen = false;
-				return; 
-			}
-		}
-
-		if (insideConsole) executeConsole(terminalInput);
-		else executeTerminal(terminalInput);
-	}
-	void closeTerminal() {
-	}
+﻿#include "../hdr/Terminal.hpp"
+
+#include <cstdlib>
+#include <fstream>
+
+namespace ns {
+	Interpreter interpreter;
+	std::string sourceCode;
+	std::string terminalInput;
+	bool terminalOpen = false;
+	bool insideConsole = false;
+	bool jumpToConsole = false;
+
+	void initNoodleScriptMsg() {
+		std::cout << "\nNoodleScript Terminal - Created by CodeNoodles (2024)\n\n";
+
+		std::cout << " @@@@@@@@@@@@@@@@@@@@@\n";
+		std::cout << " @@@@@@@@@@@@@@@@@@@@@\n"; 
+		std::cout << " @@@@@@@@@@@@@@@@@@@@@\n";
+		std::cout << " @@@@@@@@@@@@@@@@@@@@@\n";
+		std::cout << " @@@@@@@@@@@@@@@@@@@@@\n";
+		std::cout << " @@@@@@@@ @@@ @@@   @@\n";
+		std::cout << " @@@@@@@@  @@ @@  @@@@\n";
+		std::cout << " @@@@@@@@ @ @ @@@  @@@\n";
+		std::cout << " @@@@@@@@ @@  @@@@  @@\n";
+		std::cout << " @@@@@@@@ @@@ @@   @@@\n";
+		std::cout << " @@@@@@@@@@@@@@@@@@@@@\n\n";
+
+		std::cout << "type `help` to view a list of commands.\n\n";
+	}
+	void initTerminalMsg() {
+		std::cout << "\nNoodleScript Terminal\n\n";
+		insideConsole = false;
+	}
+	void initConsoleMsg() {
+		std::cout << "\nNoodleScript Console\n\n";
+		insideConsole = true;
+	}
+
+	void prepareTerminalMsg() {
+		std::cout << "> ";
+	}
+	void prepareConsoleMsg() {
+		if (!jumpToConsole)
+			std::cout << ">>> ";
+	}
+
+	void executeTerminal(const std::string& input) {
+		const std::vector<std::string> words = extractWords(input);
+		const int wordCount = words.size();
+
+		if (wordCount == 0)
+			return;
+
+		if (words[0] == "help") {
+			std::cout << "\nHere are a list of commands:\n\n"
+				" console -> Enters a console where code can be written\n"
+				" terminal -> Reenters the terminal\n"
+				" run [string] -> Runs a .ns script, if the file path is given\n"
+				" compile [string] [string] -> Compiles a .ns script into an executable at the\n"
+				"     second file path, by transpiling it to C++\n"
+				" set -> Allows for the modification of enviroment variables\n"
+				"     logTokens [true | false] -> Specifies whether lexed tokens should be outputed\n"
+				"     logAST [true | false] -> Specifies whether to output the AST\n"
+				"     logRuntimeValue [true | false] -> Specifies whether to ouput the program value\n"
+				"     useBytecode [true | false] -> Specifies whether to compile programs to bytecode,\n"
+				"         rather than walking the AST\n"
+				"     logBytecode [true | false] -> Specifies whether to output the compiled bytecode\n"
+				"     useSuperinstructions [true | false] -> Specifies whether to fuse common loop\n"
+				"         idioms into superinstructions\n"
+				"     useJit [true | false] -> Specifies whether to compile hot recipes working on\n"
+				"         numbers to native code\n"
+				"     useInlining [true | false] -> Specifies whether to inline small recipes where\n"
+				"         they're called\n"
+				"     useHoisting [true | false] -> Specifies whether to evaluate expressions that\n"
+				"         don't change in a loop once before it\n"
+				"     useSimplification [true | false] -> Specifies whether to evaluate repeated\n"
+				"         expressions once and reduce expressions to cheaper ones\n"
+				"     usePruning [true | false] -> Specifies whether to remove recipes that are\n"
+				"         never called and branches that are never taken\n"
+				"     callDepthLimit [number] -> Specifies how deeply recipe calls can be nested\n"
+				" show -> Shows the state of certain enviroment variables\n"
+				"     logTokens -> Shows whether lexed tokens should be outputed\n"
+				"     logAST -> Shows whether to output the AST\n"
+				"     logRuntimeValue -> Shows whether to ouput the program value\n"
+				"     useBytecode -> Shows whether programs are compiled to bytecode\n"
+				"     logBytecode -> Shows whether to output the compiled bytecode\n"
+				"     useSuperinstructions -> Shows whether loop idioms are fused into\n"
+				"         superinstructions\n"
+				"     useJit -> Shows whether hot recipes are compiled to native code\n"
+				"     useInlining -> Shows whether small recipes are inlined where they're called\n"
+				"     useHoisting -> Shows whether loop invariant expressions are hoisted\n"
+				"     useSimplification -> Shows whether repeated expressions are evaluated once and\n"
+				"         expressions are reduced to cheaper ones\n"
+				"     usePruning -> Shows whether unused recipes and branches are removed\n"
+				"     callDepthLimit -> Shows how deeply recipe calls can be nested\n"
+				"     globalMemorySize -> Shows how many runtime values are currently allocated\n"
+				"     recipeCache -> Shows how many calls to pure recipes the last program ran found\n"
+				"         cached, and how many it had to run\n"
+				" clear -> Clears the terminal\n"
+				" exit -> Closes the terminal\n\n";
+		}
+		else if (words[0] == "console")
+			initConsoleMsg();
+		else if (words[0] == "run") {
+			if (wordCount < 2)
+				return;
+
+			runSourceFile(words[1]); 
+		}
+		else if (words[0] == "compile") {
+			if (wordCount < 3)
+				return;
+
+			compileSourceFile(words[1], words[2]); 
+		}
+		else if (words[0] == "set") {
+			if (wordCount < 3)
+				return;
+
+			const bool condition = words[2] == "true";
+
+			if (words[1] == "logTokens")
+				interpreter.enableTokenLogging(condition);
+			else if (words[1] == "logAST")
+				interpreter.enableASTLogging(condition);
+			else if (words[1] == "logRuntimeValue")
+				interpreter.enableRuntimeValueLogging(condition);
+			else if (words[1] == "useBytecode")
+				interpreter.enableBytecode(condition);
+			else if (words[1] == "logBytecode")
+				interpreter.enableBytecodeLogging(condition);
+			else if (words[1] == "useSuperinstructions")
+				interpreter.enableSuperinstructions(condition);
+			else if (words[1] == "useJit")
+				interpreter.enableJit(condition);
+			else if (words[1] == "useInlining")
+				interpreter.enableInlining(condition);
+			else if (words[1] == "useHoisting")
+				interpreter.enableHoisting(condition);
+			else if (words[1] == "useSimplification")
+				interpreter.enableSimplification(condition);
+			else if (words[1] == "usePruning")
+				interpreter.enablePruning(condition);
+			else if (words[1] == "callDepthLimit")
+				interpreter.setCallDepthLimit(std::atoi(words[2].c_str()));
+		}
+		else if (words[0] == "show") {
+			auto showEnviromentVariable = [](const std::string& variableName,
+				const std::string& value) -> void
+			{
+				std::cout << " Enviroment variable `" << variableName << "` is currently set to " 
+					<< value << "\n"; 
+			};
+
+			if (wordCount < 2)
+				return; 
+
+			if (words[1] == "logTokens")
+				showEnviromentVariable(
+					"shouldLogTokens", interpreter.isTokenLoggingEnabled() ? "true" : "false"
+				); 
+			else if (words[1] == "logAST")
+				showEnviromentVariable(
+					"shouldLogAST", interpreter.isASTLoggingEnabled() ? "true" : "false"
+				);
+			else if (words[1] == "logRuntimeValue")
+				showEnviromentVariable(
+					"shouldLogRuntimeValue", interpreter.isRuntimeValueLoggingEnabled() 
+						? "true" : "false"
+				);
+			else if (words[1] == "useBytecode")
+				showEnviromentVariable(
+					"shouldUseBytecode", interpreter.isBytecodeEnabled() ? "true" : "false"
+				);
+			else if (words[1] == "logBytecode")
+				showEnviromentVariable(
+					"shouldLogBytecode", interpreter.isBytecodeLoggingEnabled() ? "true" : "false"
+				);
+			else if (words[1] == "useSuperinstructions")
+				showEnviromentVariable(
+					"shouldUseSuperinstructions", interpreter.isSuperinstructionsEnabled() 
+						? "true" : "false"
+				);
+			else if (words[1] == "useJit")
+				showEnviromentVariable(
+					"shouldUseJit", interpreter.isJitEnabled() ? "true" : "false"
+				);
+			else if (words[1] == "useInlining")
+				showEnviromentVariable(
+					"shouldInline", interpreter.isInliningEnabled() ? "true" : "false"
+				);
+			else if (words[1] == "useHoisting")
+				showEnviromentVariable(
+					"shouldHoist", interpreter.isHoistingEnabled() ? "true" : "false"
+				);
+			else if (words[1] == "useSimplification")
+				showEnviromentVariable(
+					"shouldSimplify", interpreter.isSimplificationEnabled() ? "true" : "false"
+				);
+			else if (words[1] == "usePruning")
+				showEnviromentVariable(
+					"shouldPrune", interpreter.isPruningEnabled() ? "true" : "false"
+				);
+			else if (words[1] == "callDepthLimit")
+				showEnviromentVariable(
+					"callDepthLimit", std::to_string(interpreter.getCallDepthLimit())
+				);
+			else if (words[1] == "globalMemorySize") {
+				const int allocatedRuntimeValues = globalMemory->getPointerCount();
+				std::cout << " Currently, there are " << allocatedRuntimeValues
+					<< " runtimeValues allocated\n"; 
+			}
+			else if (words[1] == "recipeCache") {
+				std::cout << " Calls to pure recipes were found cached " << recipeCacheHits 
+					<< " times, and ran " << recipeCacheMisses << " times\n"; 
+			}
+		}
+		else if (words[0] == "clear") {
+			// Clears terminal in Windows
+			system("cls");
+			initNoodleScriptMsg();
+		}
+	}
+	void executeConsole(const std::string& input) {
+		if (input == "terminal") {
+			initTerminalMsg();
+			return;
+		}
+
+		if (sourceCode == "")
+			sourceCode = input;
+
+		interpreter.generateProgram(sourceCode);
+		interpreter.runProgram();
+
+		sourceCode = "";
+		jumpToConsole = false;
+	}
+
+	void initTerminal(int argc, const char** argv) {
+		terminalOpen = true;
+
+		// Attempts running a source file if an extra parameter is passed into the command prompt
+		if (argc == 2) {
+			const std::string filepath = argv[1];
+			runSourceFile(filepath); 
+		}
+		// Compiles the source file instead when called with `compile [input] [output]`
+		else if (argc == 4 && std::string(argv[1]) == "compile") {
+			compileSourceFile(argv[2], argv[3]); 
+			terminalOpen = false; 
+		}
+		else 
+			initNoodleScriptMsg();
+	}
+	bool isTerminalOpen() {
+		return terminalOpen; 
+	}
+	std::string readSourceFile(const std::string& filepath) {
+		std::ifstream sourceFile(filepath);
+		std::string source;
+		std::string line;
+
+		while (std::getline(sourceFile, line)) {
+			// Strips carriage returns left behind by scripts saved with CRLF line endings
+			if (!line.empty() && line.back() == '\r')
+				line.pop_back(); 
+
+			if (line.empty())
+				continue;
+
+			// Adds \n to ensure an EOL token is lexed
+			source += line + " \n";
+		}
+
+		sourceFile.close();
+		return source;
+	}
+	void runSourceFile(const std::string& filepath) {
+		insideConsole = true;
+		sourceCode += readSourceFile(filepath);
+		initConsoleMsg();
+		jumpToConsole = true;
+	}
+	void compileSourceFile(const std::string& filepath, const std::string& outputPath) {
+		interpreter.generateProgram(readSourceFile(filepath));
+		interpreter.compileProgram(outputPath);
+	}
+	void updateTerminal() {
+		if (insideConsole) prepareConsoleMsg();
+		else prepareTerminalMsg();
+
+		// Skips input handling when a script is ready to be run
+		if (!jumpToConsole) {
+			std::getline(std::cin, terminalInput);
+
+			// Exits terminal when `exit` is typed
+			if (terminalInput == "exit") {
+				terminalOpen = false;
+				return; 
+			}
+		}
+
+		if (insideConsole) executeConsole(terminalInput);
+		else executeTerminal(terminalInput);
+	}
+	void closeTerminal() {
+	}
 }
\ No newline at end of file
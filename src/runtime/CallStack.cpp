@@ -0,0 +1,63 @@
+#include "../../hdr/runtime/CallStack.hpp"
+#include "../../hdr/util/Error.hpp"
+
+#include <cstdint>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace ns {
+	int callDepth = 0; 
+	int callDepthLimit = 100000; 
+
+	namespace {
+		uintptr_t nativeStackBase = 0; 
+
+		// Part of the native stack recipe calls can use, leaving the rest for evaluating 
+		// whatever they run
+		size_t findNativeStackBudget() {
+			size_t stackSize = 1 << 20; // Default on Windows
+
+#if defined(__unix__) || defined(__APPLE__)
+			rlimit stackLimit; 
+
+			if (getrlimit(RLIMIT_STACK, &stackLimit) == 0) {
+				stackSize = stackLimit.rlim_cur != RLIM_INFINITY 
+					? static_cast<size_t>(stackLimit.rlim_cur) : 8 << 20; 
+			}
+#endif
+
+			return stackSize / 4 * 3; 
+		}
+		uintptr_t findStackPointer() {
+			volatile char marker = 0; 
+			return reinterpret_cast<uintptr_t>(&marker); 
+		}
+	}
+
+	void markNativeStackBase() {
+		nativeStackBase = findStackPointer(); 
+		callDepth = 0; 
+	}
+	void enterRecipeCall(const std::string& caller, bool nestsNatively) {
+		static const size_t nativeStackBudget = findNativeStackBudget(); 
+		// The native stack grows down from where the program started
+		const uintptr_t stackPointer = nestsNatively ? findStackPointer() : nativeStackBase; 
+
+		if (callDepth >= callDepthLimit || (stackPointer < nativeStackBase 
+			&& nativeStackBase - stackPointer > nativeStackBudget)) 
+		{
+			throw Error(
+				Error::Location::Interpreter,
+				22,
+				"Cannot call recipe " + caller + " as recipe calls are nested too deeply"
+			);
+		}
+
+		callDepth++; 
+	}
+	void leaveRecipeCall() {
+		callDepth--; 
+	}
+}
\ No newline at end of file
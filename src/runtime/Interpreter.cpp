@@ -1,160 +1,328 @@
-#include "../../hdr/runtime/Interpreter.hpp"
-#include "../../hdr/util/Error.hpp"
-
-namespace ns {
-	Interpreter::Interpreter() :
-		program(nullptr),
-		globalScope(nullptr),
-		runtimeValue(nullptr),
-		shouldLogTokens(false),
-		shouldLogAST(false),
-		shouldLogRuntimeValue(false)
-	{
-		globalMemory = &memory; 
-
-		try {
-			initGlobalScope();
-		}
-		catch (const Error& error) {
-			std::cout << error;
-		}
-	}
-	Interpreter::~Interpreter() {
-		if (program != nullptr)
-			delete program; 
-	}
-
-	void Interpreter::generateProgram(const std::string& sourceCode) {
-		if (program != nullptr) {
-			delete program;
-			program = nullptr; 
-		}
-
-		try {
-			const std::vector<Token>* tokens = parser.lexSourceCode(sourceCode);
-			copyTokens(tokens); 
-
-			if (shouldLogTokens) logTokens();
-			program = parser.produceAST(); 
-
-			if (shouldLogAST) logAST(); 
-		}
-		catch (const Error& error) {
-			std::cout << error; 
-			
-			delete program;
-			program = nullptr; 
-		}
-	}
-	void Interpreter::runProgram() { 
-		try {
-			if (program == nullptr)
-				throw Error(
-					Error::Location::Interpreter, 
-					11, 
-					"Unable to run program, as it does not exist."
-				); 
-
-			runtimeValue = evaluateASTNode(program, globalScope); 
-
-			if (shouldLogRuntimeValue) logRuntimeValue();  
-		}
-		catch (const Error& error) {
-			std::cout << error; 
-		}
-	}
-	void Interpreter::deleteProgramMemory() {
-		memory.clear(); 
-	}
-	void Interpreter::logTokens() const {
-		std::cout << "\nLexed Tokens:\n";
-		std::cout << tokens;
-	}
-	void Interpreter::logAST() const {
-		if (program == nullptr)
-			throw Error(
-				Error::Location::Interpreter,
-				7,
-				"Cannot log AST, as it is undefined."
-			);
-
-		std::cout << "\nGenerated AST:\n";
-		std::cout << program;
-		std::cout << "\n";
-	}
-
-	void Interpreter::enableTokenLogging(bool shouldLogTokens) {
-		std::cout << " Updated interpreter variable `shouldLogTokens` to "; 
-		std::cout << (shouldLogTokens ? "true" : "false") << "\n";
-		this->shouldLogTokens = shouldLogTokens; 
-	}
-	void Interpreter::enableASTLogging(bool shouldLogAST) {
-		std::cout << " Updated interpreter variable `shouldLogAST` to ";
-		std::cout << (shouldLogAST ? "true" : "false") << "\n";
-		this->shouldLogAST = shouldLogAST; 
-	}
-	void Interpreter::enableRuntimeValueLogging(bool shouldLogRuntimeValue) {
-		std::cout << " Updated interpreter variable `shouldLogRuntimeValue` to ";
-		std::cout << (shouldLogRuntimeValue ? "true" : "false") << "\n";
-		this->shouldLogRuntimeValue = shouldLogRuntimeValue; 
-	}
-
-	bool Interpreter::isTokenLoggingEnabled() const {
-		return shouldLogTokens;
-	}
-	bool Interpreter::isASTLoggingEnabled() const {
-		return shouldLogAST; 
-	}
-	bool Interpreter::isRuntimeValueLoggingEnabled() const {
-		return shouldLogRuntimeValue; 
-	}
-
-	void Interpreter::initGlobalScope(bool reallocate) {
-		globalScope = memory.create<Scope>(); 
-		globalScope->declareVariable("null", memory.create<NullValue>(), true);
-
-		BoolValue* trueValue = memory.create<BoolValue>(); 
-		trueValue->state = true; 
-		BoolValue* falseValue = memory.create<BoolValue>(); 
-		falseValue->state = false; 
-
-		globalScope->declareVariable("true", trueValue, true);
-		globalScope->declareVariable("false", falseValue, true);
-
-		// Create all of the native functions
-		for (int nativeFuncNameIndex = 0; nativeFuncNameIndex < numOfNativeFuncs; 
-			nativeFuncNameIndex++) 
-		{
-			const char* nativeFuncName = nativeFuncNames[nativeFuncNameIndex]; 
-			
-			FuncValue* funcValue = memory.create<FuncValue>();
-
-			funcValue->name = nativeFuncName; 
-			globalScope->declareVariable(funcValue->name, funcValue, true); 
-		}
-	}
-	void Interpreter::copyTokens(const std::vector<Token>* tokens) {
-		if (tokens == nullptr)
-			throw Error(
-				Error::Location::Interpreter,
-				8,
-				"Cannot log tokens, as they are undefined."
-			);
-
-		this->tokens.clear(); 
-
-		for (auto& token : *tokens) 
-			this->tokens.push_back(token); 
-	}
-	void Interpreter::logRuntimeValue() {
-		if (runtimeValue == nullptr)
-			throw Error(
-				Error::Location::Interpreter,
-				9,
-				"Cannot log runtime value, as it is undefined. "
-			); 
-
-		std::cout << runtimeValue; 
-		std::cout << "\n"; 
-	}
+#include "../../hdr/runtime/Interpreter.hpp"
+#include "../../hdr/util/Error.hpp"
+
+#include <cstdlib>
+#include <fstream>
+
+namespace ns {
+	Interpreter::Interpreter() :
+		program(nullptr),
+		chunk(nullptr),
+		globalScope(nullptr),
+		runtimeValue(nullptr),
+		shouldLogTokens(false),
+		shouldLogAST(false),
+		shouldLogRuntimeValue(false),
+		shouldUseBytecode(true),
+		shouldLogBytecode(false),
+		shouldUseSuperinstructions(true),
+		shouldUseJit(true),
+		shouldInline(true),
+		shouldHoist(true),
+		shouldSimplify(true),
+		shouldPrune(true),
+		prunedNodeCount(0)
+	{
+		globalMemory = &memory; 
+
+		try {
+			initGlobalScope();
+		}
+		catch (const Error& error) {
+			std::cout << error;
+		}
+	}
+	Interpreter::~Interpreter() {
+		if (program != nullptr)
+			delete program; 
+	}
+
+	void Interpreter::generateProgram(const std::string& sourceCode) {
+		if (program != nullptr) {
+			delete program;
+			program = nullptr; 
+		}
+
+		try {
+			const std::vector<Token>* tokens = parser.lexSourceCode(sourceCode);
+			copyTokens(tokens); 
+
+			if (shouldLogTokens) logTokens();
+			program = parser.produceAST(); 
+
+			Optimizer optimizer(shouldInline, shouldHoist, shouldSimplify, shouldPrune); 
+			optimizer.optimizeProgram(program); 
+			prunedNodeCount = optimizer.getPrunedNodeCount(); 
+
+			if (shouldLogAST) logAST(); 
+		}
+		catch (const Error& error) {
+			std::cout << error; 
+			
+			delete program;
+			program = nullptr; 
+		}
+	}
+	void Interpreter::runProgram() { 
+		try {
+			if (program == nullptr)
+				throw Error(
+					Error::Location::Interpreter, 
+					11, 
+					"Unable to run program, as it does not exist."
+				); 
+
+			recipeCacheHits = 0; 
+			recipeCacheMisses = 0; 
+
+			if (shouldUseBytecode) {
+				Compiler compiler(shouldUseSuperinstructions, shouldUseJit); 
+				chunk = compiler.compileProgram(program); 
+
+				if (shouldLogBytecode) logBytecode(); 
+				markNativeStackBase(); 
+				runtimeValue = executeChunk(chunk, globalScope); 
+			}
+			else {
+				markNativeStackBase(); 
+				runtimeValue = evaluateASTNode(program, globalScope); 
+			}
+
+			if (shouldLogRuntimeValue) logRuntimeValue();  
+		}
+		catch (const Error& error) {
+			std::cout << error; 
+		}
+	}
+	void Interpreter::compileProgram(const std::string& outputPath) {
+		try {
+			if (program == nullptr)
+				throw Error(
+					Error::Location::Interpreter, 
+					19, 
+					"Unable to compile program, as it does not exist."
+				); 
+
+			Transpiler transpiler; 
+			const std::string sourcePath = outputPath + ".cpp"; 
+			std::ofstream sourceFile(sourcePath); 
+
+			if (!sourceFile)
+				throw Error(
+					Error::Location::Interpreter, 
+					20, 
+					"Cannot write transpiled program to " + sourcePath
+				); 
+
+			sourceFile << transpiler.transpileProgram(program); 
+			sourceFile.close(); 
+
+			// The runtime library is found relative to the repository's root, which defaults to 
+			// the working directory
+			const char* compiler = std::getenv("CXX"); 
+			const char* root = std::getenv("NOODLESCRIPT_ROOT"); 
+			const std::string rootPath = root != nullptr ? root : "."; 
+			std::string command = std::string(compiler != nullptr ? compiler : "c++") 
+				+ " -std=c++17 -O2 -I\"" + rootPath + "\" \"" + sourcePath + "\""; 
+
+			for (const char* runtimeSource : runtimeSources)
+				command += " \"" + rootPath + "/" + runtimeSource + "\""; 
+
+			command += " -o \"" + outputPath + "\""; 
+			std::cout << " Building " << outputPath << " from " << sourcePath << "\n"; 
+			std::cout.flush(); 
+
+			if (std::system(command.c_str()) != 0)
+				throw Error(
+					Error::Location::Interpreter, 
+					21, 
+					"Unable to build " + outputPath + " from " + sourcePath
+				); 
+		}
+		catch (const Error& error) {
+			std::cout << error; 
+		}
+	}
+	void Interpreter::deleteProgramMemory() {
+		memory.clear(); 
+	}
+	void Interpreter::logTokens() const {
+		std::cout << "\nLexed Tokens:\n";
+		std::cout << tokens;
+	}
+	void Interpreter::logAST() const {
+		if (program == nullptr)
+			throw Error(
+				Error::Location::Interpreter,
+				7,
+				"Cannot log AST, as it is undefined."
+			);
+
+		std::cout << "\nGenerated AST:\n";
+		std::cout << program;
+		std::cout << "\n";
+		std::cout << "Removed " << prunedNodeCount << " unreachable nodes\n";
+	}
+	void Interpreter::logBytecode() const {
+		if (chunk == nullptr)
+			throw Error(
+				Error::Location::Interpreter,
+				16,
+				"Cannot log bytecode, as it is undefined."
+			);
+
+		std::cout << "\nCompiled Bytecode:\n";
+		std::cout << chunk;
+		std::cout << "\n";
+	}
+
+	void Interpreter::enableTokenLogging(bool shouldLogTokens) {
+		std::cout << " Updated interpreter variable `shouldLogTokens` to "; 
+		std::cout << (shouldLogTokens ? "true" : "false") << "\n";
+		this->shouldLogTokens = shouldLogTokens; 
+	}
+	void Interpreter::enableASTLogging(bool shouldLogAST) {
+		std::cout << " Updated interpreter variable `shouldLogAST` to ";
+		std::cout << (shouldLogAST ? "true" : "false") << "\n";
+		this->shouldLogAST = shouldLogAST; 
+	}
+	void Interpreter::enableRuntimeValueLogging(bool shouldLogRuntimeValue) {
+		std::cout << " Updated interpreter variable `shouldLogRuntimeValue` to ";
+		std::cout << (shouldLogRuntimeValue ? "true" : "false") << "\n";
+		this->shouldLogRuntimeValue = shouldLogRuntimeValue; 
+	}
+	void Interpreter::enableBytecode(bool shouldUseBytecode) {
+		std::cout << " Updated interpreter variable `shouldUseBytecode` to ";
+		std::cout << (shouldUseBytecode ? "true" : "false") << "\n";
+		this->shouldUseBytecode = shouldUseBytecode; 
+	}
+	void Interpreter::enableBytecodeLogging(bool shouldLogBytecode) {
+		std::cout << " Updated interpreter variable `shouldLogBytecode` to ";
+		std::cout << (shouldLogBytecode ? "true" : "false") << "\n";
+		this->shouldLogBytecode = shouldLogBytecode; 
+	}
+	void Interpreter::enableSuperinstructions(bool shouldUseSuperinstructions) {
+		std::cout << " Updated interpreter variable `shouldUseSuperinstructions` to ";
+		std::cout << (shouldUseSuperinstructions ? "true" : "false") << "\n";
+		this->shouldUseSuperinstructions = shouldUseSuperinstructions; 
+	}
+	void Interpreter::enableJit(bool shouldUseJit) {
+		std::cout << " Updated interpreter variable `shouldUseJit` to ";
+		std::cout << (shouldUseJit ? "true" : "false") << "\n";
+		this->shouldUseJit = shouldUseJit; 
+	}
+	void Interpreter::enableInlining(bool shouldInline) {
+		std::cout << " Updated interpreter variable `shouldInline` to ";
+		std::cout << (shouldInline ? "true" : "false") << "\n";
+		this->shouldInline = shouldInline; 
+	}
+	void Interpreter::enableHoisting(bool shouldHoist) {
+		std::cout << " Updated interpreter variable `shouldHoist` to ";
+		std::cout << (shouldHoist ? "true" : "false") << "\n";
+		this->shouldHoist = shouldHoist; 
+	}
+	void Interpreter::enableSimplification(bool shouldSimplify) {
+		std::cout << " Updated interpreter variable `shouldSimplify` to ";
+		std::cout << (shouldSimplify ? "true" : "false") << "\n";
+		this->shouldSimplify = shouldSimplify; 
+	}
+	void Interpreter::enablePruning(bool shouldPrune) {
+		std::cout << " Updated interpreter variable `shouldPrune` to ";
+		std::cout << (shouldPrune ? "true" : "false") << "\n";
+		this->shouldPrune = shouldPrune; 
+	}
+	void Interpreter::setCallDepthLimit(int callDepthLimit) {
+		if (callDepthLimit <= 0)
+			return; 
+
+		std::cout << " Updated interpreter variable `callDepthLimit` to " << callDepthLimit << "\n";
+		ns::callDepthLimit = callDepthLimit; 
+	}
+
+	bool Interpreter::isTokenLoggingEnabled() const {
+		return shouldLogTokens;
+	}
+	bool Interpreter::isASTLoggingEnabled() const {
+		return shouldLogAST; 
+	}
+	bool Interpreter::isRuntimeValueLoggingEnabled() const {
+		return shouldLogRuntimeValue; 
+	}
+	bool Interpreter::isBytecodeEnabled() const {
+		return shouldUseBytecode; 
+	}
+	bool Interpreter::isBytecodeLoggingEnabled() const {
+		return shouldLogBytecode; 
+	}
+	bool Interpreter::isSuperinstructionsEnabled() const {
+		return shouldUseSuperinstructions; 
+	}
+	bool Interpreter::isJitEnabled() const {
+		return shouldUseJit; 
+	}
+	bool Interpreter::isInliningEnabled() const {
+		return shouldInline; 
+	}
+	bool Interpreter::isHoistingEnabled() const {
+		return shouldHoist; 
+	}
+	bool Interpreter::isSimplificationEnabled() const {
+		return shouldSimplify; 
+	}
+	bool Interpreter::isPruningEnabled() const {
+		return shouldPrune; 
+	}
+	int Interpreter::getCallDepthLimit() const {
+		return callDepthLimit; 
+	}
+
+	void Interpreter::initGlobalScope(bool reallocate) {
+		globalScope = memory.create<Scope>(); 
+		globalScope->declareVariable("null", memory.create<NullValue>(), true);
+
+		BoolValue* trueValue = memory.create<BoolValue>(); 
+		trueValue->state = true; 
+		BoolValue* falseValue = memory.create<BoolValue>(); 
+		falseValue->state = false; 
+
+		globalScope->declareVariable("true", trueValue, true);
+		globalScope->declareVariable("false", falseValue, true);
+
+		// Create all of the native functions
+		for (int nativeFuncNameIndex = 0; nativeFuncNameIndex < numOfNativeFuncs; 
+			nativeFuncNameIndex++) 
+		{
+			const char* nativeFuncName = nativeFuncNames[nativeFuncNameIndex]; 
+			
+			FuncValue* funcValue = memory.create<FuncValue>();
+
+			funcValue->name = nativeFuncName; 
+			funcValue->nativeFunc = true; 
+			globalScope->declareVariable(funcValue->name, funcValue, true); 
+		}
+	}
+	void Interpreter::copyTokens(const std::vector<Token>* tokens) {
+		if (tokens == nullptr)
+			throw Error(
+				Error::Location::Interpreter,
+				8,
+				"Cannot log tokens, as they are undefined."
+			);
+
+		this->tokens.clear(); 
+
+		for (auto& token : *tokens) 
+			this->tokens.push_back(token); 
+	}
+	void Interpreter::logRuntimeValue() {
+		if (runtimeValue == nullptr)
+			throw Error(
+				Error::Location::Interpreter,
+				9,
+				"Cannot log runtime value, as it is undefined. "
+			); 
+
+		std::cout << runtimeValue; 
+		std::cout << "\n"; 
+	}
 }
\ No newline at end of file
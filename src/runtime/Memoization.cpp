@@ -0,0 +1,88 @@
+#include "../../hdr/runtime/Memoization.hpp"
+
+#include <cstring>
+
+namespace ns {
+	size_t recipeCacheHits = 0; 
+	size_t recipeCacheMisses = 0; 
+
+	namespace {
+		template <typename Type>
+		void appendBytes(std::string& key, const Type& value) {
+			char bytes[sizeof(Type)]; 
+
+			std::memcpy(bytes, &value, sizeof(Type)); 
+			key.append(bytes, sizeof(Type)); 
+		}
+	}
+
+	bool makeRecipeCacheKey(RuntimeValue* const* arguments, size_t argumentCount, std::string& key) {
+		key.clear(); 
+
+		for (size_t argumentIndex = 0; argumentIndex < argumentCount; argumentIndex++) {
+			const RuntimeValue* argument = arguments[argumentIndex]; 
+
+			switch (argument->valueType) {
+			case ValueType::Null:
+				key += 'n'; 
+				break; 
+			case ValueType::Number:
+			{
+				// Integers print differently from the doubles equal to them, so they're kept apart
+				const NumValue* numValue = static_cast<const NumValue*>(argument); 
+
+				if (numValue->integral) {
+					key += 'i'; 
+					appendBytes(key, numValue->integer); 
+				}
+				else {
+					key += 'd'; 
+					appendBytes(key, numValue->value); 
+				}
+
+				break; 
+			}
+			case ValueType::Bool:
+				key += static_cast<const BoolValue*>(argument)->state ? 't' : 'f'; 
+				break; 
+			case ValueType::String:
+			{
+				// The length comes first, so the characters of one string can't run into the next
+				const StringValue* stringValue = static_cast<const StringValue*>(argument); 
+
+				key += 's'; 
+				appendBytes(key, stringValue->length()); 
+				key.append(stringValue->data(), stringValue->length()); 
+				break; 
+			}
+			default:
+				return false; 
+			}
+		}
+
+		return true; 
+	}
+	RuntimeValue* findCachedResult(FuncValue* funcValue, const std::string& key) {
+		RuntimeValue** result = funcValue->cache->find(key); 
+
+		if (result == nullptr) {
+			recipeCacheMisses++; 
+			return nullptr; 
+		}
+
+		recipeCacheHits++; 
+		return cloneRuntimeValue(*result); 
+	}
+	void storeCachedResult(FuncValue* funcValue, const std::string& key, RuntimeValue* result) {
+		switch (result->valueType) {
+		case ValueType::Null:
+		case ValueType::Number:
+		case ValueType::Bool:
+		case ValueType::String:
+			funcValue->cache->insert(key, cloneRuntimeValue(result)); 
+			break; 
+		default:
+			break; 
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,995 @@
+#include "../../hdr/runtime/Natives.hpp"
+#include "../../hdr/runtime/Operations.hpp"
+#include "../../hdr/util/Error.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+
+namespace ns {
+	const int nativeFuncArities[numOfNativeFuncs] = {
+		-1, // serve
+		-1, // serveRaw
+		-1, // receive
+		1, // floor
+		1, // ceil
+		1, // round
+		1, // num
+		1, // bool
+		1, // str
+		2, // pow
+		1, // sqrt
+		1, // len
+		2, // append
+		2, // at
+		3, // set
+		2, // pop
+		1, // abs
+		0, // clock
+		1, // copy
+		2, // prepend
+		1, // popFront
+		0, // map
+		3, // insert
+		2, // lookup
+		2, // remove
+		2, // contains
+		1, // keys
+		1, // toSet
+		1, // toList
+		2, // add
+		2, // has
+		2, // union
+		2, // intersect
+		2, // difference
+		3, // slice
+		2, // ord
+		1 // chr
+	};
+
+	int findNativeFunc(const std::string& name) {
+		for (int nativeIndex = 0; nativeIndex < numOfNativeFuncs; nativeIndex++) {
+			if (name == nativeFuncNames[nativeIndex])
+				return nativeIndex; 
+		}
+
+		return -1; 
+	}
+	bool isNativeFunc(const RuntimeValue* callee, const std::string& name) {
+		return callee->valueType == ValueType::FuncValue
+			&& static_cast<const FuncValue*>(callee)->nativeFunc
+				&& static_cast<const FuncValue*>(callee)->name == name;
+	}
+	bool checksFrozenArgument(int nativeIndex) {
+		// set, pop and popFront
+		return nativeIndex == 14 || nativeIndex == 15 || nativeIndex == 20; 
+	}
+	void verifyNativeArgumentCount(int nativeIndex, const std::string& caller, size_t argumentCount) {
+		const int arity = nativeFuncArities[nativeIndex]; 
+
+		// Throw error if argument counts aren't equal
+		if (arity != -1 && static_cast<int>(argumentCount) != arity) {
+			throw Error(
+				Error::Location::Interpreter,
+				14,
+				"Cannot call recipe " + caller + " with " + std::to_string(argumentCount) 
+					+ (argumentCount == 1 ? " argument" : " arguments")
+			);
+		}
+	}
+	void serveRuntimeValue(const RuntimeValue* runtimeValue) {
+		switch (runtimeValue->valueType) {
+		case ValueType::Number:
+		{
+			const NumValue* numberValue = dynamic_cast<const NumValue*>(runtimeValue);
+
+			// The sign of NaN depends on how it was computed, which differs between engines
+			if (numberValue->integral)
+				std::cout << numberValue->integer; 
+			else if (std::isnan(numberValue->value))
+				std::cout << "nan";
+			else
+				std::cout << numberValue->value;
+
+			break;
+		}
+		case ValueType::Bool:
+		{
+			const BoolValue* boolValue = dynamic_cast<const BoolValue*>(runtimeValue);
+			std::cout << (boolValue->state ? "true" : "false");
+			break;
+		}
+		case ValueType::String:
+		{
+			const StringValue* stringValue = dynamic_cast<const StringValue*>(runtimeValue);
+			std::cout.write(stringValue->data(), stringValue->length());
+			break;
+		}
+		case ValueType::List:
+		{
+			const ListValue* listValue = dynamic_cast<const ListValue*>(runtimeValue);
+
+			std::cout << "[";
+
+			for (int elementIndex = 0; elementIndex < listValue->size(); 
+				elementIndex++) 
+			{
+				const RuntimeValue* element = listValue->at(elementIndex); 
+				serveRuntimeValue(element); 
+
+				if (elementIndex < listValue->size() - 1)
+					std::cout << " ";
+			}
+
+			std::cout << "]";
+			break;
+		}
+		case ValueType::Map:
+		{
+			const MapValue* mapValue = dynamic_cast<const MapValue*>(runtimeValue);
+			bool firstEntry = true; 
+
+			std::cout << "{";
+
+			mapValue->entries.forEach([&](const RuntimeValue* key, 
+				const RuntimeValue* value) -> void 
+			{
+				if (!firstEntry)
+					std::cout << " ";
+
+				serveRuntimeValue(key); 
+				std::cout << ": ";
+				serveRuntimeValue(value); 
+				firstEntry = false; 
+			}); 
+
+			std::cout << "}";
+			break;
+		}
+		case ValueType::Set:
+		{
+			const SetValue* setValue = dynamic_cast<const SetValue*>(runtimeValue);
+			bool firstElement = true; 
+
+			std::cout << "{";
+
+			setValue->elements.forEach([&](const RuntimeValue* element, char) -> void {
+				if (!firstElement)
+					std::cout << " ";
+
+				serveRuntimeValue(element); 
+				firstElement = false; 
+			}); 
+
+			std::cout << "}";
+			break;
+		}
+		case ValueType::Dish:
+		{
+			const DishValue* dishValue = dynamic_cast<const DishValue*>(runtimeValue);
+			const DishShape* dishShape = dishValue->shape; 
+
+			std::cout << dishShape->name << "{";
+
+			for (size_t slot = 0; slot < dishValue->slots.size(); slot++) {
+				std::cout << dishShape->fields[slot] << ": ";
+				serveRuntimeValue(dishValue->slots[slot]); 
+
+				if (slot < dishValue->slots.size() - 1)
+					std::cout << " ";
+			}
+
+			std::cout << "}";
+			break;
+		}
+		}
+	}
+	RuntimeValue* callNativeFunc(
+		int nativeIndex, RuntimeValue* const* arguments, size_t argumentCount, 
+		const std::function<void(StringValue*)>& storeStringArgument) 
+	{
+		// Interned strings are shared, so a string argument is replaced by its own copy before 
+		// it's modified, which is then stored back where the argument came from
+		auto ownStringArgument = [&](StringValue* stringValue) -> StringValue* {
+			if (!stringValue->interned)
+				return stringValue; 
+
+			StringValue* ownedStringValue = globalMemory->create<StringValue>(); 
+
+			ownedStringValue->value = stringValue->value; 
+
+			if (storeStringArgument)
+				storeStringArgument(ownedStringValue); 
+
+			return ownedStringValue; 
+		}; 
+
+		RuntimeValue* result = globalMemory->create<NullValue>(); 
+		
+		if (nativeIndex == 0) { // serve
+			for (size_t argumentIndex = 0; argumentIndex < argumentCount; argumentIndex++)
+				serveRuntimeValue(arguments[argumentIndex]); 
+		}
+		else if (nativeIndex == 2) { // receive
+			std::string input; 
+			std::getline(std::cin, input); 
+
+			StringValue* stringValue = globalMemory->create<StringValue>(); 
+
+			stringValue->value = input; 
+			result = stringValue; 
+		}
+		else if (nativeIndex == 3) { // floor
+			const RuntimeValue* evaluatedArgument = arguments[0];
+
+			switch (evaluatedArgument->valueType) {
+			case ValueType::Number:
+			{
+				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+					evaluatedArgument
+				); 
+
+				NumValue* numberValue = globalMemory->create<NumValue>(); 
+
+				numberValue->setNumber(std::floor(evaluatedNumValue->value)); 
+				result = numberValue; 
+			}
+				break;
+			}
+		}
+		else if (nativeIndex == 4) { // ceil
+			const RuntimeValue* evaluatedArgument = arguments[0];
+
+			switch (evaluatedArgument->valueType) {
+			case ValueType::Number:
+			{
+				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+					evaluatedArgument
+				);
+
+				NumValue* numberValue = globalMemory->create<NumValue>();
+
+				numberValue->setNumber(std::ceil(evaluatedNumValue->value));
+				result = numberValue;
+			}
+				break;
+			}
+		}
+		else if (nativeIndex == 5) { // round
+			const RuntimeValue* evaluatedArgument = arguments[0];
+
+			switch (evaluatedArgument->valueType) {
+			case ValueType::Number:
+			{
+				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+					evaluatedArgument
+				);
+
+				NumValue* numberValue = globalMemory->create<NumValue>();
+
+				numberValue->setNumber(std::round(evaluatedNumValue->value));
+				result = numberValue;
+			}
+				break;
+			}
+		}
+		else if (nativeIndex == 6) { // num
+			const RuntimeValue* evaluatedArgument = arguments[0];
+
+			switch (evaluatedArgument->valueType) {
+			case ValueType::Number:
+			{
+				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+					evaluatedArgument
+				);
+
+				NumValue* numberValue = globalMemory->create<NumValue>();
+
+				numberValue->value = evaluatedNumValue->value;
+				numberValue->integral = evaluatedNumValue->integral; 
+				numberValue->integer = evaluatedNumValue->integer; 
+				result = numberValue;
+				break;
+			}
+			case ValueType::String:
+			{
+				const StringValue* evaluatedStringValue = dynamic_cast<const StringValue*>(
+					evaluatedArgument
+				);
+
+				const std::string text = evaluatedStringValue->flatten(); 
+				NumValue* numberValue = globalMemory->create<NumValue>(); 
+				numberValue->value = 0; 
+				result = numberValue; 
+
+				// Integers are parsed exactly, even those a double can't hold
+				char* end = nullptr; 
+				errno = 0; 
+				const long long integer = std::strtoll(text.c_str(), &end, 10); 
+
+				if (end != text.c_str() && *end == '\0' && errno == 0) {
+					numberValue->setInteger(integer); 
+					break; 
+				}
+
+				try {
+					numberValue->setNumber(std::stod(text)); 
+				}
+				catch (...) {}
+
+				break;
+			}
+			}
+		}
+		else if (nativeIndex == 7) { // bool
+			const RuntimeValue* evaluatedArgument = arguments[0];
+
+			switch (evaluatedArgument->valueType) {
+			case ValueType::Number:
+			{
+				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+					evaluatedArgument
+				);
+
+				BoolValue* boolValue = globalMemory->create<BoolValue>();
+
+				boolValue->state = evaluatedNumValue->value > 0;
+				result = boolValue;
+				break;
+			}
+			case ValueType::String:
+			{
+				const StringValue* evaluatedStringValue = dynamic_cast<const StringValue*>(
+					evaluatedArgument
+				);
+
+				BoolValue* boolValue = globalMemory->create<BoolValue>();
+
+				boolValue->state = evaluatedStringValue->flatten() == "true"; 
+				result = boolValue;
+				break;
+			}
+			}
+		}
+		else if (nativeIndex == 8) { // str
+			const RuntimeValue* evaluatedArgument = arguments[0];
+
+			switch (evaluatedArgument->valueType) {
+			case ValueType::Number:
+			{
+				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+					evaluatedArgument
+				);
+
+				StringValue* stringValue = globalMemory->create<StringValue>();
+
+				if (evaluatedNumValue->integral)
+					stringValue->value = std::to_string(evaluatedNumValue->integer); 
+				else if (std::isnan(evaluatedNumValue->value))
+					stringValue->value = "nan"; 
+				else
+					stringValue->value = std::to_string(evaluatedNumValue->value); 
+
+				result = stringValue;
+				break;
+			}
+			case ValueType::Bool:
+			{
+				const BoolValue* evaluatedBoolValue = dynamic_cast<const BoolValue*>(
+					evaluatedArgument
+				);
+
+				StringValue* stringValue = globalMemory->create<StringValue>();
+
+				stringValue->value= evaluatedBoolValue->state ? "true" : "false"; 
+				result = stringValue;
+				break;
+			}
+			}
+		}
+		else if (nativeIndex == 9) { // pow
+			const RuntimeValue* evaluatedArgument1 = arguments[0];
+			const RuntimeValue* evaluatedArgument2 = arguments[1];
+
+			if (evaluatedArgument1->valueType == ValueType::Number
+				&& evaluatedArgument2->valueType == ValueType::Number)
+			{
+				const NumValue* evaluatedNumValue1 = dynamic_cast<const NumValue*>(
+					evaluatedArgument1
+				);
+				const NumValue* evaluatedNumValue2 = dynamic_cast<const NumValue*>(
+					evaluatedArgument2
+				);
+
+				NumValue* numberValue = globalMemory->create<NumValue>(); 
+
+				raiseNumber(evaluatedNumValue1, evaluatedNumValue2, numberValue); 
+				result = numberValue; 
+			}
+		}
+		else if (nativeIndex == 10) { // sqrt
+			const RuntimeValue* evaluatedArgument = arguments[0];
+
+			if (evaluatedArgument->valueType == ValueType::Number) {
+				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+					evaluatedArgument
+				);
+		
+				NumValue* numberValue = globalMemory->create<NumValue>();
+
+				numberValue->value = std::sqrt(evaluatedNumValue->value); 
+				result = numberValue;
+			}
+		}
+		else if (nativeIndex == 11) { // len
+			const RuntimeValue* evaluatedArgument = arguments[0];
+			
+			if (evaluatedArgument->valueType == ValueType::String) {
+				const StringValue* evaluatedStringValue = dynamic_cast<const StringValue*>(
+					evaluatedArgument
+				);
+
+				NumValue* numberValue = globalMemory->create<NumValue>();
+
+				numberValue->setInteger(evaluatedStringValue->length()); 
+				result = numberValue;
+			}
+			else if (evaluatedArgument->valueType == ValueType::List) {
+				const ListValue* evaluatedListValue = dynamic_cast<const ListValue*>(
+					evaluatedArgument
+				);
+
+				NumValue* numberValue = globalMemory->create<NumValue>();
+
+				numberValue->setInteger(evaluatedListValue->size()); 
+				result = numberValue;
+			}
+			else if (evaluatedArgument->valueType == ValueType::Map) {
+				const MapValue* evaluatedMapValue = dynamic_cast<const MapValue*>(
+					evaluatedArgument
+				);
+
+				NumValue* numberValue = globalMemory->create<NumValue>();
+
+				numberValue->setInteger(evaluatedMapValue->entries.size()); 
+				result = numberValue;
+			}
+			else if (evaluatedArgument->valueType == ValueType::Set) {
+				const SetValue* evaluatedSetValue = dynamic_cast<const SetValue*>(
+					evaluatedArgument
+				);
+
+				NumValue* numberValue = globalMemory->create<NumValue>();
+
+				numberValue->setInteger(evaluatedSetValue->elements.size()); 
+				result = numberValue;
+			}
+		}
+		else if (nativeIndex == 12) { // append
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+
+			if (evaluatedArgument1->valueType == ValueType::String) {
+				StringValue* evaluatedStringValue1 = ownStringArgument(
+					dynamic_cast<StringValue*>(evaluatedArgument1)
+				);
+
+				if (evaluatedArgument2->valueType == ValueType::String) {
+					const StringValue* evaluatedStringValue2 = dynamic_cast<const StringValue*>(
+						evaluatedArgument2
+					);
+
+					evaluatedStringValue1->flatten(); 
+					evaluatedStringValue1->value += evaluatedStringValue2->flatten(); 
+					result = evaluatedArgument1; 
+				}
+			}
+			else if (evaluatedArgument1->valueType == ValueType::List) {
+				ListValue* evaluatedListValue = dynamic_cast<ListValue*>(
+					evaluatedArgument1
+				);
+
+				evaluatedListValue->append(evaluatedArgument2); 
+				result = evaluatedArgument1; 
+			}
+		}
+		else if (nativeIndex == 13) { // at
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+
+			if (evaluatedArgument1->valueType == ValueType::String) {
+				StringValue* evaluatedStringValue = dynamic_cast<StringValue*>(
+					evaluatedArgument1
+				);
+
+				if (evaluatedArgument2->valueType == ValueType::Number) {
+					const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+						evaluatedArgument2
+					);
+
+					result = internChrValue(
+						evaluatedStringValue->data()[evaluatedNumValue->toInteger()]
+					); 
+				}
+			}
+			else if (evaluatedArgument1->valueType == ValueType::List) {
+				ListValue* evaluatedListValue = dynamic_cast<ListValue*>(
+					evaluatedArgument1
+				);
+
+				if (evaluatedArgument2->valueType == ValueType::Number) {
+					const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+						evaluatedArgument2
+					);
+
+					return evaluatedListValue->at(evaluatedNumValue->toInteger()); 
+				}
+			}
+		}
+		else if (nativeIndex == 14) { // set 
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+			RuntimeValue* evaluatedArgument3 = arguments[2];
+
+			if (evaluatedArgument1->valueType == ValueType::String) {
+				StringValue* evaluatedStringValue = ownStringArgument(
+					dynamic_cast<StringValue*>(evaluatedArgument1)
+				);
+
+				if (evaluatedArgument2->valueType == ValueType::Number) {
+					const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+						evaluatedArgument2
+					);
+
+					if (evaluatedArgument3->valueType == ValueType::String) {
+						const StringValue* evaluatedStringValue2 = dynamic_cast<StringValue*>(
+							evaluatedArgument3
+						);
+
+						evaluatedStringValue->flatten(); 
+						evaluatedStringValue->value[evaluatedNumValue->toInteger()] = 
+							evaluatedStringValue2->flatten()[0]; 
+					}
+				}
+			}
+			else if (evaluatedArgument1->valueType == ValueType::List) {
+				ListValue* evaluatedListValue = dynamic_cast<ListValue*>(evaluatedArgument1);
+
+				if (evaluatedArgument2->valueType == ValueType::Number) {
+					const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+						evaluatedArgument2
+					);
+
+					evaluatedListValue->set(evaluatedNumValue->toInteger(), evaluatedArgument3); 
+				}
+			}
+		}
+		else if (nativeIndex == 15) { // pop
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+
+			if (evaluatedArgument1->valueType == ValueType::String) {
+				StringValue* evaluatedStringValue = ownStringArgument(
+					dynamic_cast<StringValue*>(evaluatedArgument1)
+				);
+
+				if (evaluatedArgument2->valueType == ValueType::Number) {
+					const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+						evaluatedArgument2
+					);
+					const int64_t popIndex = evaluatedNumValue->toInteger(); 
+
+					evaluatedStringValue->flatten(); 
+
+					result = internChrValue(evaluatedStringValue->value[popIndex]); 
+					evaluatedStringValue->value.erase(
+						evaluatedStringValue->value.begin() + popIndex
+					);
+				}
+			}
+			else if (evaluatedArgument1->valueType == ValueType::List) {
+				ListValue* evaluatedListValue = dynamic_cast<ListValue*>(evaluatedArgument1);
+
+				if (evaluatedArgument2->valueType == ValueType::Number) {
+					const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+						evaluatedArgument2
+					);
+					const int64_t popIndex = evaluatedNumValue->toInteger(); 
+
+					result = evaluatedListValue->pop(popIndex); 
+				}
+			}
+		}
+		else if (nativeIndex == 16) { // abs
+			const RuntimeValue* evaluatedArgument = arguments[0]; 
+
+			if (evaluatedArgument->valueType == ValueType::Number) {
+				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+					evaluatedArgument
+				); 
+				
+				NumValue* resultNumValue = globalMemory->create<NumValue>(); 
+
+				if (evaluatedNumValue->integral && evaluatedNumValue->integer != INT64_MIN)
+					resultNumValue->setInteger(std::abs(evaluatedNumValue->integer)); 
+				else
+					resultNumValue->value = std::abs(evaluatedNumValue->value); 
+				result = resultNumValue; 
+			}
+		}
+		else if (nativeIndex == 17) { // clock
+			using Clock = std::chrono::steady_clock; 
+			static const Clock::time_point startTime = Clock::now(); 
+
+			NumValue* resultNumValue = globalMemory->create<NumValue>(); 
+
+			resultNumValue->value = std::chrono::duration<double>(Clock::now() - startTime).count(); 
+			result = resultNumValue; 
+		}
+		else if (nativeIndex == 18) { // copy
+			RuntimeValue* evaluatedArgument = arguments[0]; 
+
+			if (evaluatedArgument->valueType == ValueType::List) {
+				ListValue* evaluatedListValue = dynamic_cast<ListValue*>(evaluatedArgument); 
+				result = evaluatedListValue->snapshot(); 
+			}
+			else
+				result = cloneRuntimeValue(evaluatedArgument); 
+		}
+		else if (nativeIndex == 19) { // prepend
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+
+			if (evaluatedArgument1->valueType == ValueType::String) {
+				StringValue* evaluatedStringValue1 = ownStringArgument(
+					dynamic_cast<StringValue*>(evaluatedArgument1)
+				);
+
+				if (evaluatedArgument2->valueType == ValueType::String) {
+					const StringValue* evaluatedStringValue2 = dynamic_cast<const StringValue*>(
+						evaluatedArgument2
+					);
+
+					evaluatedStringValue1->flatten(); 
+					evaluatedStringValue1->value.insert(0, evaluatedStringValue2->flatten()); 
+					result = evaluatedArgument1; 
+				}
+			}
+			else if (evaluatedArgument1->valueType == ValueType::List) {
+				ListValue* evaluatedListValue = dynamic_cast<ListValue*>(
+					evaluatedArgument1
+				);
+
+				evaluatedListValue->prepend(evaluatedArgument2); 
+				result = evaluatedArgument1; 
+			}
+		}
+		else if (nativeIndex == 20) { // popFront
+			RuntimeValue* evaluatedArgument = arguments[0];
+
+			if (evaluatedArgument->valueType == ValueType::String) {
+				StringValue* evaluatedStringValue = ownStringArgument(
+					dynamic_cast<StringValue*>(evaluatedArgument)
+				);
+
+				evaluatedStringValue->flatten(); 
+
+				result = internChrValue(evaluatedStringValue->value[0]); 
+				evaluatedStringValue->value.erase(0, 1);
+			}
+			else if (evaluatedArgument->valueType == ValueType::List) {
+				ListValue* evaluatedListValue = dynamic_cast<ListValue*>(evaluatedArgument);
+				result = evaluatedListValue->popFront(); 
+			}
+		}
+		else if (nativeIndex == 21) { // map
+			result = globalMemory->create<MapValue>(); 
+		}
+		else if (nativeIndex == 22) { // insert
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+			RuntimeValue* evaluatedArgument3 = arguments[2];
+
+			if (evaluatedArgument1->valueType == ValueType::Map) {
+				MapValue* evaluatedMapValue = dynamic_cast<MapValue*>(evaluatedArgument1); 
+
+				// Keys are cloned, as a string changing after insertion would corrupt the map
+				evaluatedMapValue->entries.insert(
+					cloneRuntimeValue(evaluatedArgument2), cloneRuntimeValue(evaluatedArgument3)
+				); 
+				result = evaluatedArgument1; 
+			}
+		}
+		else if (nativeIndex == 23) { // lookup
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+
+			if (evaluatedArgument1->valueType == ValueType::Map) {
+				MapValue* evaluatedMapValue = dynamic_cast<MapValue*>(evaluatedArgument1); 
+				RuntimeValue** value = evaluatedMapValue->entries.find(evaluatedArgument2); 
+
+				if (value != nullptr)
+					return *value; 
+			}
+		}
+		else if (nativeIndex == 24) { // remove
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+
+			if (evaluatedArgument1->valueType == ValueType::Map) {
+				MapValue* evaluatedMapValue = dynamic_cast<MapValue*>(evaluatedArgument1); 
+				RuntimeValue** value = evaluatedMapValue->entries.find(evaluatedArgument2); 
+
+				if (value != nullptr) {
+					result = *value; 
+					evaluatedMapValue->entries.erase(evaluatedArgument2); 
+				}
+			}
+			else if (evaluatedArgument1->valueType == ValueType::Set) {
+				SetValue* evaluatedSetValue = dynamic_cast<SetValue*>(evaluatedArgument1); 
+
+				BoolValue* boolValue = globalMemory->create<BoolValue>(); 
+
+				boolValue->state = evaluatedSetValue->elements.erase(evaluatedArgument2); 
+				result = boolValue; 
+			}
+		}
+		else if (nativeIndex == 25) { // contains
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+
+			if (evaluatedArgument1->valueType == ValueType::Map) {
+				const MapValue* evaluatedMapValue = dynamic_cast<const MapValue*>(
+					evaluatedArgument1
+				); 
+
+				BoolValue* boolValue = globalMemory->create<BoolValue>(); 
+
+				boolValue->state = evaluatedMapValue->entries.contains(evaluatedArgument2); 
+				result = boolValue; 
+			}
+			else if (evaluatedArgument1->valueType == ValueType::Set) {
+				const SetValue* evaluatedSetValue = dynamic_cast<const SetValue*>(
+					evaluatedArgument1
+				); 
+
+				BoolValue* boolValue = globalMemory->create<BoolValue>(); 
+
+				boolValue->state = evaluatedSetValue->elements.contains(evaluatedArgument2); 
+				result = boolValue; 
+			}
+		}
+		else if (nativeIndex == 26) { // keys
+			RuntimeValue* evaluatedArgument = arguments[0];
+
+			if (evaluatedArgument->valueType == ValueType::Map) {
+				const MapValue* evaluatedMapValue = dynamic_cast<const MapValue*>(
+					evaluatedArgument
+				); 
+
+				ListValue* listValue = globalMemory->create<ListValue>(); 
+
+				evaluatedMapValue->entries.forEach([&](RuntimeValue* key, RuntimeValue*) -> void {
+					listValue->append(key); 
+				}); 
+				result = listValue; 
+			}
+		}
+		else if (nativeIndex == 27) { // toSet
+			RuntimeValue* evaluatedArgument = arguments[0];
+
+			if (evaluatedArgument->valueType == ValueType::List) {
+				const ListValue* evaluatedListValue = dynamic_cast<const ListValue*>(
+					evaluatedArgument
+				); 
+
+				SetValue* setValue = globalMemory->create<SetValue>(); 
+
+				setValue->elements.reserve(evaluatedListValue->size()); 
+
+				if (evaluatedListValue->isNumeric()) {
+					NumValue probeValue; 
+
+					// Looks numbers up unboxed, so only unique numbers are allocated
+					for (size_t elementIndex = 0; elementIndex < evaluatedListValue->size(); 
+						elementIndex++) 
+					{
+						evaluatedListValue->numberAt(elementIndex).unbox(&probeValue); 
+
+						if (!setValue->elements.contains(&probeValue)) {
+							NumValue* numberValue = globalMemory->create<NumValue>(); 
+
+							numberValue->value = probeValue.value; 
+							numberValue->integral = probeValue.integral; 
+							numberValue->integer = probeValue.integer; 
+							setValue->elements.insert(numberValue, 0); 
+						}
+					}
+				}
+				else {
+					for (size_t elementIndex = 0; elementIndex < evaluatedListValue->size(); 
+						elementIndex++) 
+					{
+						RuntimeValue* element = evaluatedListValue->at(elementIndex); 
+
+						if (!setValue->elements.contains(element))
+							setValue->elements.insert(cloneRuntimeValue(element), 0); 
+					}
+				}
+
+				result = setValue; 
+			}
+		}
+		else if (nativeIndex == 28) { // toList
+			RuntimeValue* evaluatedArgument = arguments[0];
+
+			if (evaluatedArgument->valueType == ValueType::Set) {
+				const SetValue* evaluatedSetValue = dynamic_cast<const SetValue*>(
+					evaluatedArgument
+				); 
+
+				ListValue* listValue = globalMemory->create<ListValue>(); 
+
+				evaluatedSetValue->elements.forEach([&](RuntimeValue* element, char) -> void {
+					listValue->append(element); 
+				}); 
+				result = listValue; 
+			}
+		}
+		else if (nativeIndex == 29) { // add
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+
+			if (evaluatedArgument1->valueType == ValueType::Set) {
+				SetValue* evaluatedSetValue = dynamic_cast<SetValue*>(evaluatedArgument1); 
+
+				// Only clones elements that weren't already in the set
+				if (!evaluatedSetValue->elements.contains(evaluatedArgument2))
+					evaluatedSetValue->elements.insert(cloneRuntimeValue(evaluatedArgument2), 0); 
+
+				result = evaluatedArgument1; 
+			}
+		}
+		else if (nativeIndex == 30) { // has
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+
+			if (evaluatedArgument1->valueType == ValueType::Set) {
+				const SetValue* evaluatedSetValue = dynamic_cast<const SetValue*>(
+					evaluatedArgument1
+				); 
+
+				BoolValue* boolValue = globalMemory->create<BoolValue>(); 
+
+				boolValue->state = evaluatedSetValue->elements.contains(evaluatedArgument2); 
+				result = boolValue; 
+			}
+		}
+		else if (nativeIndex == 31 // union
+			|| nativeIndex == 32 // intersect
+			|| nativeIndex == 33) // difference
+		{
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+
+			if (evaluatedArgument1->valueType == ValueType::Set 
+				&& evaluatedArgument2->valueType == ValueType::Set) 
+			{
+				const SetValue* evaluatedSetValue1 = dynamic_cast<const SetValue*>(
+					evaluatedArgument1
+				); 
+				const SetValue* evaluatedSetValue2 = dynamic_cast<const SetValue*>(
+					evaluatedArgument2
+				); 
+
+				SetValue* setValue = globalMemory->create<SetValue>(); 
+
+				// Elements never leave a set without being cloned, so sets can share them
+				if (nativeIndex == 31) {
+					setValue->elements.reserve(
+						evaluatedSetValue1->elements.size() + evaluatedSetValue2->elements.size()
+					); 
+
+					auto addElement = [&](RuntimeValue* element, char) -> void {
+						setValue->elements.insert(element, 0); 
+					}; 
+
+					evaluatedSetValue1->elements.forEach(addElement); 
+					evaluatedSetValue2->elements.forEach(addElement); 
+				}
+				else {
+					const bool keepShared = nativeIndex == 32; 
+
+					evaluatedSetValue1->elements.forEach([&](RuntimeValue* element, char) -> void {
+						if (evaluatedSetValue2->elements.contains(element) == keepShared)
+							setValue->elements.insert(element, 0); 
+					}); 
+				}
+
+				result = setValue; 
+			}
+		}
+		else if (nativeIndex == 34) { // slice
+			RuntimeValue* evaluatedArgument1 = arguments[0];
+			RuntimeValue* evaluatedArgument2 = arguments[1];
+			RuntimeValue* evaluatedArgument3 = arguments[2];
+
+			if (evaluatedArgument2->valueType == ValueType::Number 
+				&& evaluatedArgument3->valueType == ValueType::Number) 
+			{
+				const double startIndex = dynamic_cast<const NumValue*>(evaluatedArgument2)->value; 
+				const double endIndex = dynamic_cast<const NumValue*>(evaluatedArgument3)->value; 
+
+				// Clamps both indices to the value, so out of range slices are just shorter
+				auto clampIndex = [](double index, size_t length) -> size_t {
+					if (index <= 0.0)
+						return 0; 
+
+					return std::min(static_cast<size_t>(index), length); 
+				}; 
+
+				if (evaluatedArgument1->valueType == ValueType::String) {
+					StringValue* evaluatedStringValue = dynamic_cast<StringValue*>(
+						evaluatedArgument1
+					); 
+
+					const size_t length = evaluatedStringValue->length(); 
+					const size_t start = clampIndex(startIndex, length); 
+					const size_t end = std::max(start, clampIndex(endIndex, length)); 
+
+					result = sliceStringValue(evaluatedStringValue, start, end); 
+				}
+				else if (evaluatedArgument1->valueType == ValueType::List) {
+					ListValue* evaluatedListValue = dynamic_cast<ListValue*>(evaluatedArgument1); 
+
+					const size_t length = evaluatedListValue->size(); 
+					const size_t start = clampIndex(startIndex, length); 
+					const size_t end = std::max(start, clampIndex(endIndex, length)); 
+
+					result = evaluatedListValue->slice(start, end); 
+				}
+			}
+		}
+		else if (nativeIndex == 35) { // ord
+			const RuntimeValue* evaluatedArgument1 = arguments[0];
+			const RuntimeValue* evaluatedArgument2 = arguments[1];
+
+			if (evaluatedArgument1->valueType == ValueType::String 
+				&& evaluatedArgument2->valueType == ValueType::Number) 
+			{
+				const StringValue* evaluatedStringValue = dynamic_cast<const StringValue*>(
+					evaluatedArgument1
+				); 
+				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
+					evaluatedArgument2
+				); 
+
+				const size_t chrIndex = static_cast<size_t>(evaluatedNumValue->toInteger()); 
+
+				if (chrIndex < evaluatedStringValue->length()) {
+					NumValue* numberValue = globalMemory->create<NumValue>(); 
+
+					numberValue->setInteger(static_cast<unsigned char>(
+						evaluatedStringValue->data()[chrIndex]
+					)); 
+					result = numberValue; 
+				}
+			}
+		}
+		else if (nativeIndex == 36) { // chr
+			const RuntimeValue* evaluatedArgument = arguments[0];
+
+			if (evaluatedArgument->valueType == ValueType::Number) {
+				const double code = dynamic_cast<const NumValue*>(evaluatedArgument)->value; 
+
+				if (code >= 0.0 && code < 256.0)
+					result = internChrValue(static_cast<char>(static_cast<int>(code))); 
+			}
+		}
+
+
+		return result; 
+	}
+}
\ No newline at end of file
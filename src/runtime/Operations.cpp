@@ -0,0 +1,604 @@
+#include "../../hdr/runtime/Operations.hpp"
+#include "../../hdr/util/CheckedInteger.hpp"
+#include "../../hdr/util/Error.hpp"
+
+#include <cmath>
+#include <cstring>
+
+namespace ns {
+	const char* binaryOperationNames[] = {
+		"+", "-", "*", "/", "%", "**", "==", "!=", ">", "<", ">=", "<=", "&&", "||"
+	}; 
+
+	RuntimeValue* evaluateUnaryValue(RuntimeValue* nodeEvaluated, const std::string& operation) {
+		if (nodeEvaluated->valueType == ValueType::Number) {
+			// Fields are updated in place like noodles, as accessing one returns its stored value
+			NumValue* numberValue = dynamic_cast<NumValue*>(nodeEvaluated);
+
+			return evaluateNumericUnaryExpr(numberValue, operation);
+		}
+		else if (nodeEvaluated->valueType == ValueType::Bool) {
+			BoolValue* boolValue = dynamic_cast<BoolValue*>(nodeEvaluated); 
+
+			return evaluateConditionalUnaryExpr(boolValue, operation); 
+		}
+
+		return globalMemory->create<NullValue>(); 
+	}
+	RuntimeValue* evaluateNumericUnaryExpr(NumValue* numberValue, const std::string& operation) {
+		double& result = numberValue->value; 
+
+		// Integers are updated exactly, unless they would overflow
+		if (numberValue->integral) {
+			int64_t& integer = numberValue->integer; 
+
+			if (operation == "-" && integer != INT64_MIN) {
+				NumValue* numberValueResult = globalMemory->create<NumValue>(); 
+				numberValueResult->setInteger(-integer); 
+				return numberValueResult; 
+			}
+			else if (operation == "++" && integer != INT64_MAX) {
+				numberValue->setInteger(integer + 1); 
+				return numberValue; 
+			}
+			else if (operation == "--" && integer != INT64_MIN) {
+				numberValue->setInteger(integer - 1); 
+				return numberValue; 
+			}
+
+			numberValue->integral = false; 
+		}
+
+		if (operation == "-") {
+			NumValue* numberValueResult = globalMemory->create<NumValue>(); 
+			numberValueResult->value = -result;
+			return numberValueResult; 
+		}
+		else if (operation == "++")
+			result += 1.0;
+		else if (operation == "--")
+			result -= 1.0; 
+
+		return numberValue; 
+	}
+	RuntimeValue* evaluateConditionalUnaryExpr(BoolValue* boolValue, const std::string& operation) {
+		bool& state = boolValue->state; 
+
+		if (operation == "!") {
+			BoolValue* boolValueResult = globalMemory->create<BoolValue>(); 
+			boolValueResult->state = !state; 
+			return boolValueResult; 
+		}
+
+		return globalMemory->create<NullValue>();
+	}
+	RuntimeValue* evaluateBinaryValues(
+		RuntimeValue* leftNodeEvaluated, RuntimeValue* rightNodeEvaluated, 
+		const std::string& operation) 
+	{
+		const ValueType leftNodeValueType = leftNodeEvaluated->valueType; 
+		const ValueType rightNodeValueType = rightNodeEvaluated->valueType; 
+
+		// Evaluates numeric binary expressions
+		if (leftNodeValueType == ValueType::Number && rightNodeValueType == ValueType::Number) {
+			NumValue* leftNumValue = dynamic_cast<NumValue*>(leftNodeEvaluated);
+			NumValue* rightNumValue = dynamic_cast<NumValue*>(rightNodeEvaluated);
+
+			return evaluateNumericBinaryExpr(
+				leftNumValue, rightNumValue, operation
+			);
+		}
+		// Evaluates conditional binary expressions
+		else if (leftNodeValueType == ValueType::Bool && rightNodeValueType == ValueType::Bool) {
+			BoolValue* leftBoolValue = dynamic_cast<BoolValue*>(leftNodeEvaluated); 
+			BoolValue* rightBoolValue = dynamic_cast<BoolValue*>(rightNodeEvaluated); 
+
+			return evaluateConditionalBinaryExpr(
+				leftBoolValue, rightBoolValue, operation
+			);
+		}
+		// Evaluates string binary expressions
+		else if (leftNodeValueType == ValueType::String 
+			&& rightNodeValueType == ValueType::String) 
+		{
+			StringValue* leftStringValue = dynamic_cast<StringValue*>(leftNodeEvaluated); 
+			StringValue* rightStringValue = dynamic_cast<StringValue*>(rightNodeEvaluated); 
+
+			return evaluateStringBinaryExpr(
+				leftStringValue, rightStringValue, operation
+			); 
+		}
+
+		return globalMemory->create<NullValue>();
+	}
+	RuntimeValue* evaluateNumericBinaryExpr(
+		NumValue* leftNumValue, NumValue* rightNumValue, const std::string& operation)
+	{
+		if (leftNumValue->integral && rightNumValue->integral) {
+			RuntimeValue* integerResult = evaluateIntegerBinaryExpr(
+				leftNumValue->integer, rightNumValue->integer, operation
+			); 
+
+			if (integerResult != nullptr)
+				return integerResult; 
+		}
+
+		RuntimeValue* result = globalMemory->create<NullValue>(); 
+
+		if (operation == "+") {
+			NumValue* numberResult = globalMemory->create<NumValue>(); 
+			numberResult->value = leftNumValue->value + rightNumValue->value;
+			result = numberResult; 
+		}
+		else if (operation == "-") {
+			NumValue* numberResult = globalMemory->create<NumValue>();
+			numberResult->value = leftNumValue->value - rightNumValue->value;
+			result = numberResult;
+		}
+		else if (operation == "*") {
+			NumValue* numberResult = globalMemory->create<NumValue>();
+			numberResult->value = leftNumValue->value * rightNumValue->value;
+			result = numberResult;
+		}
+		else if (operation == "/") {
+			NumValue* numberResult = globalMemory->create<NumValue>();
+
+			// Check if denominator is zero. If so, just return zero
+			if (rightNumValue->value == 0.0) {
+				numberResult = globalMemory->create<NumValue>();
+				numberResult->value = 0.0;
+			}
+			else {
+				numberResult = globalMemory->create<NumValue>();
+				numberResult->value = leftNumValue->value / rightNumValue->value;
+			}
+
+			result = numberResult;
+		}
+		else if (operation == "%") {
+			NumValue* numberResult = globalMemory->create<NumValue>();
+
+			// Check if denominator is zero. If so, just return zero
+			if (rightNumValue->value == 0.0) numberResult->value = 0.0;
+			else numberResult->value = std::fmod(leftNumValue->value, rightNumValue->value);
+
+			result = numberResult;
+		} 
+		else if (operation == "==") {
+			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
+			boolResult->state = leftNumValue->value == rightNumValue->value;
+			result = boolResult; 
+		}
+		else if (operation == "!=") {
+			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
+			boolResult->state = leftNumValue->value != rightNumValue->value; 
+			result = boolResult; 
+		}
+		else if (operation == ">") {
+			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
+			boolResult->state = leftNumValue->value > rightNumValue->value; 
+			result = boolResult; 
+		}
+		else if (operation == "<") {
+			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
+			boolResult->state = leftNumValue->value < rightNumValue->value; 
+			result = boolResult; 
+		}
+		else if (operation == ">=") {
+			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
+			boolResult->state = leftNumValue->value >= rightNumValue->value; 
+			result = boolResult; 
+		}
+		else if (operation == "<=") {
+			BoolValue* boolResult = globalMemory->create<BoolValue>();
+			boolResult->state = leftNumValue->value <= rightNumValue->value;
+			result = boolResult;
+		}
+		else if (operation == "**") {
+			NumValue* numberResult = globalMemory->create<NumValue>(); 
+			raiseNumber(leftNumValue, rightNumValue, numberResult); 
+			result = numberResult; 
+		}
+
+		return result;
+	}
+	RuntimeValue* evaluateIntegerBinaryExpr(int64_t left, int64_t right, const std::string& operation) {
+		int64_t integer = 0; 
+		bool overflow = false; 
+
+		if (operation == "+")
+			overflow = !checkedAdd(left, right, integer); 
+		else if (operation == "-")
+			overflow = !checkedSubtract(left, right, integer); 
+		else if (operation == "*")
+			overflow = !checkedMultiply(left, right, integer); 
+		else if (operation == "%")
+			integer = integerRemainder(left, right); 
+		else {
+			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
+
+			if (operation == "==") boolResult->state = left == right; 
+			else if (operation == "!=") boolResult->state = left != right; 
+			else if (operation == ">") boolResult->state = left > right; 
+			else if (operation == "<") boolResult->state = left < right; 
+			else if (operation == ">=") boolResult->state = left >= right; 
+			else if (operation == "<=") boolResult->state = left <= right; 
+			// Division produces doubles, and powers are raised by raiseNumber
+			else return nullptr; 
+
+			return boolResult; 
+		}
+
+		// Results that overflow are promoted to doubles
+		if (overflow)
+			return nullptr; 
+
+		NumValue* numberResult = globalMemory->create<NumValue>(); 
+		numberResult->setInteger(integer); 
+		return numberResult; 
+	}
+	RuntimeValue* evaluateConditionalBinaryExpr(
+		BoolValue* leftBoolValue, BoolValue* rightBoolValue, const std::string& operation) 
+	{
+		BoolValue* result = globalMemory->create<BoolValue>(); 
+		
+		if (operation == "&&")
+			result->state = leftBoolValue->state && rightBoolValue->state;
+		else if (operation == "||")
+			result->state = leftBoolValue->state || rightBoolValue->state; 
+		 
+		return result;
+	}
+	RuntimeValue* evaluateStringBinaryExpr(
+		StringValue* leftStringValue, StringValue* rightStringValue, 
+		const std::string& operation) 
+	{
+		RuntimeValue* result = globalMemory->create<NullValue>();
+
+		if (operation == "+") 
+			result = concatStringValues(leftStringValue, rightStringValue); 
+		else if (operation == "==") {
+			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
+			boolResult->state = equalStringValues(leftStringValue, rightStringValue); 
+			result = boolResult; 
+		}
+		else if (operation == "!=") {
+			BoolValue* boolResult = globalMemory->create<BoolValue>();
+			boolResult->state = !equalStringValues(leftStringValue, rightStringValue);
+			result = boolResult;
+		}
+
+		return result; 
+	}
+	bool equalStringValues(const StringValue* leftStringValue, const StringValue* rightStringValue) {
+		// Interned strings are equal only if they're the same value
+		if (leftStringValue->interned && rightStringValue->interned)
+			return leftStringValue == rightStringValue; 
+
+		// Strings of different lengths can be compared without flattening either rope
+		return leftStringValue->length() == rightStringValue->length()
+			&& std::memcmp(
+				leftStringValue->data(), rightStringValue->data(), leftStringValue->length()
+			) == 0; 
+	}
+	bool compareNumbers(
+		const NumValue* leftNumValue, const NumValue* rightNumValue, BinaryOperation operation)
+	{
+		if (leftNumValue->integral && rightNumValue->integral) {
+			const int64_t left = leftNumValue->integer;
+			const int64_t right = rightNumValue->integer;
+
+			switch (operation) {
+			case BinaryOperation::Equal: return left == right;
+			case BinaryOperation::NotEqual: return left != right;
+			case BinaryOperation::Greater: return left > right;
+			case BinaryOperation::Less: return left < right;
+			case BinaryOperation::GreaterEqual: return left >= right;
+			default: return left <= right;
+			}
+		}
+
+		const double left = leftNumValue->value;
+		const double right = rightNumValue->value;
+
+		switch (operation) {
+		case BinaryOperation::Equal: return left == right;
+		case BinaryOperation::NotEqual: return left != right;
+		case BinaryOperation::Greater: return left > right;
+		case BinaryOperation::Less: return left < right;
+		case BinaryOperation::GreaterEqual: return left >= right;
+		default: return left <= right;
+		}
+	}
+	RuntimeValue* evaluateNumberOperation(
+		const NumValue* leftNumValue, const NumValue* rightNumValue, BinaryOperation operation)
+	{
+		auto createNumber = [](double number) -> RuntimeValue* {
+			NumValue* numberValue = globalMemory->create<NumValue>();
+			numberValue->value = number;
+			return numberValue;
+		};
+		auto createInteger = [](int64_t integer) -> RuntimeValue* {
+			NumValue* numberValue = globalMemory->create<NumValue>();
+			numberValue->setInteger(integer);
+			return numberValue;
+		};
+		auto createBool = [](bool state) -> RuntimeValue* {
+			BoolValue* boolValue = globalMemory->create<BoolValue>();
+			boolValue->state = state;
+			return boolValue;
+		};
+
+		// Integers stay exact, unless the result overflows or isn't an integer
+		if (leftNumValue->integral && rightNumValue->integral) {
+			const int64_t left = leftNumValue->integer;
+			const int64_t right = rightNumValue->integer;
+			int64_t integer;
+
+			switch (operation) {
+			case BinaryOperation::Add:
+				if (checkedAdd(left, right, integer)) return createInteger(integer);
+				break;
+			case BinaryOperation::Subtract:
+				if (checkedSubtract(left, right, integer)) return createInteger(integer);
+				break;
+			case BinaryOperation::Multiply:
+				if (checkedMultiply(left, right, integer)) return createInteger(integer);
+				break;
+			case BinaryOperation::Modulo:
+				return createInteger(integerRemainder(left, right));
+			case BinaryOperation::Equal: return createBool(left == right);
+			case BinaryOperation::NotEqual: return createBool(left != right);
+			case BinaryOperation::Greater: return createBool(left > right);
+			case BinaryOperation::Less: return createBool(left < right);
+			case BinaryOperation::GreaterEqual: return createBool(left >= right);
+			case BinaryOperation::LessEqual: return createBool(left <= right);
+			default:
+				break;
+			}
+		}
+
+		const double left = leftNumValue->value;
+		const double right = rightNumValue->value;
+
+		switch (operation) {
+		case BinaryOperation::Add: return createNumber(left + right);
+		case BinaryOperation::Subtract: return createNumber(left - right);
+		case BinaryOperation::Multiply: return createNumber(left * right);
+		// Dividing by zero results in zero
+		case BinaryOperation::Divide: return createNumber(right == 0.0 ? 0.0 : left / right);
+		case BinaryOperation::Modulo:
+			return createNumber(right == 0.0 ? 0.0 : std::fmod(left, right));
+		case BinaryOperation::Power:
+		{
+			NumValue* power = globalMemory->create<NumValue>();
+			raiseNumber(leftNumValue, rightNumValue, power);
+			return power;
+		}
+		case BinaryOperation::Equal: return createBool(left == right);
+		case BinaryOperation::NotEqual: return createBool(left != right);
+		case BinaryOperation::Greater: return createBool(left > right);
+		case BinaryOperation::Less: return createBool(left < right);
+		case BinaryOperation::GreaterEqual: return createBool(left >= right);
+		case BinaryOperation::LessEqual: return createBool(left <= right);
+		default:
+			return globalMemory->create<NullValue>();
+		}
+	}
+	void raiseNumber(const NumValue* base, const NumValue* exponent, NumValue* power) {
+		// Integers raised to whole powers are squared and multiplied out, unless the power overflows
+		if (base->integral && exponent->integral && exponent->integer >= 0) {
+			int64_t integer = 1; 
+			int64_t factor = base->integer; 
+			int64_t remainingExponent = exponent->integer; 
+			bool exact = true; 
+
+			while (remainingExponent > 0 && exact) {
+				if (remainingExponent & 1)
+					exact = checkedMultiply(integer, factor, integer); 
+
+				remainingExponent >>= 1; 
+
+				if (remainingExponent > 0 && exact)
+					exact = checkedMultiply(factor, factor, factor); 
+			}
+
+			if (exact) {
+				power->setInteger(integer); 
+				return; 
+			}
+		}
+
+		power->integral = false; 
+
+		if (exponent->integral && exponent->integer == 0)
+			power->value = 1.0; 
+		else if (exponent->integral && exponent->integer == 1)
+			power->value = base->value; 
+		else
+			power->value = std::pow(base->value, exponent->value); 
+	}
+	DishValue* createDishValue(
+		const DishShape* dishShape, RuntimeValue* const* arguments, size_t argumentCount) 
+	{
+		if (argumentCount > dishShape->fields.size()) {
+			throw Error(
+				Error::Location::Interpreter,
+				14,
+				"Cannot create dish " + dishShape->name + " with " + std::to_string(argumentCount) 
+					+ (argumentCount == 1 ? " argument" : " arguments")
+			);
+		}
+
+		DishValue* dishValue = globalMemory->create<DishValue>(); 
+
+		dishValue->shape = dishShape; 
+		dishValue->slots.reserve(dishShape->fields.size()); 
+
+		// Arguments fill fields in order, and the remaining fields use their default values
+		for (size_t slot = 0; slot < dishShape->fields.size(); slot++) {
+			if (slot < argumentCount) {
+				dishValue->slots.push_back(cloneRuntimeValue(arguments[slot])); 
+			}
+			else {
+				RuntimeValue* defaultValue = dishShape->evaluateDefault(dishShape, slot); 
+
+				dishValue->slots.push_back(defaultValue != nullptr 
+					? cloneRuntimeValue(defaultValue) : globalMemory->create<NullValue>()); 
+			}
+		}
+
+		return dishValue; 
+	}
+	DishValue* resolveDishField(
+		RuntimeValue* object, const std::string& field, const DishShape*& cachedShape, 
+		int& cachedSlot) 
+	{
+		if (object->valueType != ValueType::Dish) {
+			throw Error(
+				Error::Location::Interpreter,
+				17,
+				"Cannot access field " + field + " of a value that isn't a dish"
+			); 
+		}
+
+		DishValue* dishValue = dynamic_cast<DishValue*>(object); 
+
+		// Dishes of the cached shape store the field at the cached slot, so the field's name is 
+		// only looked up when the access site sees a new shape
+		if (dishValue->shape != cachedShape) {
+			const int foundSlot = dishValue->shape->findSlot(field); 
+
+			if (foundSlot == -1) {
+				throw Error(
+					Error::Location::Interpreter,
+					18,
+					"Dish " + dishValue->shape->name + " has no field " + field
+				); 
+			}
+
+			cachedShape = dishValue->shape; 
+			cachedSlot = foundSlot; 
+		}
+
+		return dishValue; 
+	}
+	bool takesOtherArgumentCount(const RuntimeValue* callee, size_t argumentCount) {
+		if (callee->valueType != ValueType::FuncValue)
+			return false; 
+
+		const FuncValue* funcValue = static_cast<const FuncValue*>(callee); 
+
+		return !funcValue->nativeFunc && funcValue->dishShape == nullptr 
+			&& funcValue->parameters.size() != argumentCount; 
+	}
+	void throwLoopConditionError() {
+		throw Error(
+			Error::Location::Interpreter,
+			27,
+			"Cannot keep looping on a while condition that isn't a bool"
+		); 
+	}
+	void prepareRange(RuntimeValue*& start, RuntimeValue*& end, RuntimeValue*& step) {
+		if (start->valueType != ValueType::Number || end->valueType != ValueType::Number
+			|| step->valueType != ValueType::Number)
+		{
+			throw Error(
+				Error::Location::Interpreter,
+				24,
+				"Cannot count over a range whose start, end and step aren't all numbers"
+			); 
+		}
+
+		if (dynamic_cast<const NumValue*>(step)->value == 0.0) {
+			throw Error(
+				Error::Location::Interpreter,
+				25,
+				"Cannot count over a range with a step of 0"
+			); 
+		}
+
+		start = cloneRuntimeValue(start); 
+		end = cloneRuntimeValue(end); 
+		step = cloneRuntimeValue(step); 
+	}
+	bool advanceRange(
+		RuntimeValue*& noodleValue, RuntimeValue*& ownedValue, NumValue* count, 
+		const NumValue* end, const NumValue* step) 
+	{
+		const BinaryOperation comparison = step->value > 0.0 
+			? BinaryOperation::Less : BinaryOperation::Greater; 
+
+		if (!compareNumbers(count, end, comparison))
+			return false; 
+
+		if (noodleValue != ownedValue) {
+			ownedValue = globalMemory->create<NumValue>(); 
+			noodleValue = ownedValue; 
+		}
+
+		NumValue* numValue = static_cast<NumValue*>(ownedValue); 
+		int64_t integer; 
+
+		numValue->value = count->value; 
+		numValue->integral = count->integral; 
+		numValue->integer = count->integer; 
+
+		// Integers that would overflow continue counting as doubles
+		if (count->integral && step->integral 
+			&& checkedAdd(count->integer, step->integer, integer))
+		{
+			count->setInteger(integer); 
+		}
+		else
+			count->setNumber(count->value + step->value); 
+
+		return true; 
+	}
+	ListValue* expectIterable(RuntimeValue* iterable) {
+		if (iterable->valueType != ValueType::List) {
+			throw Error(
+				Error::Location::Interpreter,
+				26,
+				"Cannot loop over the elements of a value that isn't a list"
+			); 
+		}
+
+		return static_cast<ListValue*>(iterable); 
+	}
+	bool advanceElement(
+		RuntimeValue*& noodleValue, RuntimeValue*& ownedValue, const ListValue* list, 
+		int64_t& index) 
+	{
+		if (index >= static_cast<int64_t>(list->size()))
+			return false; 
+
+		RuntimeValue* element = list->isNumeric() ? nullptr : list->at(index); 
+
+		if (element != nullptr && element->valueType != ValueType::Number) {
+			noodleValue = cloneRuntimeValue(element); 
+			ownedValue = nullptr; 
+		}
+		else {
+			if (noodleValue != ownedValue) {
+				ownedValue = globalMemory->create<NumValue>(); 
+				noodleValue = ownedValue; 
+			}
+
+			NumValue* numValue = static_cast<NumValue*>(ownedValue); 
+
+			if (element == nullptr)
+				list->numberAt(index).unbox(numValue); 
+			else {
+				const NumValue* number = static_cast<const NumValue*>(element); 
+
+				numValue->value = number->value; 
+				numValue->integral = number->integral; 
+				numValue->integer = number->integer; 
+			}
+		}
+
+		index++; 
+		return true; 
+	}
+}
\ No newline at end of file
@@ -0,0 +1,1691 @@
+#include "../../hdr/runtime/Optimizer.hpp"
+#include "../../hdr/runtime/Natives.hpp"
+#include "../../hdr/util/Error.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace ns {
+	namespace {
+		// Calls the functions with each expression and list of statements nested directly in
+		// the statement, which they can replace
+		template <typename ExprFunction, typename StatementsFunction>
+		void forEachChild(
+			Statement* statement, ExprFunction onExpr, StatementsFunction onStatements)
+		{
+			switch (statement->nodeType) {
+			case NodeType::Program:
+				onStatements(dynamic_cast<Program*>(statement)->statements);
+				break;
+			case NodeType::VarDeclaration:
+				onExpr(dynamic_cast<VarDeclaration*>(statement)->expr);
+				break;
+			case NodeType::FuncDeclaration:
+				onStatements(dynamic_cast<FuncDeclaration*>(statement)->statements);
+				break;
+			case NodeType::DishDeclaration:
+				for (auto* field : dynamic_cast<DishDeclaration*>(statement)->fields)
+					onExpr(field->expr);
+
+				break;
+			case NodeType::IfStatement:
+			{
+				IfStatement* ifStatement = dynamic_cast<IfStatement*>(statement);
+
+				onExpr(ifStatement->condition);
+				onStatements(ifStatement->ifStatements);
+				onStatements(ifStatement->elseStatements);
+				break;
+			}
+			case NodeType::WhileStatement:
+			{
+				WhileStatement* whileStatement = dynamic_cast<WhileStatement*>(statement);
+
+				onExpr(whileStatement->condition);
+				onStatements(whileStatement->statements);
+				break;
+			}
+			case NodeType::ForStatement:
+			{
+				ForStatement* forStatement = dynamic_cast<ForStatement*>(statement);
+
+				if (forStatement->iterable != nullptr)
+					onExpr(forStatement->iterable);
+				else {
+					onExpr(forStatement->start);
+					onExpr(forStatement->end);
+					onExpr(forStatement->step);
+				}
+
+				onStatements(forStatement->statements);
+				break;
+			}
+			case NodeType::ReturnStatement:
+				onExpr(dynamic_cast<ReturnStatement*>(statement)->expr);
+				break;
+			case NodeType::ListLiteral:
+				for (auto& element : dynamic_cast<ListLiteral*>(statement)->elements)
+					onExpr(element);
+
+				break;
+			case NodeType::FieldAccesser:
+				onExpr(dynamic_cast<FieldAccesser*>(statement)->object);
+				break;
+			case NodeType::UnaryExpr:
+				onExpr(dynamic_cast<UnaryExpr*>(statement)->expr);
+				break;
+			case NodeType::BinaryExpr:
+			{
+				BinaryExpr* binaryExpr = dynamic_cast<BinaryExpr*>(statement);
+
+				onExpr(binaryExpr->leftExpr);
+				onExpr(binaryExpr->rightExpr);
+				break;
+			}
+			case NodeType::AssignmentExpr:
+			{
+				AssignmentExpr* assignmentExpr = dynamic_cast<AssignmentExpr*>(statement);
+
+				onExpr(assignmentExpr->assigne);
+				onExpr(assignmentExpr->value);
+				break;
+			}
+			case NodeType::FuncCall:
+				for (auto& argument : dynamic_cast<FuncCall*>(statement)->arguments)
+					onExpr(argument);
+
+				break;
+			case NodeType::InlinedCall:
+			{
+				InlinedCall* inlinedCall = dynamic_cast<InlinedCall*>(statement);
+
+				for (auto& argument : inlinedCall->arguments)
+					onExpr(argument);
+
+				onStatements(inlinedCall->statements);
+				break;
+			}
+			default:
+				break;
+			}
+		}
+		bool isExpression(const Statement* statement) {
+			return statement->nodeType >= NodeType::NullLiteral;
+		}
+		// Natives are looked up by their index in nativeFuncNames
+		bool readsArguments(int nativeIndex) {
+			switch (nativeIndex) {
+			case 0: case 3: case 4: case 5: case 6: case 7: case 8: case 9: case 10: case 11: 
+			case 13: case 16: case 18: case 23: case 25: case 26: case 27: case 28: case 30: 
+			case 31: case 32: case 33: case 34: case 35: case 36:
+				return true;
+			default:
+				return false;
+			}
+		}
+		// append, set, pop, prepend, popFront, insert, remove and add
+		bool modifiesArgument(int nativeIndex) {
+			switch (nativeIndex) {
+			case 12: case 14: case 15: case 19: case 20: case 22: case 24: case 29:
+				return true;
+			default:
+				return false;
+			}
+		}
+		// set, pop and remove only use their second argument to find what to change in their 
+		// first, so it isn't stored
+		bool storesArgument(int nativeIndex, size_t argumentIndex) {
+			return argumentIndex != 1 
+				|| (nativeIndex != 14 && nativeIndex != 15 && nativeIndex != 24);
+		}
+		// Only literals and operations result in a value no one else holds
+		bool createsValue(const Expr* expr) {
+			switch (expr->nodeType) {
+			case NodeType::NullLiteral:
+			case NodeType::NumLiteral:
+			case NodeType::StringLiteral:
+			case NodeType::ListLiteral:
+			case NodeType::BinaryExpr:
+				return true;
+			case NodeType::UnaryExpr:
+			{
+				const std::string& operation = dynamic_cast<const UnaryExpr*>(expr)->operation;
+				return operation == "-" || operation == "!";
+			}
+			default:
+				return false;
+			}
+		}
+		// floor, ceil, round, pow, sqrt, len, at, abs, lookup, contains and has, whose result
+		// only depends on their arguments
+		bool computesResult(int nativeIndex) {
+			switch (nativeIndex) {
+			case 3: case 4: case 5: case 9: case 10: case 11: case 13: case 16: case 23: case 25: 
+			case 30:
+				return true;
+			default:
+				return false;
+			}
+		}
+
+		// Whether the statement or any nested in it matches the predicate
+		template <typename Predicate>
+		bool containsNode(Statement* statement, Predicate predicate) {
+			bool found = predicate(statement);
+
+			forEachChild(
+				statement,
+				[&](Expr*& expr) { found = found || containsNode(expr, predicate); },
+				[&](std::vector<Statement*>& statements) {
+					for (auto* nestedStatement : statements)
+						found = found || containsNode(nestedStatement, predicate);
+				}
+			);
+			return found;
+		}
+		// Whether a break, continue or return statement is nested in the statement, so the
+		// statements after it may not be evaluated
+		bool transfersControl(Statement* statement) {
+			return containsNode(statement, [](Statement* node) -> bool {
+				return node->nodeType == NodeType::BreakStatement
+					|| node->nodeType == NodeType::ContinueStatement
+					|| node->nodeType == NodeType::ReturnStatement;
+			});
+		}
+	}
+
+	Optimizer::LoopEffects::LoopEffects() 
+		: changesSharedValues(false), changesSharedNumbers(false), callsRecipes(false) 
+	{
+	}
+
+	Optimizer::Optimizer(bool shouldInline, bool shouldHoist, bool shouldSimplify, bool shouldPrune) :
+		shouldInline(shouldInline),
+		shouldHoist(shouldHoist),
+		shouldSimplify(shouldSimplify),
+		shouldPrune(shouldPrune),
+		prunedNodeCount(0)
+	{
+	}
+
+	void Optimizer::optimizeProgram(Program* program) {
+		declarationCounts.clear();
+		assignedNames.clear();
+		inlinedRecipes.clear();
+		sharedNames.clear();
+		hoistedExprs.clear();
+		pureNames.clear();
+		prunedNodeCount = 0;
+		countDeclarations(program);
+		verifyPureRecipes(program);
+
+		// Each statement only has calls to the recipes declared before it inlined
+		for (auto& statement : program->statements) {
+			if (!shouldInline)
+				break;
+
+			statement = inlineStatement(statement);
+
+			if (statement->nodeType != NodeType::FuncDeclaration)
+				continue;
+
+			FuncDeclaration* funcDeclaration = dynamic_cast<FuncDeclaration*>(statement);
+
+			if (!isInlinable(funcDeclaration))
+				continue;
+
+			InlinedRecipe& inlinedRecipe = inlinedRecipes[funcDeclaration->name];
+			std::unordered_map<std::string, std::string> renamedNames;
+
+			for (auto& parameter : funcDeclaration->parameters) {
+				inlinedRecipe.parameters.push_back(
+					renameParameter(funcDeclaration->name, parameter)
+				);
+				renamedNames[parameter] = inlinedRecipe.parameters.back();
+			}
+			for (auto* bodyStatement : funcDeclaration->statements)
+				inlinedRecipe.statements.push_back(cloneStatement(bodyStatement, renamedNames));
+		}
+
+		// Recipes whose calls were all inlined are no longer referred to
+		if (shouldPrune)
+			pruneProgram(program);
+		if (shouldSimplify)
+			reduceExpressions(program);
+		if (shouldSimplify || shouldHoist)
+			findSharedNames(program);
+		if (shouldSimplify)
+			eliminateCommonExprs(program);
+		if (shouldHoist)
+			hoistInvariants(program);
+	}
+	int Optimizer::getPrunedNodeCount() const {
+		return prunedNodeCount;
+	}
+	std::vector<const Expr*> Optimizer::findCommonExprs(const std::vector<Statement*>& statements) {
+		std::unordered_set<const Statement*> visitedNodes;
+		std::vector<const Expr*> commonExprs;
+
+		for (auto* statement : statements)
+			collectCommonExprs(statement, visitedNodes, commonExprs);
+
+		return commonExprs;
+	}
+
+	void Optimizer::countDeclarations(Statement* statement) {
+		switch (statement->nodeType) {
+		case NodeType::VarDeclaration:
+			declarationCounts[dynamic_cast<VarDeclaration*>(statement)->identifier]++;
+			break;
+		case NodeType::ForStatement:
+			declarationCounts[dynamic_cast<ForStatement*>(statement)->identifier]++;
+			break;
+		case NodeType::FuncDeclaration:
+		{
+			FuncDeclaration* funcDeclaration = dynamic_cast<FuncDeclaration*>(statement);
+
+			declarationCounts[funcDeclaration->name]++;
+
+			for (auto& parameter : funcDeclaration->parameters)
+				declarationCounts[parameter]++;
+
+			break;
+		}
+		case NodeType::DishDeclaration:
+			declarationCounts[dynamic_cast<DishDeclaration*>(statement)->name]++;
+			break;
+		case NodeType::AssignmentExpr:
+		{
+			const Expr* assigne = dynamic_cast<AssignmentExpr*>(statement)->assigne;
+
+			if (assigne->nodeType == NodeType::Identifier)
+				assignedNames.insert(dynamic_cast<const Identifier*>(assigne)->name);
+
+			break;
+		}
+		case NodeType::UnaryExpr:
+		{
+			const UnaryExpr* unaryExpr = dynamic_cast<UnaryExpr*>(statement);
+
+			if (unaryExpr->expr->nodeType == NodeType::Identifier
+				&& (unaryExpr->operation == "++" || unaryExpr->operation == "--"))
+			{
+				assignedNames.insert(dynamic_cast<const Identifier*>(unaryExpr->expr)->name);
+			}
+
+			break;
+		}
+		default:
+			break;
+		}
+
+		forEachChild(
+			statement,
+			[&](Expr*& expr) { countDeclarations(expr); },
+			[&](std::vector<Statement*>& statements) {
+				for (auto* nestedStatement : statements)
+					countDeclarations(nestedStatement);
+			}
+		);
+	}
+	void Optimizer::inlineStatements(std::vector<Statement*>& statements) {
+		for (auto& statement : statements)
+			statement = inlineStatement(statement);
+	}
+	Statement* Optimizer::inlineStatement(Statement* statement) {
+		// serveRaw prints the source of its arguments, so they're left as they were written
+		if (statement->nodeType == NodeType::FuncCall
+			&& dynamic_cast<FuncCall*>(statement)->caller == nativeFuncNames[1])
+		{
+			return statement;
+		}
+
+		forEachChild(
+			statement,
+			[&](Expr*& expr) { expr = dynamic_cast<Expr*>(inlineStatement(expr)); },
+			[&](std::vector<Statement*>& statements) { inlineStatements(statements); }
+		);
+
+		if (statement->nodeType != NodeType::FuncCall)
+			return statement;
+
+		FuncCall* funcCall = dynamic_cast<FuncCall*>(statement);
+		auto inlinedRecipe = inlinedRecipes.find(funcCall->caller);
+
+		// Calls with too few arguments throw, and extra arguments aren't evaluated by the tree
+		// walker, so both are left to the call
+		if (inlinedRecipe == inlinedRecipes.end()
+			|| funcCall->arguments.size() != inlinedRecipe->second.parameters.size())
+		{
+			return statement;
+		}
+
+		InlinedCall* inlinedCall = new InlinedCall();
+
+		inlinedCall->caller = funcCall->caller;
+		inlinedCall->arguments = funcCall->arguments;
+		inlinedCall->parameters = inlinedRecipe->second.parameters;
+
+		// Each call gets its own copy, so the caches in its nodes only see its operands
+		for (auto* bodyStatement : inlinedRecipe->second.statements)
+			inlinedCall->statements.push_back(cloneStatement(bodyStatement, {}));
+
+		return inlinedCall;
+	}
+	bool Optimizer::isInlinable(FuncDeclaration* funcDeclaration) {
+		if (funcDeclaration->nativeFunc || declarationCounts[funcDeclaration->name] != 1
+			|| assignedNames.count(funcDeclaration->name) || isNativeName(funcDeclaration->name))
+		{
+			return false;
+		}
+
+		int nodeCount = 0;
+
+		for (auto* statement : funcDeclaration->statements) {
+			nodeCount += countNodes(statement);
+
+			const bool blocksInlining = containsNode(statement, [&](Statement* node) -> bool {
+				switch (node->nodeType) {
+				case NodeType::VarDeclaration:
+				case NodeType::ForStatement:
+				case NodeType::FuncDeclaration:
+				case NodeType::DishDeclaration:
+				// Returning would leave the recipe the call is inlined into
+				case NodeType::ReturnStatement:
+					return true;
+				// Recipes called by the body would see its parameters in their caller's scope
+				case NodeType::FuncCall:
+				{
+					const std::string& caller = dynamic_cast<const FuncCall*>(node)->caller;
+					return !isNativeName(caller) || caller == nativeFuncNames[1];
+				}
+				default:
+					return false;
+				}
+			});
+
+			if (blocksInlining)
+				return false;
+		}
+
+		return nodeCount <= inlinedNodeLimit;
+	}
+	bool Optimizer::isNativeName(const std::string& name) const {
+		return findNativeFunc(name) != -1 && declarationCounts.count(name) == 0;
+	}
+
+	void Optimizer::verifyPureRecipes(Program* program) {
+		const bool declaresPureRecipes = containsNode(program, [](Statement* node) -> bool {
+			return node->nodeType == NodeType::FuncDeclaration
+				&& dynamic_cast<FuncDeclaration*>(node)->pure;
+		});
+
+		if (!declaresPureRecipes)
+			return;
+
+		// Frozen noodles can't be changed through their own name, so they only change when
+		// another noodle holding their value is
+		findSharedNames(program);
+
+		for (auto* statement : program->statements) {
+			if (statement->nodeType == NodeType::FuncDeclaration) {
+				const FuncDeclaration* funcDeclaration = dynamic_cast<FuncDeclaration*>(statement);
+
+				if (funcDeclaration->pure && declarationCounts[funcDeclaration->name] == 1)
+					pureNames.insert(funcDeclaration->name);
+			}
+			else if (statement->nodeType == NodeType::VarDeclaration) {
+				const VarDeclaration* varDeclaration = dynamic_cast<VarDeclaration*>(statement);
+
+				if (varDeclaration->constant && declarationCounts[varDeclaration->identifier] == 1
+					&& !sharedNames.count(varDeclaration->identifier))
+				{
+					pureNames.insert(varDeclaration->identifier);
+				}
+			}
+		}
+
+		containsNode(program, [&](Statement* node) -> bool {
+			if (node->nodeType == NodeType::FuncDeclaration
+				&& dynamic_cast<FuncDeclaration*>(node)->pure)
+			{
+				verifyPureRecipe(dynamic_cast<FuncDeclaration*>(node));
+			}
+
+			return false;
+		});
+
+		// Inlining changes which noodles are shared, so they're found again once it's done
+		sharedNames.clear();
+	}
+	void Optimizer::verifyPureRecipe(const FuncDeclaration* funcDeclaration) {
+		const std::string& recipe = funcDeclaration->name;
+		std::unordered_set<std::string> localNames(
+			funcDeclaration->parameters.begin(), funcDeclaration->parameters.end()
+		);
+
+		auto throwImpure = [&](const std::string& reason) -> void {
+			throw Error(
+				Error::Location::Interpreter,
+				23,
+				"Cannot declare recipe " + recipe + " as pure, as it " + reason
+			);
+		};
+		// Names the recipe reads that always have the same value
+		auto isUnchanging = [&](const std::string& name) -> bool {
+			return localNames.count(name) || pureNames.count(name) || isNativeName(name)
+				|| (name == recipe && declarationCounts[name] == 1)
+				|| ((name == "true" || name == "false" || name == "null")
+					&& declarationCounts.count(name) == 0);
+		};
+
+		// Built-ins can only change values the recipe created itself, held by noodles it only
+		// ever declares and assigns with new values. Parameters and the elements of lists are
+		// held by the caller.
+		std::unordered_set<std::string> createdNames;
+		std::unordered_set<std::string> heldNames(
+			funcDeclaration->parameters.begin(), funcDeclaration->parameters.end()
+		);
+
+		for (auto* statement : funcDeclaration->statements) {
+			containsNode(statement, [&](Statement* node) -> bool {
+				if (node->nodeType == NodeType::VarDeclaration) {
+					const VarDeclaration* varDeclaration = dynamic_cast<VarDeclaration*>(node);
+
+					localNames.insert(varDeclaration->identifier);
+					(createsValue(varDeclaration->expr) ? createdNames : heldNames)
+						.insert(varDeclaration->identifier);
+				}
+				else if (node->nodeType == NodeType::ForStatement) {
+					localNames.insert(dynamic_cast<ForStatement*>(node)->identifier);
+					heldNames.insert(dynamic_cast<ForStatement*>(node)->identifier);
+				}
+				else if (node->nodeType == NodeType::AssignmentExpr) {
+					const AssignmentExpr* assignmentExpr = dynamic_cast<AssignmentExpr*>(node);
+
+					if (assignmentExpr->assigne->nodeType == NodeType::Identifier
+						&& !createsValue(assignmentExpr->value))
+					{
+						heldNames.insert(
+							dynamic_cast<const Identifier*>(assignmentExpr->assigne)->name
+						);
+					}
+				}
+
+				return false;
+			});
+		}
+
+		for (auto* statement : funcDeclaration->statements) {
+			containsNode(statement, [&](Statement* node) -> bool {
+				switch (node->nodeType) {
+				case NodeType::FuncDeclaration:
+					throwImpure("declares recipe " + dynamic_cast<FuncDeclaration*>(node)->name);
+					break;
+				case NodeType::DishDeclaration:
+					throwImpure("declares dish " + dynamic_cast<DishDeclaration*>(node)->name);
+					break;
+				case NodeType::Identifier:
+				{
+					const std::string& name = dynamic_cast<Identifier*>(node)->name;
+
+					if (!isUnchanging(name))
+						throwImpure("reads noodle " + name + ", which could change between calls");
+
+					break;
+				}
+				case NodeType::ListAccesser:
+				{
+					const std::string& name = dynamic_cast<ListAccesser*>(node)->name;
+
+					if (!isUnchanging(name))
+						throwImpure("reads noodle " + name + ", which could change between calls");
+
+					break;
+				}
+				case NodeType::AssignmentExpr:
+				{
+					const Expr* assigne = dynamic_cast<AssignmentExpr*>(node)->assigne;
+
+					if (assigne->nodeType != NodeType::Identifier)
+						throwImpure("assigns a field of a dish its caller could hold");
+					else if (!localNames.count(dynamic_cast<const Identifier*>(assigne)->name)) {
+						throwImpure(
+							"assigns noodle " + dynamic_cast<const Identifier*>(assigne)->name
+								+ ", which it doesn't declare"
+						);
+					}
+
+					break;
+				}
+				case NodeType::UnaryExpr:
+				{
+					const UnaryExpr* unaryExpr = dynamic_cast<UnaryExpr*>(node);
+
+					if (unaryExpr->operation != "++" && unaryExpr->operation != "--")
+						break;
+
+					// Incrementing updates the value in place, which only the recipe holds when it
+					// declared the noodle with a new value. Parameters are always shared.
+					const std::string name = unaryExpr->expr->nodeType == NodeType::Identifier
+						? dynamic_cast<const Identifier*>(unaryExpr->expr)->name : "";
+
+					if (!localNames.count(name) || sharedNames.count(name)) {
+						throwImpure(
+							"updates " + (name.empty() ? "a value" : "noodle " + name)
+								+ " in place, which its caller could hold"
+						);
+					}
+
+					break;
+				}
+				case NodeType::FuncCall:
+				{
+					const FuncCall* funcCall = dynamic_cast<FuncCall*>(node);
+					const std::string& caller = funcCall->caller;
+					const int nativeIndex = isNativeName(caller) ? findNativeFunc(caller) : -1;
+
+					if (nativeIndex == 0 || nativeIndex == 1)
+						throwImpure("serves output with " + caller);
+					else if (nativeIndex == 2)
+						throwImpure("receives input");
+					else if (nativeIndex == 17)
+						throwImpure("reads the clock");
+					else if (nativeIndex != -1 && modifiesArgument(nativeIndex)) {
+						const Expr* argument = funcCall->arguments.empty() 
+							? nullptr : funcCall->arguments[0];
+						const std::string name = argument != nullptr 
+							&& argument->nodeType == NodeType::Identifier
+								? dynamic_cast<const Identifier*>(argument)->name : "";
+
+						if (!createdNames.count(name) || heldNames.count(name)) {
+							throwImpure(
+								"modifies " + (name.empty() ? "a value" : "noodle " + name) + " with "
+									+ caller + ", which its caller could hold"
+							);
+						}
+					}
+					else if (nativeIndex == -1 && (localNames.count(caller) || !isUnchanging(caller)))
+						throwImpure("calls " + caller + ", which isn't a pure recipe");
+
+					break;
+				}
+				default:
+					break;
+				}
+
+				return false;
+			});
+		}
+	}
+
+	void Optimizer::pruneProgram(Program* program) {
+		std::unordered_map<std::string, bool> constantNames;
+
+		for (auto* statement : program->statements) {
+			pruneBranches(statement, constantNames);
+
+			if (statement->nodeType != NodeType::VarDeclaration)
+				continue;
+
+			const VarDeclaration* varDeclaration = dynamic_cast<VarDeclaration*>(statement);
+			const int state = foldCondition(varDeclaration->expr, constantNames);
+
+			if (varDeclaration->constant && declarationCounts[varDeclaration->identifier] == 1 
+				&& state != -1) 
+			{
+				constantNames[varDeclaration->identifier] = state == 1;
+			}
+		}
+
+		pruneUnusedRecipes(program);
+	}
+	void Optimizer::pruneBranches(
+		Statement* statement, const std::unordered_map<std::string, bool>& constantNames)
+	{
+		// The condition is still evaluated, as it could throw, so only the branch that's never 
+		// taken is removed
+		if (statement->nodeType == NodeType::IfStatement) {
+			IfStatement* ifStatement = dynamic_cast<IfStatement*>(statement);
+			const int state = foldCondition(ifStatement->condition, constantNames);
+
+			if (state == 1)
+				removeStatements(ifStatement->elseStatements);
+			else if (state == 0)
+				removeStatements(ifStatement->ifStatements);
+		}
+
+		forEachChild(
+			statement,
+			[&](Expr*& expr) { pruneBranches(expr, constantNames); },
+			[&](std::vector<Statement*>& statements) {
+				for (auto* nestedStatement : statements)
+					pruneBranches(nestedStatement, constantNames);
+			}
+		);
+	}
+	void Optimizer::pruneUnusedRecipes(Program* program) {
+		std::unordered_map<std::string, const FuncDeclaration*> unusedRecipes;
+		std::unordered_set<std::string> referencedNames;
+		std::vector<Statement*> reachedStatements;
+
+		// The last statement is the program's value, and names the global scope already has
+		// would throw when declared again
+		for (size_t statementIndex = 0; statementIndex < program->statements.size(); 
+			statementIndex++) 
+		{
+			Statement* statement = program->statements[statementIndex];
+			const FuncDeclaration* funcDeclaration = dynamic_cast<FuncDeclaration*>(statement);
+
+			if (statement->nodeType != NodeType::FuncDeclaration 
+				|| statementIndex == program->statements.size() - 1 || funcDeclaration->nativeFunc 
+				|| declarationCounts[funcDeclaration->name] != 1
+				|| findNativeFunc(funcDeclaration->name) != -1 || funcDeclaration->name == "null"
+				|| funcDeclaration->name == "true" || funcDeclaration->name == "false")
+			{
+				reachedStatements.push_back(statement);
+				continue;
+			}
+
+			unusedRecipes[funcDeclaration->name] = funcDeclaration;
+		}
+
+		// Recipes are reached once their name is read or called by a statement already reached
+		while (!reachedStatements.empty()) {
+			Statement* statement = reachedStatements.back();
+			std::vector<std::string> names;
+
+			reachedStatements.pop_back();
+			containsNode(statement, [&](Statement* node) -> bool {
+				if (node->nodeType == NodeType::Identifier)
+					names.push_back(dynamic_cast<Identifier*>(node)->name);
+				else if (node->nodeType == NodeType::ListAccesser)
+					names.push_back(dynamic_cast<ListAccesser*>(node)->name);
+				else if (node->nodeType == NodeType::FuncCall)
+					names.push_back(dynamic_cast<FuncCall*>(node)->caller);
+
+				return false;
+			});
+
+			for (auto& name : names) {
+				auto unusedRecipe = unusedRecipes.find(name);
+
+				if (!referencedNames.insert(name).second || unusedRecipe == unusedRecipes.end())
+					continue;
+
+				reachedStatements.push_back(const_cast<FuncDeclaration*>(unusedRecipe->second));
+				unusedRecipes.erase(unusedRecipe);
+			}
+		}
+
+		std::vector<Statement*> statements;
+
+		for (auto* statement : program->statements) {
+			if (statement->nodeType == NodeType::FuncDeclaration 
+				&& unusedRecipes.count(dynamic_cast<FuncDeclaration*>(statement)->name))
+			{
+				prunedNodeCount += countNodes(statement);
+				continue;
+			}
+
+			statements.push_back(statement);
+		}
+
+		program->statements = statements;
+	}
+	void Optimizer::removeStatements(std::vector<Statement*>& statements) {
+		for (auto* statement : statements)
+			prunedNodeCount += countNodes(statement);
+
+		statements.clear();
+	}
+	int Optimizer::foldCondition(
+		const Expr* condition, const std::unordered_map<std::string, bool>& constantNames) const
+	{
+		// Doubles hold every integer up to 2^53 exactly, so literals up to it compare the same
+		// way as integers and as doubles
+		constexpr double maxExactInteger = 9007199254740992.0;
+
+		switch (condition->nodeType) {
+		case NodeType::Identifier:
+		{
+			const std::string& name = dynamic_cast<const Identifier*>(condition)->name;
+			auto constantName = constantNames.find(name);
+
+			if (constantName != constantNames.end())
+				return constantName->second ? 1 : 0;
+			else if ((name == "true" || name == "false") && declarationCounts.count(name) == 0)
+				return name == "true" ? 1 : 0;
+
+			return -1;
+		}
+		case NodeType::UnaryExpr:
+		{
+			const UnaryExpr* unaryExpr = dynamic_cast<const UnaryExpr*>(condition);
+			const int state = foldCondition(unaryExpr->expr, constantNames);
+
+			return unaryExpr->operation == "!" && state != -1 ? 1 - state : -1;
+		}
+		case NodeType::BinaryExpr:
+		{
+			const BinaryExpr* binaryExpr = dynamic_cast<const BinaryExpr*>(condition);
+			const std::string& operation = binaryExpr->operation;
+
+			// Both operands are always evaluated, and result in null unless they're both bools
+			if (operation == "&&" || operation == "||") {
+				const int leftState = foldCondition(binaryExpr->leftExpr, constantNames);
+				const int rightState = foldCondition(binaryExpr->rightExpr, constantNames);
+
+				if (leftState == -1 || rightState == -1)
+					return -1;
+
+				return operation == "&&" ? leftState && rightState : leftState || rightState;
+			}
+
+			if (binaryExpr->leftExpr->nodeType != NodeType::NumLiteral
+				|| binaryExpr->rightExpr->nodeType != NodeType::NumLiteral)
+			{
+				return -1;
+			}
+
+			const double left = dynamic_cast<const NumLiteral*>(binaryExpr->leftExpr)->value;
+			const double right = dynamic_cast<const NumLiteral*>(binaryExpr->rightExpr)->value;
+
+			if (std::abs(left) > maxExactInteger || std::abs(right) > maxExactInteger)
+				return -1;
+
+			if (operation == "==") return left == right;
+			else if (operation == "!=") return left != right;
+			else if (operation == ">") return left > right;
+			else if (operation == "<") return left < right;
+			else if (operation == ">=") return left >= right;
+			else if (operation == "<=") return left <= right;
+
+			return -1;
+		}
+		default:
+			return -1;
+		}
+	}
+
+	void Optimizer::findSharedNames(Statement* statement, bool escapes) {
+		if (escapes && isExpression(statement))
+			shareIdentifier(dynamic_cast<Expr*>(statement));
+
+		switch (statement->nodeType) {
+		case NodeType::VarDeclaration:
+		{
+			const VarDeclaration* varDeclaration = dynamic_cast<VarDeclaration*>(statement);
+
+			if (!createsValue(varDeclaration->expr)) {
+				sharedNames.insert(varDeclaration->identifier);
+				shareIdentifier(varDeclaration->expr);
+			}
+
+			break;
+		}
+		case NodeType::FuncDeclaration:
+			for (auto& parameter : dynamic_cast<FuncDeclaration*>(statement)->parameters)
+				sharedNames.insert(parameter);
+
+			break;
+		// The noodle holds each element of the list in turn, while ranges count in a number of
+		// the loop's own
+		case NodeType::ForStatement:
+		{
+			const ForStatement* forStatement = dynamic_cast<ForStatement*>(statement);
+
+			if (forStatement->iterable != nullptr)
+				sharedNames.insert(forStatement->identifier);
+
+			break;
+		}
+		// Returned values are the result of the recipe
+		case NodeType::ReturnStatement:
+			shareIdentifier(dynamic_cast<ReturnStatement*>(statement)->expr);
+			break;
+		case NodeType::ListLiteral:
+			for (auto* element : dynamic_cast<ListLiteral*>(statement)->elements)
+				shareIdentifier(element);
+
+			break;
+		case NodeType::FuncCall:
+		{
+			const FuncCall* funcCall = dynamic_cast<FuncCall*>(statement);
+			const int nativeIndex = isNativeName(funcCall->caller) 
+				? findNativeFunc(funcCall->caller) : -1;
+
+			// Natives reading their arguments return new values, other than the elements at
+			// returns, and those modifying their first argument store the others in it and
+			// return it
+			if (nativeIndex != -1 && readsArguments(nativeIndex))
+				break;
+
+			for (size_t argumentIndex = nativeIndex != -1 && modifiesArgument(nativeIndex) ? 1 : 0;
+				argumentIndex < funcCall->arguments.size(); argumentIndex++)
+			{
+				if (storesArgument(nativeIndex, argumentIndex))
+					shareIdentifier(funcCall->arguments[argumentIndex]);
+			}
+
+			break;
+		}
+		case NodeType::InlinedCall:
+		{
+			const InlinedCall* inlinedCall = dynamic_cast<InlinedCall*>(statement);
+
+			sharedNames.insert(inlinedCall->parameters.begin(), inlinedCall->parameters.end());
+
+			for (auto* argument : inlinedCall->arguments)
+				shareIdentifier(argument);
+
+			break;
+		}
+		default:
+			break;
+		}
+
+		// The last statement's value is the result of the recipe, or of the branch, loop or
+		// inlined call when its own value is used
+		const bool resultEscapes = escapes || statement->nodeType == NodeType::FuncDeclaration;
+
+		forEachChild(
+			statement,
+			[&](Expr*& expr) { findSharedNames(expr); },
+			[&](std::vector<Statement*>& statements) {
+				for (size_t statementIndex = 0; statementIndex < statements.size(); statementIndex++) {
+					findSharedNames(
+						statements[statementIndex], 
+						resultEscapes && statementIndex == statements.size() - 1
+					);
+				}
+			}
+		);
+	}
+	void Optimizer::shareIdentifier(const Expr* expr) {
+		switch (expr->nodeType) {
+		case NodeType::Identifier:
+			sharedNames.insert(dynamic_cast<const Identifier*>(expr)->name);
+			break;
+		// Updating or assigning a noodle results in its own value
+		case NodeType::UnaryExpr:
+			shareIdentifier(dynamic_cast<const UnaryExpr*>(expr)->expr);
+			break;
+		case NodeType::AssignmentExpr:
+			shareIdentifier(dynamic_cast<const AssignmentExpr*>(expr)->assigne);
+			break;
+		case NodeType::FuncCall:
+		{
+			const FuncCall* funcCall = dynamic_cast<const FuncCall*>(expr);
+
+			if (isNativeName(funcCall->caller) && modifiesArgument(findNativeFunc(funcCall->caller))
+				&& !funcCall->arguments.empty())
+			{
+				shareIdentifier(funcCall->arguments[0]);
+			}
+
+			break;
+		}
+		case NodeType::InlinedCall:
+		{
+			const InlinedCall* inlinedCall = dynamic_cast<const InlinedCall*>(expr);
+
+			if (!inlinedCall->statements.empty() && isExpression(inlinedCall->statements.back()))
+				shareIdentifier(dynamic_cast<const Expr*>(inlinedCall->statements.back()));
+
+			break;
+		}
+		default:
+			break;
+		}
+	}
+	void Optimizer::hoistInvariants(Statement* statement) {
+		if (statement->nodeType == NodeType::WhileStatement) {
+			WhileStatement* whileStatement = dynamic_cast<WhileStatement*>(statement);
+			LoopEffects loopEffects;
+
+			findLoopEffects(whileStatement, loopEffects);
+
+			if (!loopEffects.callsRecipes) {
+				// The condition is evaluated on every iteration, as is every statement in the
+				// body up to the first that can leave the iteration early, but not the branches
+				// of the if statements in it
+				findInvariantOperand(whileStatement->condition, loopEffects, whileStatement->invariants);
+
+				for (auto* bodyStatement : whileStatement->statements) {
+					findInvariants(bodyStatement, loopEffects, whileStatement->invariants);
+
+					if (transfersControl(bodyStatement))
+						break;
+				}
+			}
+		}
+
+		forEachChild(
+			statement,
+			[&](Expr*& expr) { hoistInvariants(expr); },
+			[&](std::vector<Statement*>& statements) {
+				for (auto* nestedStatement : statements)
+					hoistInvariants(nestedStatement);
+			}
+		);
+	}
+	void Optimizer::findLoopEffects(Statement* statement, LoopEffects& loopEffects) const {
+		// Updates a value in place, which only changes the noodle holding it if no one else can
+		auto modifyValue = [&](const Expr* expr, bool isNumber) {
+			bool& changesShared = isNumber 
+				? loopEffects.changesSharedNumbers : loopEffects.changesSharedValues;
+
+			if (expr->nodeType != NodeType::Identifier) {
+				changesShared = true;
+				return;
+			}
+
+			const std::string& name = dynamic_cast<const Identifier*>(expr)->name;
+
+			loopEffects.changedNames.insert(name);
+
+			if (sharedNames.count(name))
+				changesShared = true;
+		};
+
+		switch (statement->nodeType) {
+		case NodeType::VarDeclaration:
+			loopEffects.changedNames.insert(dynamic_cast<VarDeclaration*>(statement)->identifier);
+			break;
+		// The noodle is assigned on every iteration, its number being updated in place
+		case NodeType::ForStatement:
+		{
+			const std::string& identifier = dynamic_cast<ForStatement*>(statement)->identifier;
+
+			loopEffects.changedNames.insert(identifier);
+
+			if (sharedNames.count(identifier))
+				loopEffects.changesSharedNumbers = true;
+
+			break;
+		}
+		// Declared recipes and dishes don't run, so their bodies are left alone
+		case NodeType::FuncDeclaration:
+			loopEffects.changedNames.insert(dynamic_cast<FuncDeclaration*>(statement)->name);
+			return;
+		case NodeType::DishDeclaration:
+			loopEffects.changedNames.insert(dynamic_cast<DishDeclaration*>(statement)->name);
+			return;
+		case NodeType::UnaryExpr:
+		{
+			const UnaryExpr* unaryExpr = dynamic_cast<UnaryExpr*>(statement);
+
+			if (unaryExpr->operation == "++" || unaryExpr->operation == "--")
+				modifyValue(unaryExpr->expr, true);
+
+			break;
+		}
+		case NodeType::AssignmentExpr:
+		{
+			const Expr* assigne = dynamic_cast<AssignmentExpr*>(statement)->assigne;
+
+			if (assigne->nodeType == NodeType::Identifier)
+				loopEffects.changedNames.insert(dynamic_cast<const Identifier*>(assigne)->name);
+			else if (assigne->nodeType == NodeType::FieldAccesser)
+				modifyValue(dynamic_cast<const FieldAccesser*>(assigne)->object, false);
+
+			break;
+		}
+		case NodeType::FuncCall:
+		{
+			const FuncCall* funcCall = dynamic_cast<FuncCall*>(statement);
+			const int nativeIndex = isNativeName(funcCall->caller) 
+				? findNativeFunc(funcCall->caller) : -1;
+
+			if (nativeIndex == -1)
+				loopEffects.callsRecipes = true;
+			else if (modifiesArgument(nativeIndex) && !funcCall->arguments.empty())
+				modifyValue(funcCall->arguments[0], false);
+
+			break;
+		}
+		case NodeType::InlinedCall:
+		{
+			const InlinedCall* inlinedCall = dynamic_cast<InlinedCall*>(statement);
+
+			loopEffects.changedNames.insert(
+				inlinedCall->parameters.begin(), inlinedCall->parameters.end()
+			);
+			break;
+		}
+		default:
+			break;
+		}
+
+		forEachChild(
+			statement,
+			[&](Expr*& expr) { findLoopEffects(expr, loopEffects); },
+			[&](std::vector<Statement*>& statements) {
+				for (auto* nestedStatement : statements)
+					findLoopEffects(nestedStatement, loopEffects);
+			}
+		);
+	}
+	void Optimizer::findInvariants(
+		Statement* statement, const LoopEffects& loopEffects, std::vector<Expr*>& invariants)
+	{
+		switch (statement->nodeType) {
+		case NodeType::VarDeclaration:
+			// Noodles are declared with the value itself, so only its operands can be hoisted
+			findInvariants(dynamic_cast<VarDeclaration*>(statement)->expr, loopEffects, invariants);
+			break;
+		case NodeType::IfStatement:
+			findInvariantOperand(
+				dynamic_cast<IfStatement*>(statement)->condition, loopEffects, invariants
+			);
+			break;
+		case NodeType::WhileStatement:
+			findInvariantOperand(
+				dynamic_cast<WhileStatement*>(statement)->condition, loopEffects, invariants
+			);
+			break;
+		// The bounds and list are evaluated once each time the loop is reached
+		case NodeType::ForStatement:
+		{
+			ForStatement* forStatement = dynamic_cast<ForStatement*>(statement);
+
+			if (forStatement->iterable != nullptr)
+				findInvariantOperand(forStatement->iterable, loopEffects, invariants);
+			else {
+				findInvariantOperand(forStatement->start, loopEffects, invariants);
+				findInvariantOperand(forStatement->end, loopEffects, invariants);
+				findInvariantOperand(forStatement->step, loopEffects, invariants);
+			}
+
+			break;
+		}
+		case NodeType::ListLiteral:
+			for (auto* element : dynamic_cast<ListLiteral*>(statement)->elements)
+				findInvariants(element, loopEffects, invariants);
+
+			break;
+		case NodeType::FieldAccesser:
+			findInvariantOperand(
+				dynamic_cast<FieldAccesser*>(statement)->object, loopEffects, invariants
+			);
+			break;
+		case NodeType::UnaryExpr:
+		{
+			UnaryExpr* unaryExpr = dynamic_cast<UnaryExpr*>(statement);
+
+			if (unaryExpr->operation == "-" || unaryExpr->operation == "!")
+				findInvariantOperand(unaryExpr->expr, loopEffects, invariants);
+
+			break;
+		}
+		case NodeType::BinaryExpr:
+		{
+			BinaryExpr* binaryExpr = dynamic_cast<BinaryExpr*>(statement);
+
+			findInvariantOperand(binaryExpr->leftExpr, loopEffects, invariants);
+			findInvariantOperand(binaryExpr->rightExpr, loopEffects, invariants);
+			break;
+		}
+		case NodeType::AssignmentExpr:
+		{
+			AssignmentExpr* assignmentExpr = dynamic_cast<AssignmentExpr*>(statement);
+
+			// Noodles are assigned a copy of the value, while fields are left to the tree walker
+			if (assignmentExpr->assigne->nodeType == NodeType::Identifier)
+				findInvariantOperand(assignmentExpr->value, loopEffects, invariants);
+
+			break;
+		}
+		case NodeType::InlinedCall:
+		{
+			InlinedCall* inlinedCall = dynamic_cast<InlinedCall*>(statement);
+
+			for (auto* argument : inlinedCall->arguments)
+				findInvariants(argument, loopEffects, invariants);
+
+			for (auto* inlinedStatement : inlinedCall->statements)
+				findInvariants(inlinedStatement, loopEffects, invariants);
+
+			break;
+		}
+		// Natives evaluate their own arguments
+		default:
+			break;
+		}
+	}
+	void Optimizer::findInvariantOperand(
+		Expr* operand, const LoopEffects& loopEffects, std::vector<Expr*>& invariants)
+	{
+		if (hoistedExprs.count(operand))
+			return;
+
+		const bool worthHoisting = operand->nodeType == NodeType::UnaryExpr 
+			|| operand->nodeType == NodeType::BinaryExpr || operand->nodeType == NodeType::FuncCall;
+
+		if (worthHoisting && isInvariant(operand, loopEffects)) {
+			invariants.push_back(operand);
+			hoistedExprs.insert(operand);
+		}
+		else
+			findInvariants(operand, loopEffects, invariants);
+	}
+	bool Optimizer::isInvariant(const Expr* expr, const LoopEffects& loopEffects) const {
+		switch (expr->nodeType) {
+		case NodeType::NullLiteral:
+		case NodeType::NumLiteral:
+		case NodeType::StringLiteral:
+			return true;
+		case NodeType::Identifier:
+		{
+			const std::string& name = dynamic_cast<const Identifier*>(expr)->name;
+
+			return !loopEffects.changedNames.count(name) 
+				&& !(loopEffects.changesSharedNumbers && sharedNames.count(name));
+		}
+		case NodeType::UnaryExpr:
+		{
+			const UnaryExpr* unaryExpr = dynamic_cast<const UnaryExpr*>(expr);
+
+			return (unaryExpr->operation == "-" || unaryExpr->operation == "!")
+				&& isInvariant(unaryExpr->expr, loopEffects);
+		}
+		case NodeType::BinaryExpr:
+		{
+			const BinaryExpr* binaryExpr = dynamic_cast<const BinaryExpr*>(expr);
+			const std::string& operation = binaryExpr->operation;
+
+			// Strings are added and compared by their characters, while other operations give
+			// null for them
+			if (loopEffects.changesSharedValues 
+				&& (operation == "+" || operation == "==" || operation == "!=")
+				&& (mayHoldSharedValue(binaryExpr->leftExpr) 
+					|| mayHoldSharedValue(binaryExpr->rightExpr)))
+			{
+				return false;
+			}
+
+			return isInvariant(binaryExpr->leftExpr, loopEffects)
+				&& isInvariant(binaryExpr->rightExpr, loopEffects);
+		}
+		case NodeType::FuncCall:
+		{
+			const FuncCall* funcCall = dynamic_cast<const FuncCall*>(expr);
+
+			if (!isNativeName(funcCall->caller) || loopEffects.changesSharedNumbers)
+				return false;
+
+			const int nativeIndex = findNativeFunc(funcCall->caller);
+
+			if (!computesResult(nativeIndex) 
+				|| static_cast<int>(funcCall->arguments.size()) != nativeFuncArities[nativeIndex])
+			{
+				return false;
+			}
+
+			// Built-ins read what's inside their arguments
+			for (auto* argument : funcCall->arguments) {
+				if (!isInvariant(argument, loopEffects) 
+					|| (loopEffects.changesSharedValues && mayHoldSharedValue(argument)))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+		default:
+			return false;
+		}
+	}
+	bool Optimizer::mayHoldSharedValue(const Expr* expr) const {
+		if (expr->nodeType == NodeType::Identifier)
+			return sharedNames.count(dynamic_cast<const Identifier*>(expr)->name) != 0;
+
+		return !createsValue(expr);
+	}
+
+	void Optimizer::reduceExpressions(Statement* statement) {
+		// serveRaw prints the source of its arguments, so they're left as they were written
+		if (statement->nodeType == NodeType::FuncCall
+			&& dynamic_cast<FuncCall*>(statement)->caller == nativeFuncNames[1])
+		{
+			return;
+		}
+
+		forEachChild(
+			statement,
+			[&](Expr*& expr) {
+				reduceExpressions(expr);
+				expr = reduceExpression(expr);
+			},
+			[&](std::vector<Statement*>& statements) {
+				for (auto& nestedStatement : statements) {
+					reduceExpressions(nestedStatement);
+
+					if (isExpression(nestedStatement))
+						nestedStatement = reduceExpression(dynamic_cast<Expr*>(nestedStatement));
+				}
+			}
+		);
+	}
+	Expr* Optimizer::reduceExpression(Expr* expr) const {
+		auto isInteger = [](const Expr* operand, int64_t integer) {
+			if (operand->nodeType != NodeType::NumLiteral)
+				return false;
+
+			const NumLiteral* numLiteral = dynamic_cast<const NumLiteral*>(operand);
+			return numLiteral->integral && numLiteral->integer == integer;
+		};
+
+		if (expr->nodeType == NodeType::FuncCall) {
+			FuncCall* funcCall = dynamic_cast<FuncCall*>(expr);
+
+			// pow results in the same number as **, and in null unless both of its arguments are
+			// numbers, which ** also does when one of its operands is a number
+			if (funcCall->caller != nativeFuncNames[9] || !isNativeName(funcCall->caller)
+				|| funcCall->arguments.size() != 2 
+				|| funcCall->arguments[1]->nodeType != NodeType::NumLiteral)
+			{
+				return expr;
+			}
+
+			BinaryExpr* power = new BinaryExpr();
+
+			power->leftExpr = funcCall->arguments[0];
+			power->rightExpr = funcCall->arguments[1];
+			power->operation = "**";
+			return power;
+		}
+		else if (expr->nodeType != NodeType::BinaryExpr)
+			return expr;
+
+		BinaryExpr* binaryExpr = dynamic_cast<BinaryExpr*>(expr);
+		const std::string& operation = binaryExpr->operation;
+
+		// Multiplying a number by the integer one or subtracting the integer zero from it 
+		// results in the same number, and null stays null. Adding zero doesn't, as -0 + 0 is 0.
+		if (operation == "*" && isInteger(binaryExpr->rightExpr, 1) 
+			&& isNumeric(binaryExpr->leftExpr))
+		{
+			return binaryExpr->leftExpr;
+		}
+		else if (operation == "*" && isInteger(binaryExpr->leftExpr, 1) 
+			&& isNumeric(binaryExpr->rightExpr))
+		{
+			return binaryExpr->rightExpr;
+		}
+		else if (operation == "-" && isInteger(binaryExpr->rightExpr, 0) 
+			&& isNumeric(binaryExpr->leftExpr))
+		{
+			return binaryExpr->leftExpr;
+		}
+		else if (operation == "/" && binaryExpr->rightExpr->nodeType == NodeType::NumLiteral) {
+			const double divisor = dynamic_cast<const NumLiteral*>(binaryExpr->rightExpr)->value;
+			int exponent;
+
+			// Dividing by a power of two is exactly multiplying by its reciprocal. Divisions
+			// always result in doubles, so the reciprocal is never an integer literal.
+			if (!std::isnormal(divisor) || !std::isnormal(1.0 / divisor)
+				|| std::abs(std::frexp(divisor, &exponent)) != 0.5)
+			{
+				return expr;
+			}
+
+			NumLiteral* reciprocal = new NumLiteral();
+			BinaryExpr* product = new BinaryExpr();
+
+			reciprocal->value = 1.0 / divisor;
+			product->leftExpr = binaryExpr->leftExpr;
+			product->rightExpr = reciprocal;
+			product->operation = "*";
+			return product;
+		}
+
+		return expr;
+	}
+	void Optimizer::eliminateCommonExprs(Statement* statement) {
+		forEachChild(
+			statement,
+			[&](Expr*& expr) { eliminateCommonExprs(expr); },
+			[&](std::vector<Statement*>& statements) {
+				std::unordered_map<std::string, Expr*> availableExprs;
+
+				for (auto* nestedStatement : statements)
+					findCommonExprs(nestedStatement, availableExprs);
+				for (auto* nestedStatement : statements)
+					eliminateCommonExprs(nestedStatement);
+			}
+		);
+	}
+	void Optimizer::findCommonExprs(
+		Statement* statement, std::unordered_map<std::string, Expr*>& availableExprs)
+	{
+		switch (statement->nodeType) {
+		case NodeType::VarDeclaration:
+			// Noodles are declared with the value itself, so only its operands can be shared
+			findCommonExprs(dynamic_cast<VarDeclaration*>(statement)->expr, availableExprs);
+			break;
+		// Returned values become the recipe's result, so likewise only their operands are shared
+		case NodeType::ReturnStatement:
+			findCommonExprs(dynamic_cast<ReturnStatement*>(statement)->expr, availableExprs);
+			break;
+		// The branches and loop bodies are lists of their own, evaluated only some of the time
+		case NodeType::IfStatement:
+			findCommonOperand(dynamic_cast<IfStatement*>(statement)->condition, availableExprs);
+			break;
+		case NodeType::ListLiteral:
+			for (auto* element : dynamic_cast<ListLiteral*>(statement)->elements)
+				findCommonExprs(element, availableExprs);
+
+			break;
+		case NodeType::FieldAccesser:
+			findCommonOperand(dynamic_cast<FieldAccesser*>(statement)->object, availableExprs);
+			break;
+		case NodeType::UnaryExpr:
+		{
+			UnaryExpr* unaryExpr = dynamic_cast<UnaryExpr*>(statement);
+
+			if (unaryExpr->operation == "-" || unaryExpr->operation == "!")
+				findCommonOperand(unaryExpr->expr, availableExprs);
+
+			break;
+		}
+		case NodeType::BinaryExpr:
+		{
+			BinaryExpr* binaryExpr = dynamic_cast<BinaryExpr*>(statement);
+
+			findCommonOperand(binaryExpr->leftExpr, availableExprs);
+			findCommonOperand(binaryExpr->rightExpr, availableExprs);
+			break;
+		}
+		case NodeType::AssignmentExpr:
+		{
+			AssignmentExpr* assignmentExpr = dynamic_cast<AssignmentExpr*>(statement);
+
+			// Noodles are assigned a copy of the value, while fields are left to the tree walker
+			if (assignmentExpr->assigne->nodeType == NodeType::Identifier)
+				findCommonOperand(assignmentExpr->value, availableExprs);
+
+			break;
+		}
+		case NodeType::InlinedCall:
+			for (auto* argument : dynamic_cast<InlinedCall*>(statement)->arguments)
+				findCommonExprs(argument, availableExprs);
+
+			break;
+		// Natives evaluate their own arguments
+		default:
+			break;
+		}
+
+		forgetChangedExprs(statement, availableExprs);
+	}
+	void Optimizer::findCommonOperand(
+		Expr*& operand, std::unordered_map<std::string, Expr*>& availableExprs)
+	{
+		const bool worthSharing = operand->nodeType == NodeType::UnaryExpr 
+			|| operand->nodeType == NodeType::BinaryExpr || operand->nodeType == NodeType::FuncCall;
+
+		// Pure expressions are those invariant in a loop changing nothing
+		if (!worthSharing || !isInvariant(operand, LoopEffects())) {
+			findCommonExprs(operand, availableExprs);
+			return;
+		}
+
+		const std::string text = describeExpr(operand);
+		auto availableExpr = availableExprs.find(text);
+
+		if (availableExpr != availableExprs.end()) {
+			operand = availableExpr->second;
+			return;
+		}
+
+		findCommonExprs(operand, availableExprs);
+		availableExprs[text] = operand;
+	}
+	void Optimizer::forgetChangedExprs(
+		Statement* statement, std::unordered_map<std::string, Expr*>& availableExprs) const
+	{
+		LoopEffects effects;
+
+		findLoopEffects(statement, effects);
+
+		if (effects.callsRecipes || effects.changesSharedValues || effects.changesSharedNumbers) {
+			availableExprs.clear();
+			return;
+		}
+		else if (effects.changedNames.empty())
+			return;
+
+		for (auto availableExpr = availableExprs.begin(); availableExpr != availableExprs.end();) {
+			const bool readsChangedName = containsNode(availableExpr->second, [&](Statement* node) {
+				return node->nodeType == NodeType::Identifier
+					&& effects.changedNames.count(dynamic_cast<Identifier*>(node)->name);
+			});
+
+			availableExpr = readsChangedName 
+				? availableExprs.erase(availableExpr) : std::next(availableExpr);
+		}
+	}
+
+	std::string Optimizer::renameParameter(const std::string& recipe, const std::string& parameter) {
+		// Noodles can't be named with a colon, so the parameter can't be shadowed
+		return recipe + ":" + parameter;
+	}
+	Statement* Optimizer::cloneStatement(
+		Statement* statement, const std::unordered_map<std::string, std::string>& renamedNames)
+	{
+		Statement* clone = nullptr;
+
+		switch (statement->nodeType) {
+		case NodeType::IfStatement:
+			clone = new IfStatement(*dynamic_cast<IfStatement*>(statement));
+			break;
+		case NodeType::WhileStatement:
+			clone = new WhileStatement(*dynamic_cast<WhileStatement*>(statement));
+			break;
+		case NodeType::ReturnStatement:
+			clone = new ReturnStatement(*dynamic_cast<ReturnStatement*>(statement));
+			break;
+		case NodeType::NullLiteral:
+			clone = new NullLiteral(*dynamic_cast<NullLiteral*>(statement));
+			break;
+		case NodeType::NumLiteral:
+			clone = new NumLiteral(*dynamic_cast<NumLiteral*>(statement));
+			break;
+		case NodeType::StringLiteral:
+			clone = new StringLiteral(*dynamic_cast<StringLiteral*>(statement));
+			break;
+		case NodeType::ListLiteral:
+			clone = new ListLiteral(*dynamic_cast<ListLiteral*>(statement));
+			break;
+		case NodeType::Identifier:
+			clone = new Identifier(*dynamic_cast<Identifier*>(statement));
+			break;
+		case NodeType::ListAccesser:
+			clone = new ListAccesser(*dynamic_cast<ListAccesser*>(statement));
+			break;
+		case NodeType::FieldAccesser:
+			clone = new FieldAccesser(*dynamic_cast<FieldAccesser*>(statement));
+			break;
+		case NodeType::UnaryExpr:
+			clone = new UnaryExpr(*dynamic_cast<UnaryExpr*>(statement));
+			break;
+		case NodeType::BinaryExpr:
+			clone = new BinaryExpr(*dynamic_cast<BinaryExpr*>(statement));
+			break;
+		case NodeType::AssignmentExpr:
+			clone = new AssignmentExpr(*dynamic_cast<AssignmentExpr*>(statement));
+			break;
+		case NodeType::FuncCall:
+			clone = new FuncCall(*dynamic_cast<FuncCall*>(statement));
+			break;
+		case NodeType::InlinedCall:
+			clone = new InlinedCall(*dynamic_cast<InlinedCall*>(statement));
+			break;
+		default:
+			return statement;
+		}
+
+		// Under dynamic scoping, the bodies of recipes inlined into this one read its
+		// parameters like it does
+		auto renameNoodle = [&](std::string& name) {
+			auto renamedName = renamedNames.find(name);
+
+			if (renamedName != renamedNames.end())
+				name = renamedName->second;
+		};
+
+		if (clone->nodeType == NodeType::Identifier)
+			renameNoodle(dynamic_cast<Identifier*>(clone)->name);
+		else if (clone->nodeType == NodeType::ListAccesser)
+			renameNoodle(dynamic_cast<ListAccesser*>(clone)->name);
+
+		forEachChild(
+			clone,
+			[&](Expr*& expr) { expr = dynamic_cast<Expr*>(cloneStatement(expr, renamedNames)); },
+			[&](std::vector<Statement*>& statements) {
+				for (auto& nestedStatement : statements)
+					nestedStatement = cloneStatement(nestedStatement, renamedNames);
+			}
+		);
+		return clone;
+	}
+	int Optimizer::countNodes(Statement* statement) {
+		int nodeCount = 0;
+
+		containsNode(statement, [&](Statement*) -> bool {
+			nodeCount++;
+			return false;
+		});
+		return nodeCount;
+	}
+	std::string Optimizer::describeExpr(const Expr* expr) {
+		std::ostringstream text;
+
+		switch (expr->nodeType) {
+		case NodeType::NumLiteral:
+		{
+			const NumLiteral* numLiteral = dynamic_cast<const NumLiteral*>(expr);
+
+			// Integer literals result in integers, unlike the same number written as a double
+			if (numLiteral->integral)
+				text << numLiteral->integer;
+			else
+				text << std::hexfloat << numLiteral->value << "d";
+
+			break;
+		}
+		// Strings are prefixed with their length, so their contents can't look like other text
+		case NodeType::StringLiteral:
+		{
+			const std::string& value = dynamic_cast<const StringLiteral*>(expr)->value;
+
+			text << "#" << value.size() << value;
+			break;
+		}
+		case NodeType::Identifier:
+			text << dynamic_cast<const Identifier*>(expr)->name;
+			break;
+		case NodeType::UnaryExpr:
+		{
+			const UnaryExpr* unaryExpr = dynamic_cast<const UnaryExpr*>(expr);
+
+			text << "(" << unaryExpr->operation << " " << describeExpr(unaryExpr->expr) << ")";
+			break;
+		}
+		case NodeType::BinaryExpr:
+		{
+			const BinaryExpr* binaryExpr = dynamic_cast<const BinaryExpr*>(expr);
+
+			text << "(" << binaryExpr->operation << " " << describeExpr(binaryExpr->leftExpr) 
+				<< " " << describeExpr(binaryExpr->rightExpr) << ")";
+			break;
+		}
+		case NodeType::FuncCall:
+		{
+			const FuncCall* funcCall = dynamic_cast<const FuncCall*>(expr);
+
+			text << "(" << funcCall->caller;
+
+			for (auto* argument : funcCall->arguments)
+				text << " " << describeExpr(argument);
+
+			text << ")";
+			break;
+		}
+		default:
+			text << "null";
+			break;
+		}
+
+		return text.str();
+	}
+	bool Optimizer::isNumeric(const Expr* expr) {
+		switch (expr->nodeType) {
+		case NodeType::NumLiteral:
+			return true;
+		// Negating anything but a number results in null
+		case NodeType::UnaryExpr:
+			return dynamic_cast<const UnaryExpr*>(expr)->operation == "-";
+		// Arithmetic on a number and anything but a number results in null, as does arithmetic
+		// on null
+		case NodeType::BinaryExpr:
+		{
+			const BinaryExpr* binaryExpr = dynamic_cast<const BinaryExpr*>(expr);
+			const std::string& operation = binaryExpr->operation;
+			const bool arithmetic = operation == "+" || operation == "-" || operation == "*"
+				|| operation == "/" || operation == "%" || operation == "**";
+
+			return arithmetic
+				&& (isNumeric(binaryExpr->leftExpr) || isNumeric(binaryExpr->rightExpr));
+		}
+		default:
+			return false;
+		}
+	}
+	void Optimizer::collectCommonExprs(
+		Statement* statement, std::unordered_set<const Statement*>& visitedNodes,
+		std::vector<const Expr*>& commonExprs)
+	{
+		// The nodes of a shared expression are only visited through its first evaluation
+		if (!visitedNodes.insert(statement).second) {
+			const Expr* expr = dynamic_cast<const Expr*>(statement);
+
+			if (std::find(commonExprs.begin(), commonExprs.end(), expr) == commonExprs.end())
+				commonExprs.push_back(expr);
+
+			return;
+		}
+
+		switch (statement->nodeType) {
+		case NodeType::IfStatement:
+			collectCommonExprs(
+				dynamic_cast<IfStatement*>(statement)->condition, visitedNodes, commonExprs
+			);
+			return;
+		case NodeType::InlinedCall:
+			for (auto* argument : dynamic_cast<InlinedCall*>(statement)->arguments)
+				collectCommonExprs(argument, visitedNodes, commonExprs);
+
+			return;
+		// Natives evaluate their own arguments, and recipes and loops have lists of their own
+		case NodeType::FuncCall:
+		case NodeType::FuncDeclaration:
+		case NodeType::DishDeclaration:
+		case NodeType::WhileStatement:
+		case NodeType::ForStatement:
+			return;
+		default:
+			break;
+		}
+
+		forEachChild(
+			statement,
+			[&](Expr*& expr) { collectCommonExprs(expr, visitedNodes, commonExprs); },
+			[&](std::vector<Statement*>&) {}
+		);
+	}
+}
\ No newline at end of file
@@ -1,68 +1,145 @@
-#include "../../hdr/runtime/Scope.hpp"
-#include "../../hdr/util/Error.hpp"
-
-namespace ns {
-	Scope::Scope() : parent(nullptr) {
-	}
-
-	Scope* Scope::assignParent(Scope* parent) {
-		this->parent = parent; 
-		return parent; 
-	}
-	RuntimeValue* Scope::declareVariable(
-		const std::string& variableName, RuntimeValue* runtimeValue, bool constant) 
-	{
-		// Checks if variable already exists
-		if (variables.find(variableName) == variables.end())
-			variables[variableName] = { constant, runtimeValue };
-		else {
-			throw Error(
-				Error::Location::Interpreter,
-				2,
-				"Cannot create noodle " + variableName + " as it is already defined in this scope"
-			);
-		}
-
-		return runtimeValue; 
-	}
-	RuntimeValue* Scope::assignVariable(
-		const std::string& variableName, RuntimeValue* runtimeValue) 
-	{
-		Scope* scope = resolveVariable(variableName); 
-		Variable& variable = scope->variables[variableName]; 
-		
-		// Ensures constants cannot be reassigned
-		if (variable.constant)
-			throw Error(
-				Error::Location::Interpreter,
-				3,
-				"Cannot redeclare noodle " + variableName + " as it is a frozen noodle."
-			); 
-		
-		variable.runtimeValue = runtimeValue; 
-		return runtimeValue; 
-	}
-	Scope* Scope::resolveVariable(const std::string& variableName) {
-		// Returns current scope if variable is found in variables map
-		if (variables.find(variableName) != variables.end())
-			return this; 
-
-		if (parent == nullptr)
-			throw Error(
-				Error::Location::Interpreter, 
-				4, 
-				"Undefined noodle " + variableName + " referenced in scope."
-			);
-
-		return parent->resolveVariable(variableName); 
-	}
-	RuntimeValue* Scope::getVariableValue(const std::string& variableName) {
-		Scope* scope = resolveVariable(variableName);
-		return scope->variables[variableName].runtimeValue; 
-	}
-	bool Scope::isVariableConst(const std::string& variableName) {
-		Scope* scope = resolveVariable(variableName); 
-		const Variable variable = scope->variables[variableName]; 
-		return variable.constant; 
-	}
+#include "../../hdr/runtime/Scope.hpp"
+#include "../../hdr/util/Error.hpp"
+
+namespace ns {
+	namespace {
+		// Scopes walked before the variable found is cached in the scope the lookup started in
+		const int cachedChainLength = 8; 
+	}
+
+	unsigned int Scope::declarationEpoch = 0; 
+
+	Scope::Scope() : parent(nullptr), hasChildren(false) {
+	}
+
+	Scope* Scope::assignParent(Scope* parent) {
+		this->parent = parent; 
+
+		if (parent != nullptr)
+			parent->hasChildren = true; 
+
+		return parent; 
+	}
+	RuntimeValue* Scope::declareVariable(
+		const std::string& variableName, RuntimeValue* runtimeValue, bool constant) 
+	{
+		// Checks if variable already exists
+		if (variables.find(variableName) == variables.end()) {
+			variables[variableName] = { constant, runtimeValue };
+
+			if (hasChildren || !cachedVariables.empty())
+				declarationEpoch++; 
+		}
+		else {
+			throw Error(
+				Error::Location::Interpreter,
+				2,
+				"Cannot create noodle " + variableName + " as it is already defined in this scope"
+			);
+		}
+
+		return runtimeValue; 
+	}
+	RuntimeValue* Scope::assignVariable(
+		const std::string& variableName, RuntimeValue* runtimeValue) 
+	{
+		return assignVariable(findVariable(variableName), variableName, runtimeValue); 
+	}
+	Scope* Scope::resolveVariable(const std::string& variableName) {
+		// Scopes are walked in a loop, as deeply nested calls make long chains of them
+		for (Scope* scope = this; scope != nullptr; scope = scope->parent) {
+			// Returns the scope if variable is found in its variables map
+			if (scope->variables.find(variableName) != scope->variables.end())
+				return scope; 
+		}
+
+		throw Error(
+			Error::Location::Interpreter, 
+			4, 
+			"Undefined noodle " + variableName + " referenced in scope."
+		);
+	}
+	RuntimeValue* Scope::getVariableValue(const std::string& variableName) {
+		return findVariable(variableName)->runtimeValue; 
+	}
+	bool Scope::isVariableConst(const std::string& variableName) {
+		return findVariable(variableName)->constant; 
+	}
+	Scope::Variable* Scope::findVariable(const std::string& variableName) {
+		Variable* variable = lookupVariable(variableName); 
+
+		// Throws the error for undefined noodles
+		if (variable == nullptr)
+			resolveVariable(variableName); 
+
+		return variable; 
+	}
+	Scope::Variable* Scope::lookupVariable(const std::string& variableName) {
+		int chainLength = 0; 
+
+		for (Scope* scope = this; scope != nullptr; scope = scope->parent, chainLength++) {
+			auto variable = scope->variables.find(variableName); 
+			Variable* foundVariable = nullptr; 
+
+			if (variable != scope->variables.end())
+				foundVariable = &variable->second; 
+			else {
+				auto cachedVariable = scope->cachedVariables.find(variableName); 
+
+				if (cachedVariable != scope->cachedVariables.end() 
+					&& cachedVariable->second.declarationEpoch == declarationEpoch)
+				{
+					foundVariable = cachedVariable->second.variable; 
+				}
+			}
+
+			if (foundVariable != nullptr) {
+				if (chainLength >= cachedChainLength)
+					cachedVariables[variableName] = { foundVariable, declarationEpoch }; 
+
+				return foundVariable; 
+			}
+		}
+
+		return nullptr; 
+	}
+	Scope::Variable* Scope::bindVariable(const std::string& variableName, RuntimeValue* runtimeValue) {
+		Variable* variable = lookupVariable(variableName); 
+
+		if (variable == nullptr) {
+			declareVariable(variableName, runtimeValue); 
+			return &variables[variableName]; 
+		}
+
+		variable->runtimeValue = runtimeValue; 
+		return variable; 
+	}
+	Scope::Variable* Scope::declareLoopVariable(
+		const std::string& variableName, RuntimeValue* runtimeValue) 
+	{
+		auto variable = variables.find(variableName); 
+
+		if (variable == variables.end()) {
+			declareVariable(variableName, runtimeValue); 
+			return &variables[variableName]; 
+		}
+
+		assignVariable(&variable->second, variableName, runtimeValue); 
+		return &variable->second; 
+	}
+
+	RuntimeValue* Scope::assignVariable(
+		Variable* variable, const std::string& variableName, RuntimeValue* runtimeValue) 
+	{
+		// Ensures constants cannot be reassigned
+		if (variable->constant)
+			throw Error(
+				Error::Location::Interpreter,
+				3,
+				"Cannot redeclare noodle " + variableName + " as it is a frozen noodle."
+			); 
+		
+		variable->runtimeValue = runtimeValue; 
+		return runtimeValue; 
+	}
 }
\ No newline at end of file
@@ -1,133 +1,730 @@
-#include "../../hdr/runtime/Values.hpp"
-#include "../../hdr/util/Memory.hpp"
-
-namespace ns {
-	const char* nativeFuncNames[numOfNativeFuncs] = {
-		"serve", 
-		"serveRaw", 
-		"receive",
-		"floor",
-		"ceil", 
-		"round", 
-		"num", 
-		"bool", 
-		"str",
-		"pow",
-		"sqrt",
-		"len", 
-		"append",
-		"at", 
-		"set", 
-		"pop",
-		"abs"
-	};
-
-	NullValue::NullValue() {
-		valueType = ValueType::Null; 
-	}
-	NumValue::NumValue() {
-		valueType = ValueType::Number; 
-	}
-	NumValue::NumValue(double value) : value(value) {
-		valueType = ValueType::Number; 
-	}
-	BoolValue::BoolValue() {
-		valueType = ValueType::Bool; 
-	}
-	BoolValue::BoolValue(bool state) : state(state) {
-		valueType = ValueType::Bool; 
-	}
-	StringValue::StringValue() {
-		valueType = ValueType::String; 
-	}
-	StringValue::StringValue(const std::string& value) : value(value) {
-		valueType = ValueType::String; 
-	}
-	ListValue::ListValue() {
-		valueType = ValueType::List; 
-	}
-	FuncValue::FuncValue() {
-		valueType = ValueType::FuncValue; 
-	}
-
-	RuntimeValue* cloneRuntimeValue(RuntimeValue* runtimeValue) {
-		switch (runtimeValue->valueType) {
-		case ValueType::Number:
-		{
-			const NumValue* numValue = dynamic_cast<const NumValue*>(runtimeValue);
-			NumValue* clonedNumValue = globalMemory->create<NumValue>();
-			clonedNumValue->value = numValue->value;
-			return clonedNumValue;
-		}
-		case ValueType::Bool:
-		{
-			const BoolValue* boolValue = dynamic_cast<const BoolValue*>(runtimeValue);
-			BoolValue* clonedBoolValue = globalMemory->create<BoolValue>();
-			clonedBoolValue->state = boolValue->state;
-			return clonedBoolValue;
-		}
-		case ValueType::String:
-		{
-			const StringValue* stringValue = dynamic_cast<const StringValue*>(runtimeValue);
-			StringValue* clonedStringValue = globalMemory->create<StringValue>();
-			clonedStringValue->value = stringValue->value;
-			return clonedStringValue;
-		}
-		default:
-			return runtimeValue;
-		}
-	}
-
-	std::ostream& operator<<(std::ostream& ostream, const RuntimeValue* runtimeValue) {
-		switch (runtimeValue->valueType) {
-		case ValueType::Null:
-		{
-			const NullValue* nullValue = dynamic_cast<const NullValue*>(runtimeValue);
-
-			ostream << " { ValueType: Null, Value: " << nullValue->value;
-			ostream << " }\n";
-			break; 
-		}
-		case ValueType::Number:
-		{
-			const NumValue* numberValue = dynamic_cast<const NumValue*>(runtimeValue);
-
-			ostream << " { ValueType: Number, Value: " << numberValue->value; 
-			ostream << " }\n";
-			break; 
-		}
-		case ValueType::Bool:
-		{
-			const BoolValue* boolValue = dynamic_cast<const BoolValue*>(runtimeValue); 
-
-			ostream << " { ValueType: Bool, Value: " << (boolValue->state ? "true" : "false");
-			ostream << " }\n";
-			break; 
-		}
-		case ValueType::String:
-		{
-			const StringValue* stringValue = dynamic_cast<const StringValue*>(runtimeValue); 
-
-			ostream << " { ValueType: String, Value: " << stringValue->value;
-			ostream << " }\n";
-			break;
-		}
-		case ValueType::List:
-		{
-			const ListValue* listValue = dynamic_cast<const ListValue*>(runtimeValue); 
-
-			ostream << " { ValueType: List }\n"; 
-			break; 
-		}
-		case ValueType::FuncValue:
-		{
-			const FuncValue* funcValue = dynamic_cast<const FuncValue*>(runtimeValue); 
-
-			ostream << " { ValueType: FuncValue, Name: " << funcValue->name << " }\n";
-			break; 
-		}
-		}
-
-		return ostream; 
-	}
+#include "../../hdr/runtime/Values.hpp"
+#include "../../hdr/util/Memory.hpp"
+
+#include <cmath>
+#include <cstring>
+
+namespace ns {
+	const char* nativeFuncNames[numOfNativeFuncs] = {
+		"serve", 
+		"serveRaw", 
+		"receive",
+		"floor",
+		"ceil", 
+		"round", 
+		"num", 
+		"bool", 
+		"str",
+		"pow",
+		"sqrt",
+		"len", 
+		"append",
+		"at", 
+		"set", 
+		"pop",
+		"abs",
+		"clock",
+		"copy",
+		"prepend",
+		"popFront",
+		"map",
+		"insert",
+		"lookup",
+		"remove",
+		"contains",
+		"keys",
+		"toSet",
+		"toList",
+		"add",
+		"has",
+		"union",
+		"intersect",
+		"difference",
+		"slice",
+		"ord",
+		"chr"
+	};
+
+	NullValue::NullValue() {
+		valueType = ValueType::Null; 
+	}
+	NumValue::NumValue() : value(0.0), integral(false), integer(0) {
+		valueType = ValueType::Number; 
+	}
+	NumValue::NumValue(double value) : value(value), integral(false), integer(0) {
+		valueType = ValueType::Number; 
+	}
+
+	void NumValue::setInteger(int64_t integer) {
+		value = static_cast<double>(integer); 
+		integral = true; 
+		this->integer = integer; 
+	}
+	void NumValue::setNumber(double number) {
+		// Doubles hold every integer up to 2^53 exactly
+		constexpr double maxExactInteger = 9007199254740992.0; 
+
+		if (number == std::trunc(number) && std::abs(number) <= maxExactInteger)
+			setInteger(static_cast<int64_t>(number)); 
+		else {
+			value = number; 
+			integral = false; 
+		}
+	}
+	int64_t NumValue::toInteger() const {
+		return integral ? integer : static_cast<int64_t>(value); 
+	}
+	BoolValue::BoolValue() {
+		valueType = ValueType::Bool; 
+	}
+	BoolValue::BoolValue(bool state) : state(state) {
+		valueType = ValueType::Bool; 
+	}
+	StringRope::StringRope() : left(nullptr), right(nullptr), source(nullptr), offset(0), length(0) {
+	}
+	StringValue::StringValue() : rope(nullptr), interned(false) {
+		valueType = ValueType::String; 
+	}
+	StringValue::StringValue(const std::string& value) : value(value), rope(nullptr), interned(false) {
+		valueType = ValueType::String; 
+	}
+
+	size_t StringValue::length() const {
+		return rope != nullptr ? rope->length : value.size(); 
+	}
+	const char* StringValue::data() const {
+		if (rope == nullptr)
+			return value.data(); 
+		else if (rope->source != nullptr)
+			return rope->source->leaf.data() + rope->offset; 
+		else if (rope->left == nullptr)
+			return rope->leaf.data(); 
+
+		return flatten().data(); 
+	}
+	const std::string& StringValue::flatten() const {
+		if (rope == nullptr)
+			return value; 
+
+		value.clear(); 
+		value.reserve(rope->length); 
+
+		// Walks the rope iteratively, as ropes built in loops are too deep to recurse through
+		std::vector<const StringRope*> pendingRopes = { rope }; 
+
+		while (!pendingRopes.empty()) {
+			const StringRope* currentRope = pendingRopes.back(); 
+			pendingRopes.pop_back(); 
+
+			if (currentRope->source != nullptr)
+				value.append(currentRope->source->leaf, currentRope->offset, currentRope->length); 
+			else if (currentRope->left == nullptr)
+				value += currentRope->leaf; 
+			else {
+				pendingRopes.push_back(currentRope->right); 
+				pendingRopes.push_back(currentRope->left); 
+			}
+		}
+
+		rope = nullptr; 
+		return value; 
+	}
+	ListNumber::ListNumber() : value(0.0), integral(false) {
+	}
+	ListNumber::ListNumber(const NumValue* numValue) : integral(numValue->integral) {
+		if (integral)
+			integer = numValue->integer; 
+		else
+			value = numValue->value; 
+	}
+
+	void ListNumber::unbox(NumValue* numValue) const {
+		if (integral)
+			numValue->setInteger(integer); 
+		else {
+			numValue->value = value; 
+			numValue->integral = false; 
+		}
+	}
+	ListValue::ListValue() : representation(Representation::Numeric), viewOffset(0), viewLength(0) {
+		valueType = ValueType::List; 
+	}
+
+	bool ListValue::isNumeric() const {
+		return representation == Representation::Numeric 
+			|| representation == Representation::PersistentNumeric
+			|| representation == Representation::NumericView; 
+	}
+	bool ListValue::isView() const {
+		return representation == Representation::View 
+			|| representation == Representation::NumericView; 
+	}
+	size_t ListValue::size() const {
+		switch (representation) {
+		case Representation::Vector:
+			return elements.size(); 
+		case Representation::Numeric:
+			return numbers.size(); 
+		case Representation::Persistent:
+			return persistentElements.size(); 
+		case Representation::PersistentNumeric:
+			return persistentNumbers.size(); 
+		default:
+			return viewLength; 
+		}
+	}
+	ListNumber ListValue::numberAt(size_t index) const {
+		switch (representation) {
+		case Representation::Numeric:
+			return numbers[index]; 
+		case Representation::PersistentNumeric:
+			return persistentNumbers.at(index); 
+		default:
+			return persistentNumbers.at(viewOffset + index); 
+		}
+	}
+	RuntimeValue* ListValue::at(size_t index) const {
+		switch (representation) {
+		case Representation::Vector:
+			return elements[index]; 
+		case Representation::Persistent:
+			return persistentElements.at(index); 
+		case Representation::View:
+			return persistentElements.at(viewOffset + index); 
+		// Unboxed numbers are only boxed once they're read
+		default:
+			return at(index, globalMemory->create<NumValue>()); 
+		}
+	}
+	RuntimeValue* ListValue::at(size_t index, NumValue* numValue) const {
+		if (!isNumeric())
+			return at(index); 
+
+		numberAt(index).unbox(numValue); 
+		return numValue; 
+	}
+	void ListValue::set(size_t index, RuntimeValue* element) {
+		if (isView())
+			unshare(); 
+
+		if (isNumeric()) {
+			if (element->valueType == ValueType::Number) {
+				const ListNumber number(dynamic_cast<const NumValue*>(element)); 
+
+				if (representation == Representation::Numeric)
+					numbers[index] = number; 
+				else
+					persistentNumbers.set(index, number); 
+
+				return; 
+			}
+
+			generalize(); 
+		}
+
+		// Clones the element, so later updates to its noodle don't leak into the list
+		if (representation == Representation::Vector)
+			elements[index] = cloneRuntimeValue(element); 
+		else
+			persistentElements.set(index, cloneRuntimeValue(element)); 
+	}
+	void ListValue::append(RuntimeValue* element) {
+		if (isView())
+			unshare(); 
+
+		if (isNumeric()) {
+			if (element->valueType == ValueType::Number) {
+				const ListNumber number(dynamic_cast<const NumValue*>(element)); 
+
+				if (representation == Representation::Numeric)
+					numbers.pushBack(number); 
+				else
+					persistentNumbers.pushBack(number); 
+
+				return; 
+			}
+
+			generalize(); 
+		}
+
+		if (representation == Representation::Vector)
+			elements.pushBack(cloneRuntimeValue(element)); 
+		else
+			persistentElements.pushBack(cloneRuntimeValue(element)); 
+	}
+	void ListValue::prepend(RuntimeValue* element) {
+		// Persistent vectors can only grow at the back
+		unshare(); 
+
+		if (representation == Representation::Numeric) {
+			if (element->valueType == ValueType::Number) {
+				numbers.pushFront(ListNumber(dynamic_cast<const NumValue*>(element))); 
+				return; 
+			}
+
+			generalize(); 
+		}
+
+		elements.pushFront(cloneRuntimeValue(element)); 
+	}
+	RuntimeValue* ListValue::pop(size_t index) {
+		RuntimeValue* element = at(index); 
+
+		if (isView())
+			unshare(); 
+
+		// Persistent vectors can only remove their last element
+		if (representation == Representation::Persistent 
+			|| representation == Representation::PersistentNumeric) 
+		{
+			if (index == size() - 1) {
+				if (representation == Representation::Persistent)
+					persistentElements.popBack(); 
+				else
+					persistentNumbers.popBack(); 
+
+				return element; 
+			}
+
+			unshare(); 
+		}
+
+		if (representation == Representation::Vector)
+			elements.erase(index); 
+		else
+			numbers.erase(index); 
+
+		return element; 
+	}
+	RuntimeValue* ListValue::popFront() {
+		RuntimeValue* element = at(0); 
+
+		// Persistent vectors can only shrink at the back
+		unshare(); 
+
+		if (representation == Representation::Vector)
+			elements.popFront(); 
+		else
+			numbers.popFront(); 
+
+		return element; 
+	}
+	ListValue* ListValue::snapshot() {
+		share(); 
+
+		ListValue* listValue = globalMemory->create<ListValue>(); 
+
+		listValue->representation = representation; 
+		listValue->viewOffset = viewOffset; 
+		listValue->viewLength = viewLength; 
+
+		if (isNumeric())
+			listValue->persistentNumbers = persistentNumbers.snapshot(); 
+		else
+			listValue->persistentElements = persistentElements.snapshot(); 
+
+		return listValue; 
+	}
+	ListValue* ListValue::slice(size_t start, size_t end) {
+		ListValue* listValue = snapshot(); 
+
+		// Views of views slice the same snapshot, rather than nesting
+		if (!isView()) {
+			listValue->representation = isNumeric() 
+				? Representation::NumericView : Representation::View; 
+		}
+
+		listValue->viewOffset += start; 
+		listValue->viewLength = end - start; 
+		return listValue; 
+	}
+
+	void ListValue::generalize() {
+		if (isView())
+			unshare(); 
+
+		if (representation == Representation::Numeric) {
+			elements.reserve(numbers.size()); 
+
+			for (size_t numberIndex = 0; numberIndex < numbers.size(); numberIndex++)
+				elements.pushBack(at(numberIndex)); 
+
+			numbers = RingBuffer<ListNumber>(); 
+			representation = Representation::Vector; 
+		}
+		else if (representation == Representation::PersistentNumeric) {
+			for (size_t numberIndex = 0; numberIndex < persistentNumbers.size(); numberIndex++)
+				persistentElements.pushBack(at(numberIndex)); 
+
+			persistentNumbers = PersistentVector<ListNumber>(); 
+			representation = Representation::Persistent; 
+		}
+	}
+	void ListValue::share() {
+		if (representation == Representation::Vector) {
+			for (size_t elementIndex = 0; elementIndex < elements.size(); elementIndex++)
+				persistentElements.pushBack(elements[elementIndex]); 
+
+			elements = RingBuffer<RuntimeValue*>(); 
+			representation = Representation::Persistent; 
+		}
+		else if (representation == Representation::Numeric) {
+			for (size_t numberIndex = 0; numberIndex < numbers.size(); numberIndex++)
+				persistentNumbers.pushBack(numbers[numberIndex]); 
+
+			numbers = RingBuffer<ListNumber>(); 
+			representation = Representation::PersistentNumeric; 
+		}
+	}
+	void ListValue::unshare() {
+		if (representation == Representation::Persistent) {
+			elements.reserve(persistentElements.size()); 
+
+			for (size_t elementIndex = 0; elementIndex < persistentElements.size(); elementIndex++)
+				elements.pushBack(persistentElements.at(elementIndex)); 
+
+			persistentElements = PersistentVector<RuntimeValue*>(); 
+			representation = Representation::Vector; 
+		}
+		else if (representation == Representation::PersistentNumeric) {
+			numbers.reserve(persistentNumbers.size()); 
+
+			for (size_t numberIndex = 0; numberIndex < persistentNumbers.size(); numberIndex++)
+				numbers.pushBack(persistentNumbers.at(numberIndex)); 
+
+			persistentNumbers = PersistentVector<ListNumber>(); 
+			representation = Representation::Numeric; 
+		}
+		else if (representation == Representation::View) {
+			elements.reserve(viewLength); 
+
+			for (size_t elementIndex = 0; elementIndex < viewLength; elementIndex++)
+				elements.pushBack(persistentElements.at(viewOffset + elementIndex)); 
+
+			persistentElements = PersistentVector<RuntimeValue*>(); 
+			representation = Representation::Vector; 
+		}
+		else if (representation == Representation::NumericView) {
+			numbers.reserve(viewLength); 
+
+			for (size_t numberIndex = 0; numberIndex < viewLength; numberIndex++)
+				numbers.pushBack(persistentNumbers.at(viewOffset + numberIndex)); 
+
+			persistentNumbers = PersistentVector<ListNumber>(); 
+			representation = Representation::Numeric; 
+		}
+	}
+	// Both functors run for every probe, so they cast on the already checked value type
+	size_t RuntimeValueHash::operator()(const RuntimeValue* runtimeValue) const {
+		switch (runtimeValue->valueType) {
+		case ValueType::Null:
+			return 0; 
+		case ValueType::Number:
+		{
+			double number = static_cast<const NumValue*>(runtimeValue)->value; 
+			uint64_t bits = 0; 
+
+			// Makes -0 and 0 hash the same, as they compare equal
+			if (number == 0.0)
+				number = 0.0; 
+
+			std::memcpy(&bits, &number, sizeof(bits)); 
+			return static_cast<size_t>(bits); 
+		}
+		case ValueType::Bool:
+			return static_cast<const BoolValue*>(runtimeValue)->state ? 1 : 2; 
+		case ValueType::String:
+			return std::hash<std::string>()(
+				static_cast<const StringValue*>(runtimeValue)->flatten()
+			); 
+		default:
+			return std::hash<const RuntimeValue*>()(runtimeValue); 
+		}
+	}
+	bool RuntimeValueEqual::operator()(
+		const RuntimeValue* leftValue, const RuntimeValue* rightValue) const 
+	{
+		if (leftValue->valueType != rightValue->valueType)
+			return false; 
+
+		switch (leftValue->valueType) {
+		case ValueType::Null:
+			return true; 
+		case ValueType::Number:
+		{
+			const NumValue* leftNumValue = static_cast<const NumValue*>(leftValue); 
+			const NumValue* rightNumValue = static_cast<const NumValue*>(rightValue); 
+
+			// Integers too large for a double are only equal if they're exactly equal
+			if (leftNumValue->integral && rightNumValue->integral)
+				return leftNumValue->integer == rightNumValue->integer; 
+
+			return leftNumValue->value == rightNumValue->value; 
+		}
+		case ValueType::Bool:
+			return static_cast<const BoolValue*>(leftValue)->state 
+				== static_cast<const BoolValue*>(rightValue)->state; 
+		case ValueType::String:
+		{
+			const StringValue* leftStringValue = static_cast<const StringValue*>(leftValue); 
+			const StringValue* rightStringValue = static_cast<const StringValue*>(rightValue); 
+
+			return leftStringValue->length() == rightStringValue->length()
+				&& std::memcmp(
+					leftStringValue->data(), rightStringValue->data(), leftStringValue->length()
+				) == 0; 
+		}
+		default:
+			return leftValue == rightValue; 
+		}
+	}
+	MapValue::MapValue() {
+		valueType = ValueType::Map; 
+	}
+	SetValue::SetValue() {
+		valueType = ValueType::Set; 
+	}
+	DishShape::DishShape() : scope(nullptr), evaluateDefault(nullptr) {
+	}
+
+	int DishShape::findSlot(const std::string& field) const {
+		for (size_t slot = 0; slot < fields.size(); slot++) {
+			if (fields[slot] == field)
+				return static_cast<int>(slot); 
+		}
+
+		return -1; 
+	}
+	DishValue::DishValue() : shape(nullptr) {
+		valueType = ValueType::Dish; 
+	}
+	FuncValue::FuncValue() : 
+		scope(nullptr), nativeFunc(false), dishShape(nullptr), chunk(nullptr), 
+		compiledBody(nullptr), reusesScope(false), cache(nullptr)
+	{
+		valueType = ValueType::FuncValue; 
+	}
+
+	StringValue* concatStringValues(StringValue* leftStringValue, StringValue* rightStringValue) {
+		// Results up to this length are copied, as a rope node would cost more than the copy
+		constexpr size_t maxFlatLength = 256; 
+
+		// Flat strings are mutable, so they are snapshotted into a leaf before being shared
+		auto getRope = [](const StringValue* stringValue) -> const StringRope* {
+			if (stringValue->rope != nullptr)
+				return stringValue->rope; 
+
+			StringRope* leafRope = globalMemory->create<StringRope>(); 
+
+			leafRope->leaf = stringValue->value; 
+			leafRope->length = stringValue->value.size(); 
+			return leafRope; 
+		}; 
+
+		StringValue* resultStringValue = globalMemory->create<StringValue>(); 
+		const size_t length = leftStringValue->length() + rightStringValue->length(); 
+
+		if (length <= maxFlatLength) {
+			resultStringValue->value = leftStringValue->flatten() + rightStringValue->flatten(); 
+			return resultStringValue; 
+		}
+
+		StringRope* concatRope = globalMemory->create<StringRope>(); 
+
+		concatRope->left = getRope(leftStringValue); 
+		concatRope->right = getRope(rightStringValue); 
+		concatRope->length = length; 
+		resultStringValue->rope = concatRope; 
+		return resultStringValue; 
+	}
+	StringValue* sliceStringValue(StringValue* stringValue, size_t start, size_t end) {
+		// Interned strings are shared, so their characters can't be moved into a leaf
+		if (stringValue->interned) {
+			StringValue* resultStringValue = globalMemory->create<StringValue>(); 
+
+			resultStringValue->value = stringValue->value.substr(start, end - start); 
+			return resultStringValue; 
+		}
+
+		const StringRope* sourceRope = stringValue->rope; 
+		size_t sourceOffset = start; 
+
+		// Slices of slices share the same source leaf, rather than nesting
+		if (sourceRope != nullptr && sourceRope->source != nullptr) {
+			sourceOffset += sourceRope->offset; 
+			sourceRope = sourceRope->source; 
+		}
+		// Otherwise, the string's characters are moved into a leaf, which the string and its 
+		// slices all share until one of them is modified
+		else if (sourceRope == nullptr || sourceRope->left != nullptr) {
+			StringRope* leafRope = globalMemory->create<StringRope>(); 
+
+			stringValue->flatten(); 
+			leafRope->leaf = std::move(stringValue->value); 
+			leafRope->length = leafRope->leaf.size(); 
+			stringValue->value.clear(); 
+			stringValue->rope = leafRope; 
+			sourceRope = leafRope; 
+		}
+
+		StringRope* sliceRope = globalMemory->create<StringRope>(); 
+
+		sliceRope->source = sourceRope; 
+		sliceRope->offset = sourceOffset; 
+		sliceRope->length = end - start; 
+
+		StringValue* resultStringValue = globalMemory->create<StringValue>(); 
+
+		resultStringValue->rope = sliceRope; 
+		return resultStringValue; 
+	}
+	StringValue* internChrValue(char chr) {
+		// Allocated outside of globalMemory, so they outlive the memory of each program
+		static StringValue* const internedChrValues = []() -> StringValue* {
+			StringValue* chrValues = new StringValue[256]; 
+
+			for (int chrIndex = 0; chrIndex < 256; chrIndex++) {
+				chrValues[chrIndex].value = std::string(1, static_cast<char>(chrIndex)); 
+				chrValues[chrIndex].interned = true; 
+			}
+
+			return chrValues; 
+		}(); 
+
+		return &internedChrValues[static_cast<unsigned char>(chr)]; 
+	}
+	RuntimeValue* cloneRuntimeValue(RuntimeValue* runtimeValue) {
+		switch (runtimeValue->valueType) {
+		case ValueType::Number:
+		{
+			const NumValue* numValue = dynamic_cast<const NumValue*>(runtimeValue);
+			NumValue* clonedNumValue = globalMemory->create<NumValue>();
+			clonedNumValue->value = numValue->value;
+			clonedNumValue->integral = numValue->integral; 
+			clonedNumValue->integer = numValue->integer; 
+			return clonedNumValue;
+		}
+		case ValueType::Bool:
+		{
+			const BoolValue* boolValue = dynamic_cast<const BoolValue*>(runtimeValue);
+			BoolValue* clonedBoolValue = globalMemory->create<BoolValue>();
+			clonedBoolValue->state = boolValue->state;
+			return clonedBoolValue;
+		}
+		case ValueType::String:
+		{
+			StringValue* stringValue = dynamic_cast<StringValue*>(runtimeValue);
+
+			// Interned strings are never modified, so they don't need to be copied
+			if (stringValue->interned)
+				return stringValue; 
+
+			StringValue* clonedStringValue = globalMemory->create<StringValue>();
+
+			// Ropes are immutable, so clones can share them instead of copying
+			if (stringValue->rope != nullptr)
+				clonedStringValue->rope = stringValue->rope; 
+			else
+				clonedStringValue->value = stringValue->value;
+
+			return clonedStringValue;
+		}
+		case ValueType::Dish:
+		{
+			const DishValue* dishValue = dynamic_cast<const DishValue*>(runtimeValue); 
+			DishValue* clonedDishValue = globalMemory->create<DishValue>(); 
+
+			// Clones share the shape, so field accesses stay cached across copies
+			clonedDishValue->shape = dishValue->shape; 
+			clonedDishValue->slots.reserve(dishValue->slots.size()); 
+
+			for (auto* slotValue : dishValue->slots)
+				clonedDishValue->slots.push_back(cloneRuntimeValue(slotValue)); 
+
+			return clonedDishValue; 
+		}
+		default:
+			return runtimeValue;
+		}
+	}
+
+	std::ostream& operator<<(std::ostream& ostream, const RuntimeValue* runtimeValue) {
+		switch (runtimeValue->valueType) {
+		case ValueType::Null:
+		{
+			const NullValue* nullValue = dynamic_cast<const NullValue*>(runtimeValue);
+
+			ostream << " { ValueType: Null, Value: " << nullValue->value;
+			ostream << " }\n";
+			break; 
+		}
+		case ValueType::Number:
+		{
+			const NumValue* numberValue = dynamic_cast<const NumValue*>(runtimeValue);
+
+			ostream << " { ValueType: Number, Value: "; 
+
+			if (numberValue->integral)
+				ostream << numberValue->integer; 
+			else
+				ostream << numberValue->value; 
+
+			ostream << " }\n";
+			break; 
+		}
+		case ValueType::Bool:
+		{
+			const BoolValue* boolValue = dynamic_cast<const BoolValue*>(runtimeValue); 
+
+			ostream << " { ValueType: Bool, Value: " << (boolValue->state ? "true" : "false");
+			ostream << " }\n";
+			break; 
+		}
+		case ValueType::String:
+		{
+			const StringValue* stringValue = dynamic_cast<const StringValue*>(runtimeValue); 
+
+			ostream << " { ValueType: String, Value: " << stringValue->flatten();
+			ostream << " }\n";
+			break;
+		}
+		case ValueType::List:
+		{
+			const ListValue* listValue = dynamic_cast<const ListValue*>(runtimeValue); 
+
+			ostream << " { ValueType: List }\n"; 
+			break; 
+		}
+		case ValueType::FuncValue:
+		{
+			const FuncValue* funcValue = dynamic_cast<const FuncValue*>(runtimeValue); 
+
+			ostream << " { ValueType: FuncValue, Name: " << funcValue->name << " }\n";
+			break; 
+		}
+		case ValueType::Map:
+		{
+			const MapValue* mapValue = dynamic_cast<const MapValue*>(runtimeValue); 
+
+			ostream << " { ValueType: Map, Size: " << mapValue->entries.size() << " }\n";
+			break; 
+		}
+		case ValueType::Set:
+		{
+			const SetValue* setValue = dynamic_cast<const SetValue*>(runtimeValue); 
+
+			ostream << " { ValueType: Set, Size: " << setValue->elements.size() << " }\n";
+			break; 
+		}
+		case ValueType::Dish:
+		{
+			const DishValue* dishValue = dynamic_cast<const DishValue*>(runtimeValue); 
+
+			ostream << " { ValueType: Dish, Name: " << dishValue->shape->name << " }\n";
+			break; 
+		}
+		}
+
+		return ostream; 
+	}
 }
\ No newline at end of file
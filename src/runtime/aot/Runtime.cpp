@@ -0,0 +1,257 @@
+#include "../../../hdr/runtime/aot/Runtime.hpp"
+
+namespace ns {
+	namespace {
+		Scope* createGlobalScope() {
+			Scope* globalScope = globalMemory->create<Scope>(); 
+			globalScope->declareVariable("null", globalMemory->create<NullValue>(), true);
+
+			BoolValue* trueValue = globalMemory->create<BoolValue>(); 
+			trueValue->state = true; 
+			BoolValue* falseValue = globalMemory->create<BoolValue>(); 
+			falseValue->state = false; 
+
+			globalScope->declareVariable("true", trueValue, true);
+			globalScope->declareVariable("false", falseValue, true);
+
+			for (int nativeIndex = 0; nativeIndex < numOfNativeFuncs; nativeIndex++) {
+				FuncValue* funcValue = globalMemory->create<FuncValue>();
+
+				funcValue->name = nativeFuncNames[nativeIndex]; 
+				funcValue->nativeFunc = true; 
+				globalScope->declareVariable(funcValue->name, funcValue, true); 
+			}
+
+			return globalScope; 
+		}
+
+		// Call prepared by a recipe body returning from a call in tail position
+		FuncValue* tailCallee = nullptr; 
+		Scope* tailCallScope = nullptr; 
+
+		Scope* createCallScope(
+			FuncValue* funcValue, RuntimeValue* const* arguments, Scope* scope)
+		{
+			Scope* funcScope = globalMemory->create<Scope>();
+
+			funcScope->assignParent(scope);
+
+			for (size_t parameterIndex = 0; parameterIndex < funcValue->parameters.size();
+				parameterIndex++)
+			{
+				funcScope->declareVariable(
+					funcValue->parameters[parameterIndex], arguments[parameterIndex]
+				);
+			}
+
+			return funcScope; 
+		}
+	}
+
+	int runCompiledProgram(void (*createConstants)(), CompiledBody program) {
+		Memory memory; 
+
+		globalMemory = &memory; 
+
+		try {
+			createConstants(); 
+			markNativeStackBase(); 
+			program(createGlobalScope()); 
+		}
+		catch (const Error& error) {
+			std::cout << error; 
+		}
+
+		std::cout.flush(); 
+		return 0; 
+	}
+
+	RuntimeValue* createCompiledInteger(int64_t integer) {
+		NumValue* numberValue = globalMemory->create<NumValue>(); 
+		numberValue->setInteger(integer); 
+		return numberValue; 
+	}
+	RuntimeValue* createCompiledNumber(double number) {
+		NumValue* numberValue = globalMemory->create<NumValue>(); 
+		numberValue->value = number; 
+		return numberValue; 
+	}
+	RuntimeValue* createCompiledString(const char* string, size_t length) {
+		if (length == 1)
+			return internChrValue(string[0]); 
+
+		StringValue* stringValue = globalMemory->create<StringValue>(); 
+		stringValue->value.assign(string, length); 
+		return stringValue; 
+	}
+
+	void declareCompiledVariable(
+		Scope* scope, const char* name, RuntimeValue* runtimeValue, bool constant, 
+		Scope::Variable*& variable) 
+	{
+		scope->declareVariable(name, runtimeValue, constant); 
+		variable = scope->findVariable(name); 
+	}
+	void bindCompiledVariable(
+		Scope* scope, const char* name, RuntimeValue* runtimeValue, Scope::Variable*& variable) 
+	{
+		if (variable == nullptr)
+			variable = scope->bindVariable(name, runtimeValue); 
+		else
+			variable->runtimeValue = runtimeValue; 
+	}
+	void verifyVariableAssignable(Scope::Variable* variable, const char* name) {
+		// Assigning to a frozen noodle throws the error
+		if (variable->constant)
+			Scope::assignVariable(variable, name, nullptr); 
+	}
+	void verifyFieldAssignable(const DishValue* dishValue, int slot, const char* field) {
+		if (dishValue->shape->constantFields[slot]) {
+			throw Error(
+				Error::Location::Interpreter,
+				3,
+				"Cannot redeclare noodle " + std::string(field) + " as it is a frozen noodle."
+			); 
+		}
+	}
+	RuntimeValue* declareCompiledRecipe(
+		Scope* scope, const char* name, const std::vector<std::string>& parameters, 
+		CompiledBody compiledBody, bool pure, Scope::Variable*& variable) 
+	{
+		FuncValue* funcValue = globalMemory->create<FuncValue>(); 
+
+		funcValue->name = name; 
+		funcValue->parameters = parameters; 
+		funcValue->scope = scope; 
+		funcValue->compiledBody = compiledBody; 
+
+		if (pure)
+			funcValue->cache = globalMemory->create<RecipeCache>(); 
+
+		declareCompiledVariable(scope, name, funcValue, true, variable); 
+		return funcValue; 
+	}
+	RuntimeValue* declareCompiledDish(
+		Scope* scope, const char* name, const std::vector<std::string>& fields, 
+		const std::vector<bool>& constantFields, 
+		RuntimeValue* (*evaluateDefault)(const DishShape* dishShape, size_t slot), 
+		Scope::Variable*& variable) 
+	{
+		DishShape* dishShape = globalMemory->create<DishShape>(); 
+
+		dishShape->name = name; 
+		dishShape->scope = scope; 
+		dishShape->evaluateDefault = evaluateDefault; 
+
+		for (size_t fieldIndex = 0; fieldIndex < fields.size(); fieldIndex++) {
+			if (dishShape->findSlot(fields[fieldIndex]) != -1) {
+				throw Error(
+					Error::Location::Interpreter,
+					2,
+					"Cannot create noodle " + fields[fieldIndex] + " as it is already defined in dish "
+						+ dishShape->name
+				);
+			}
+
+			dishShape->fields.push_back(fields[fieldIndex]); 
+			dishShape->constantFields.push_back(constantFields[fieldIndex]); 
+		}
+
+		FuncValue* funcValue = globalMemory->create<FuncValue>(); 
+
+		funcValue->name = name; 
+		funcValue->scope = scope; 
+		funcValue->dishShape = dishShape; 
+
+		declareCompiledVariable(scope, name, funcValue, true, variable); 
+		return funcValue; 
+	}
+	RuntimeValue* callCompiledRecipe(
+		RuntimeValue* callee, const char* caller, RuntimeValue* const* arguments, 
+		size_t argumentCount, Scope* scope) 
+	{
+		FuncValue* funcValue = dynamic_cast<FuncValue*>(callee);
+
+		if (funcValue == nullptr) {
+			throw Error(
+				Error::Location::Interpreter,
+				15,
+				"Cannot call noodle " + std::string(caller) + " as it isn't a recipe"
+			);
+		}
+		// Natives shadowed by a noodle of the same name are only known to be natives here
+		else if (funcValue->nativeFunc) {
+			const int nativeIndex = findNativeFunc(funcValue->name); 
+
+			verifyNativeArgumentCount(nativeIndex, caller, argumentCount); 
+			return callNativeFunc(nativeIndex, arguments, argumentCount, nullptr); 
+		}
+		else if (funcValue->dishShape != nullptr)
+			return createDishValue(funcValue->dishShape, arguments, argumentCount);
+		else if (argumentCount < funcValue->parameters.size()) {
+			throw Error(
+				Error::Location::Interpreter,
+				14,
+				"Cannot call recipe " + std::string(caller) + " with "
+					+ std::to_string(argumentCount)
+						+ (argumentCount == 1 ? " argument" : " arguments")
+			);
+		}
+
+		std::string cacheKey; 
+		const bool cachesResult = funcValue->cache != nullptr 
+			&& makeRecipeCacheKey(arguments, funcValue->parameters.size(), cacheKey); 
+
+		if (cachesResult) {
+			RuntimeValue* cachedResult = findCachedResult(funcValue, cacheKey); 
+
+			if (cachedResult != nullptr)
+				return cachedResult; 
+		}
+
+		enterRecipeCall(caller, true); 
+
+		RuntimeValue* result = funcValue->compiledBody(createCallScope(funcValue, arguments, scope)); 
+
+		// Calls in tail position are run here, so they don't nest on the native stack
+		while (result == nullptr) {
+			FuncValue* callee = tailCallee; 
+			result = callee->compiledBody(tailCallScope); 
+		}
+
+		if (cachesResult)
+			storeCachedResult(funcValue, cacheKey, result); 
+
+		leaveRecipeCall(); 
+		return result; 
+	}
+	RuntimeValue* tailCallCompiledRecipe(
+		RuntimeValue* callee, const char* caller, RuntimeValue* const* arguments, 
+		size_t argumentCount, Scope* scope) 
+	{
+		FuncValue* funcValue = callee->valueType == ValueType::FuncValue 
+			? static_cast<FuncValue*>(callee) : nullptr; 
+
+		if (funcValue == nullptr || funcValue->nativeFunc || funcValue->dishShape != nullptr 
+			|| argumentCount < funcValue->parameters.size()) 
+		{
+			return callCompiledRecipe(callee, caller, arguments, argumentCount, scope); 
+		}
+
+		// Tail calls only look their result up, as the call they end stores it
+		std::string cacheKey; 
+
+		if (funcValue->cache != nullptr 
+			&& makeRecipeCacheKey(arguments, funcValue->parameters.size(), cacheKey)) 
+		{
+			RuntimeValue* cachedResult = findCachedResult(funcValue, cacheKey); 
+
+			if (cachedResult != nullptr)
+				return cachedResult; 
+		}
+
+		tailCallScope = createCallScope(funcValue, arguments, scope); 
+		tailCallee = funcValue; 
+		return nullptr; 
+	}
+}
\ No newline at end of file
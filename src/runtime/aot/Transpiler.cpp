@@ -0,0 +1,912 @@
+#include "../../../hdr/runtime/aot/Transpiler.hpp"
+#include "../../../hdr/runtime/Natives.hpp"
+#include "../../../hdr/runtime/Operations.hpp"
+#include "../../../hdr/runtime/Optimizer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+namespace ns {
+	const char* runtimeSources[numOfRuntimeSources] = {
+		"src/runtime/aot/Runtime.cpp", 
+		"src/runtime/CallStack.cpp", 
+		"src/runtime/Memoization.cpp", 
+		"src/runtime/Natives.cpp", 
+		"src/runtime/Operations.cpp", 
+		"src/runtime/Scope.cpp", 
+		"src/runtime/Values.cpp", 
+		"src/util/Error.cpp", 
+		"src/util/Memory.cpp"
+	}; 
+
+	namespace {
+		// Names of the binary operations in BinaryOperation, in the order they're listed
+		const char* binaryOperationEnums[] = {
+			"Add", "Subtract", "Multiply", "Divide", "Modulo", "Power", "Equal", "NotEqual", 
+			"Greater", "Less", "GreaterEqual", "LessEqual", "And", "Or"
+		}; 
+
+		int findBinaryOperation(const std::string& operation) {
+			return std::find(
+				binaryOperationNames, binaryOperationNames + 14, operation
+			) - binaryOperationNames; 
+		}
+		// Natives that store their own copy of an interned string where their first argument 
+		// came from: append, set, pop, prepend and popFront
+		bool storesStringArgument(int nativeIndex) {
+			return nativeIndex == 12 || nativeIndex == 14 || nativeIndex == 15 
+				|| nativeIndex == 19 || nativeIndex == 20; 
+		}
+		// Whether the statements continue the loop they're the body of, rather than a loop 
+		// nested in it
+		bool continuesLoop(const std::vector<Statement*>& statements) {
+			for (auto* statement : statements) {
+				if (statement->nodeType == NodeType::ContinueStatement)
+					return true; 
+				else if (statement->nodeType != NodeType::IfStatement)
+					continue; 
+
+				const IfStatement* ifStatement = dynamic_cast<const IfStatement*>(statement); 
+
+				if (continuesLoop(ifStatement->ifStatements) 
+					|| continuesLoop(ifStatement->elseStatements)) 
+				{
+					return true; 
+				}
+			}
+
+			return false; 
+		}
+	}
+
+	Transpiler::Function::Function() : valueCount(0), indentation(1), tailPosition(false) {
+	}
+
+	Transpiler::Transpiler() : 
+		function(nullptr), 
+		constantCount(0), 
+		recipeCount(0), 
+		dishCount(0), 
+		fieldSiteCount(0)
+	{
+	}
+
+	std::string Transpiler::transpileProgram(Program* program) {
+		prototypes.str(""); 
+		definitions.str(""); 
+		constants.str(""); 
+		constantCount = recipeCount = dishCount = fieldSiteCount = 0; 
+
+		transpileFunction("static RuntimeValue* runProgram(Scope* scope)", program->statements); 
+
+		std::ostringstream source; 
+
+		source << "// Transpiled from NoodleScript, and built with the runtime library\n"; 
+		source << "#include \"hdr/runtime/aot/Runtime.hpp\"\n\n"; 
+		source << "using namespace ns;\n\n"; 
+		source << "static RuntimeValue* constants[" << std::max(constantCount, 1) << "];\n\n"; 
+		source << prototypes.str() << "\n"; 
+		source << "static void createConstants() {\n" << constants.str() << "}\n"; 
+		source << definitions.str() << "\n"; 
+		source << "int main() {\n"; 
+		source << "\treturn runCompiledProgram(createConstants, runProgram);\n"; 
+		source << "}\n"; 
+		return source.str(); 
+	}
+
+	void Transpiler::transpileFunction(
+		const std::string& signature, const std::vector<Statement*>& statements, bool recipeBody) 
+	{
+		Function recipe; 
+		Function* enclosingFunction = function; 
+
+		function = &recipe; 
+		function->tailPosition = recipeBody; 
+
+		const std::string result = allocateValue(); 
+
+		line() << "RuntimeValue* " << result << ";\n"; 
+		transpileStatements(statements, result); 
+		line() << "return " << result << ";\n"; 
+		function = enclosingFunction; 
+
+		prototypes << signature << ";\n"; 
+		definitions << signature << " {\n"; 
+
+		for (auto& name : recipe.names)
+			definitions << "\tScope::Variable* " << variableLocal(name) << " = nullptr;\n"; 
+
+		definitions << "\n" << recipe.code.str() << "}\n"; 
+	}
+	void Transpiler::transpileStatements(
+		const std::vector<Statement*>& statements, const std::string& target) 
+	{
+		if (statements.empty()) {
+			line() << target << " = globalMemory->create<NullValue>();\n"; 
+			return; 
+		}
+
+		const bool tailPosition = function->tailPosition; 
+		const std::vector<const Expr*> statementsCommonExprs = Optimizer::findCommonExprs(statements); 
+
+		commonExprs.insert(statementsCommonExprs.begin(), statementsCommonExprs.end()); 
+
+		// Only the value of the last statement is kept
+		for (size_t statementIndex = 0; statementIndex < statements.size(); statementIndex++) {
+			function->tailPosition = tailPosition && statementIndex == statements.size() - 1; 
+
+			if (statementIndex < statements.size() - 1) {
+				transpileStatement(statements[statementIndex]); 
+				continue; 
+			}
+
+			const std::string value = transpileStoredValue(statements[statementIndex]); 
+			line() << target << " = " << value << ";\n"; 
+		}
+
+		// Locals of the common expressions are out of scope once the statements end
+		for (auto* commonExpr : statementsCommonExprs) {
+			if (commonExprs.erase(commonExpr) == 0)
+				reusedValues.erase(commonExpr); 
+		}
+	}
+	std::string Transpiler::transpileStatement(Statement* statement) {
+		// Nothing the statement evaluates is in tail position, other than its own call or branches
+		const bool tailPosition = function->tailPosition; 
+
+		function->tailPosition = false; 
+
+		auto reusedValue = reusedValues.find(statement); 
+
+		if (reusedValue != reusedValues.end())
+			return reusedValue->second; 
+
+		// Common expressions are evaluated the first time they're reached, and read afterwards
+		if (commonExprs.erase(statement)) {
+			const std::string value = transpileStatement(statement); 
+
+			reusedValues[statement] = value; 
+			return value; 
+		}
+
+		switch (statement->nodeType) {
+		case NodeType::VarDeclaration:
+		{
+			VarDeclaration* varDeclaration = dynamic_cast<VarDeclaration*>(statement); 
+			const std::string value = transpileStoredValue(varDeclaration->expr); 
+
+			line() << "declareCompiledVariable(scope, \"" << varDeclaration->identifier << "\", " 
+				<< value << ", " << (varDeclaration->constant ? "true" : "false") << ", " 
+					<< findVariable(varDeclaration->identifier) << ");\n"; 
+			return value; 
+		}
+		case NodeType::FuncDeclaration:
+			return transpileFuncDeclaration(dynamic_cast<FuncDeclaration*>(statement)); 
+		case NodeType::DishDeclaration:
+			return transpileDishDeclaration(dynamic_cast<DishDeclaration*>(statement)); 
+		case NodeType::IfStatement:
+			return transpileIfStatement(dynamic_cast<IfStatement*>(statement), tailPosition); 
+		case NodeType::WhileStatement:
+			return transpileWhileStatement(dynamic_cast<WhileStatement*>(statement)); 
+		case NodeType::ForStatement:
+			return transpileForStatement(dynamic_cast<ForStatement*>(statement)); 
+		case NodeType::BreakStatement:
+		case NodeType::ContinueStatement:
+		{
+			const Loop& loop = function->loops.back(); 
+
+			line() << loop.value << " = globalMemory->create<NullValue>();\n"; 
+
+			if (statement->nodeType == NodeType::BreakStatement)
+				line() << "break;\n"; 
+			else if (loop.continueLabel.empty())
+				line() << "continue;\n"; 
+			else
+				line() << "goto " << loop.continueLabel << ";\n"; 
+
+			return loop.value; 
+		}
+		case NodeType::ReturnStatement:
+		{
+			// Returned calls are in tail position, wherever the return statement is
+			function->tailPosition = true; 
+
+			const std::string value = transpileStoredValue(
+				dynamic_cast<ReturnStatement*>(statement)->expr
+			); 
+
+			line() << "return " << value << ";\n"; 
+			return value; 
+		}
+		case NodeType::NullLiteral:
+		{
+			const std::string value = allocateValue(); 
+			line() << "RuntimeValue* " << value << " = globalMemory->create<NullValue>();\n"; 
+			return value; 
+		}
+		case NodeType::NumLiteral:
+		{
+			const NumLiteral* numLiteral = dynamic_cast<const NumLiteral*>(statement); 
+			std::ostringstream creation; 
+
+			if (numLiteral->integral)
+				creation << "createCompiledInteger(INT64_C(" << numLiteral->integer << "))"; 
+			else if (!std::isfinite(numLiteral->value))
+				creation << "createCompiledNumber(HUGE_VAL)"; 
+			// Written in hexadecimal, so the double is read back exactly
+			else
+				creation << "createCompiledNumber(" << std::hexfloat << numLiteral->value << ")"; 
+
+			return addConstant(creation.str()); 
+		}
+		case NodeType::StringLiteral:
+		{
+			const StringLiteral* stringLiteral = dynamic_cast<const StringLiteral*>(statement); 
+			// The literal's value starts with its opening quote
+			const std::string string = stringLiteral->value.substr(1); 
+
+			return addConstant(
+				"createCompiledString(" + quoteString(string) + ", " + std::to_string(string.size())
+					+ ")"
+			); 
+		}
+		case NodeType::ListLiteral:
+		{
+			const ListLiteral* listLiteral = dynamic_cast<const ListLiteral*>(statement); 
+			std::vector<std::string> elements; 
+
+			for (auto* element : listLiteral->elements)
+				elements.push_back(transpileStoredValue(element)); 
+
+			const std::string value = allocateValue(); 
+
+			line() << "ListValue* " << value << " = globalMemory->create<ListValue>();\n"; 
+
+			for (auto& element : elements)
+				line() << value << "->append(" << element << ");\n"; 
+
+			return value; 
+		}
+		case NodeType::Identifier:
+		{
+			const Identifier* identifier = dynamic_cast<const Identifier*>(statement); 
+			const std::string value = allocateValue(); 
+
+			line() << "RuntimeValue* " << value << " = " << loadVariable(identifier->name) 
+				<< "->runtimeValue;\n"; 
+			return value; 
+		}
+		case NodeType::FieldAccesser:
+		{
+			std::string dish; 
+			const std::string slot = transpileFieldAccesser(
+				dynamic_cast<FieldAccesser*>(statement), dish
+			); 
+			const std::string value = allocateValue(); 
+
+			line() << "RuntimeValue* " << value << " = " << dish << "->slots[" << slot << "];\n"; 
+			return value; 
+		}
+		case NodeType::UnaryExpr:
+		{
+			UnaryExpr* unaryExpr = dynamic_cast<UnaryExpr*>(statement); 
+			const std::string value = allocateValue(); 
+
+			// Noodles are incremented and decremented in place
+			if (unaryExpr->expr->nodeType == NodeType::Identifier 
+				&& (unaryExpr->operation == "++" || unaryExpr->operation == "--")) 
+			{
+				line() << "RuntimeValue* " << value << " = stepCompiledVariable(" 
+					<< loadVariable(dynamic_cast<const Identifier*>(unaryExpr->expr)->name) 
+						<< "->runtimeValue, " << (unaryExpr->operation == "++" ? "true" : "false") 
+							<< ");\n"; 
+				return value; 
+			}
+
+			const std::string operand = transpileStatement(unaryExpr->expr); 
+
+			line() << "RuntimeValue* " << value << " = evaluateUnaryValue(" << operand << ", " 
+				<< quoteString(unaryExpr->operation) << ");\n"; 
+			return value; 
+		}
+		case NodeType::BinaryExpr:
+		{
+			BinaryExpr* binaryExpr = dynamic_cast<BinaryExpr*>(statement); 
+			// Both sides are always evaluated, as the tree walker doesn't short-circuit
+			const std::string left = transpileStatement(binaryExpr->leftExpr); 
+			const std::string right = transpileStatement(binaryExpr->rightExpr); 
+			const int operation = findBinaryOperation(binaryExpr->operation); 
+			const std::string value = allocateValue(); 
+
+			if (operation == 14) {
+				line() << "RuntimeValue* " << value << " = evaluateBinaryValues(" << left << ", " 
+					<< right << ", " << quoteString(binaryExpr->operation) << ");\n"; 
+			}
+			else {
+				line() << "RuntimeValue* " << value << " = evaluateCompiledBinary(" << left << ", " 
+					<< right << ", BinaryOperation::" << binaryOperationEnums[operation] << ");\n"; 
+			}
+
+			return value; 
+		}
+		case NodeType::AssignmentExpr:
+			return transpileAssignmentExpr(dynamic_cast<AssignmentExpr*>(statement)); 
+		case NodeType::FuncCall:
+			return transpileFuncCall(dynamic_cast<FuncCall*>(statement), tailPosition); 
+		case NodeType::InlinedCall:
+			return transpileInlinedCall(dynamic_cast<InlinedCall*>(statement)); 
+		default:
+		{
+			std::ostringstream message; 
+
+			// Nodes the interpreter can't evaluate throw the same error once they're reached
+			message << "Unimplemented AST node " << static_cast<int>(statement->nodeType) 
+				<< " found."; 
+			line() << "throw Error(Error::Location::Interpreter, 5, " 
+				<< quoteString(message.str()) << ");\n"; 
+
+			const std::string value = allocateValue(); 
+			line() << "RuntimeValue* " << value << " = nullptr;\n"; 
+			return value; 
+		}
+		}
+	}
+	std::string Transpiler::transpileStoredValue(Statement* statement) {
+		const std::string value = transpileStatement(statement); 
+
+		if (!isConstant(value))
+			return value; 
+
+		const std::string copy = allocateValue(); 
+
+		line() << "RuntimeValue* " << copy << " = cloneRuntimeValue(" << value << ");\n"; 
+		return copy; 
+	}
+	std::string Transpiler::transpileAssignedValue(Expr* expr) {
+		const std::string value = transpileStatement(expr); 
+
+		// Binary expressions always result in a new value, which nothing else holds yet, unless
+		// it's hoisted out of the loop or common to several statements, and so read again
+		if (expr->nodeType == NodeType::BinaryExpr && !reusedValues.count(expr))
+			return value; 
+
+		const std::string copy = allocateValue(); 
+
+		line() << "RuntimeValue* " << copy << " = cloneRuntimeValue(" << value << ");\n"; 
+		return copy; 
+	}
+	std::string Transpiler::transpileFuncDeclaration(FuncDeclaration* funcDeclaration) {
+		const std::string recipe = "recipe" + std::to_string(recipeCount++) + "_" 
+			+ funcDeclaration->name; 
+		const std::string value = allocateValue(); 
+
+		transpileFunction(
+			"static RuntimeValue* " + recipe + "(Scope* scope)", funcDeclaration->statements, true
+		); 
+
+		line() << "RuntimeValue* " << value << " = declareCompiledRecipe(scope, \"" 
+			<< funcDeclaration->name << "\", {"; 
+
+		for (size_t parameterIndex = 0; parameterIndex < funcDeclaration->parameters.size(); 
+			parameterIndex++) 
+		{
+			function->code << (parameterIndex == 0 ? " \"" : ", \"") 
+				<< funcDeclaration->parameters[parameterIndex] << "\""; 
+		}
+
+		function->code << " }, " << recipe << ", " << (funcDeclaration->pure ? "true" : "false") 
+			<< ", " << findVariable(funcDeclaration->name) << ");\n"; 
+		return value; 
+	}
+	std::string Transpiler::transpileDishDeclaration(DishDeclaration* dishDeclaration) {
+		const std::string dish = "dish" + std::to_string(dishCount++) + "_" 
+			+ dishDeclaration->name; 
+		const std::string signature = "static RuntimeValue* " + dish 
+			+ "(const DishShape* dishShape, size_t slot)"; 
+		Function defaults; 
+		Function* enclosingFunction = function; 
+
+		// Defaults are evaluated in the scope the dish was declared in, each time a dish is 
+		// created without them
+		function = &defaults; 
+		line() << "Scope* scope = dishShape->scope;\n\n"; 
+		line() << "switch (slot) {\n"; 
+
+		for (size_t fieldIndex = 0; fieldIndex < dishDeclaration->fields.size(); fieldIndex++) {
+			Expr* defaultExpr = dishDeclaration->fields[fieldIndex]->expr; 
+
+			if (defaultExpr->nodeType == NodeType::NullLiteral)
+				continue; 
+
+			line() << "case " << fieldIndex << ":\n"; 
+			line() << "{\n"; 
+			function->indentation++; 
+
+			const std::string value = transpileStatement(defaultExpr); 
+			line() << "return " << value << ";\n"; 
+			function->indentation--; 
+			line() << "}\n"; 
+		}
+
+		line() << "default:\n"; 
+		line() << "\treturn nullptr;\n"; 
+		line() << "}\n"; 
+		function = enclosingFunction; 
+
+		prototypes << signature << ";\n"; 
+		definitions << signature << " {\n"; 
+
+		for (auto& name : defaults.names)
+			definitions << "\tScope::Variable* " << variableLocal(name) << " = nullptr;\n"; 
+
+		definitions << defaults.code.str() << "}\n"; 
+
+		const std::string value = allocateValue(); 
+		std::string fields; 
+		std::string constantFields; 
+
+		for (auto* field : dishDeclaration->fields) {
+			fields += (fields.empty() ? " \"" : ", \"") + field->identifier + "\""; 
+			constantFields += std::string(constantFields.empty() ? " " : ", ") 
+				+ (field->constant ? "true" : "false"); 
+		}
+
+		line() << "RuntimeValue* " << value << " = declareCompiledDish(scope, \"" 
+			<< dishDeclaration->name << "\", {" << fields << " }, {" << constantFields << " }, " 
+				<< dish << ", " << findVariable(dishDeclaration->name) << ");\n"; 
+		return value; 
+	}
+	std::string Transpiler::transpileIfStatement(IfStatement* ifStatement, bool tailPosition) {
+		const std::string value = allocateValue(); 
+
+		line() << "RuntimeValue* " << value << ";\n"; 
+
+		const std::string condition = transpileCondition(ifStatement->condition); 
+
+		line() << "if (" << condition << " == 1) {\n"; 
+		function->indentation++; 
+		function->tailPosition = tailPosition; 
+		transpileStatements(ifStatement->ifStatements, value); 
+		function->indentation--; 
+		line() << "}\n"; 
+		line() << "else if (" << condition << " == 0) {\n"; 
+		function->indentation++; 
+		function->tailPosition = tailPosition; 
+		transpileStatements(ifStatement->elseStatements, value); 
+		function->indentation--; 
+		line() << "}\n"; 
+		// Conditions that aren't bools skip both branches
+		line() << "else\n"; 
+		line() << "\t" << value << " = globalMemory->create<NullValue>();\n"; 
+		return value; 
+	}
+	std::string Transpiler::transpileWhileStatement(WhileStatement* whileStatement) {
+		const std::string value = allocateValue(); 
+
+		// Holds the value of the last statement evaluated, which is null if the body never runs
+		line() << "RuntimeValue* " << value << " = globalMemory->create<NullValue>();\n\n"; 
+
+		// Loops with invariant expressions check their condition once before evaluating them,
+		// and then at the end of each iteration
+		if (!whileStatement->invariants.empty()) {
+			const std::string entryCondition = transpileCondition(whileStatement->condition); 
+
+			line() << "if (expectLoopCondition(" << entryCondition << ") == 1) {\n"; 
+			function->indentation++; 
+
+			for (auto* invariant : whileStatement->invariants)
+				reusedValues[invariant] = transpileStatement(invariant); 
+
+			line() << "while (true) {\n"; 
+			function->indentation++; 
+
+			// Continue statements jump to the condition, so the body gets a block of its own
+			// that the jump leaves, rather than skipping the locals it declares
+			if (continuesLoop(whileStatement->statements)) {
+				const std::string label = "continue" + std::to_string(function->valueCount++); 
+
+				function->loops.push_back({ value, label }); 
+				line() << "{\n"; 
+				function->indentation++; 
+				transpileStatements(whileStatement->statements, value); 
+				function->indentation--; 
+				line() << "}\n"; 
+				line() << label << ":\n"; 
+			}
+			else {
+				function->loops.push_back({ value, "" }); 
+				transpileStatements(whileStatement->statements, value); 
+			}
+
+			function->loops.pop_back(); 
+
+			const std::string condition = transpileCondition(whileStatement->condition); 
+
+			line() << "if (expectLoopCondition(" << condition << ") != 1)\n"; 
+			line() << "\tbreak;\n"; 
+			function->indentation--; 
+			line() << "}\n"; 
+			function->indentation--; 
+			line() << "}\n"; 
+
+			for (auto* invariant : whileStatement->invariants)
+				reusedValues.erase(invariant); 
+
+			return value; 
+		}
+
+		line() << "while (true) {\n"; 
+		function->indentation++; 
+
+		// Conditions that aren't bools throw, like they do in the tree walker
+		const std::string condition = transpileCondition(whileStatement->condition); 
+
+		line() << "if (expectLoopCondition(" << condition << ") != 1)\n"; 
+		line() << "\tbreak;\n\n"; 
+		function->loops.push_back({ value, "" }); 
+		transpileStatements(whileStatement->statements, value); 
+		function->loops.pop_back(); 
+		function->indentation--; 
+		line() << "}\n"; 
+		return value; 
+	}
+	std::string Transpiler::transpileForStatement(ForStatement* forStatement) {
+		const std::string value = allocateValue(); 
+		const std::string loop = std::to_string(function->valueCount++); 
+		const std::string variable = findVariable(forStatement->identifier); 
+		const std::string name = "\"" + forStatement->identifier + "\""; 
+
+		// Holds the value of the last statement evaluated, which is null if the body never runs
+		line() << "RuntimeValue* " << value << " = globalMemory->create<NullValue>();\n"; 
+
+		if (forStatement->iterable != nullptr) {
+			const std::string iterable = transpileStatement(forStatement->iterable); 
+
+			line() << "const ListValue* list" << loop << " = expectIterable(" << iterable 
+				<< ");\n"; 
+			line() << variable << " = scope->declareLoopVariable(" << name 
+				<< ", globalMemory->create<NullValue>());\n"; 
+			line() << "RuntimeValue* owned" << loop << " = nullptr;\n"; 
+			line() << "int64_t index" << loop << " = 0;\n\n"; 
+			line() << "while (advanceElement(" << variable << "->runtimeValue, owned" << loop 
+				<< ", list" << loop << ", index" << loop << ")) {\n"; 
+		}
+		else {
+			const std::string start = transpileStatement(forStatement->start); 
+			const std::string end = transpileStatement(forStatement->end); 
+			const std::string step = transpileStatement(forStatement->step); 
+			const std::string range = "range" + loop; 
+
+			// The bounds are replaced by the loop's own copies, which leaves constants as they are
+			line() << "RuntimeValue* " << range << "[] = { " << start << ", " << end << ", " 
+				<< step << " };\n"; 
+			line() << "prepareRange(" << range << "[0], " << range << "[1], " << range 
+				<< "[2]);\n"; 
+			line() << variable << " = scope->declareLoopVariable(" << name 
+				<< ", cloneRuntimeValue(" << range << "[0]));\n"; 
+			line() << "RuntimeValue* owned" << loop << " = " << variable << "->runtimeValue;\n\n"; 
+			line() << "while (advanceCompiledRange(" << variable << "->runtimeValue, owned" << loop 
+				<< ", static_cast<NumValue*>(" << range << "[0]), static_cast<const NumValue*>(" 
+					<< range << "[1]), static_cast<const NumValue*>(" << range << "[2]))) {\n"; 
+		}
+
+		function->indentation++; 
+		function->loops.push_back({ value, "" }); 
+		transpileStatements(forStatement->statements, value); 
+		function->loops.pop_back(); 
+		function->indentation--; 
+		line() << "}\n"; 
+		return value; 
+	}
+	std::string Transpiler::transpileCondition(Expr* condition) {
+		const std::string state = "condition" + std::to_string(function->valueCount++); 
+
+		// Comparisons branch on their result directly, rather than storing it as a bool, unless
+		// it was already evaluated or is read again later
+		if (condition->nodeType == NodeType::BinaryExpr && !reusedValues.count(condition) 
+			&& !commonExprs.count(condition)) 
+		{
+			BinaryExpr* binaryExpr = dynamic_cast<BinaryExpr*>(condition); 
+			const int operation = findBinaryOperation(binaryExpr->operation); 
+
+			if (operation >= static_cast<int>(BinaryOperation::Equal) 
+				&& operation <= static_cast<int>(BinaryOperation::LessEqual)) 
+			{
+				const std::string left = transpileStatement(binaryExpr->leftExpr); 
+				const std::string right = transpileStatement(binaryExpr->rightExpr); 
+
+				line() << "const int " << state << " = compareCompiledValues(" << left << ", " 
+					<< right << ", BinaryOperation::" << binaryOperationEnums[operation] << ");\n"; 
+				return state; 
+			}
+		}
+
+		const std::string value = transpileStatement(condition); 
+
+		line() << "const int " << state << " = testCompiledCondition(" << value << ");\n"; 
+		return state; 
+	}
+	std::string Transpiler::transpileFieldAccesser(FieldAccesser* fieldAccesser, std::string& dish) {
+		const std::string object = transpileStatement(fieldAccesser->object); 
+		const std::string site = std::to_string(fieldSiteCount++); 
+
+		dish = allocateValue(); 
+		line() << "static const std::string field" << site << " = " 
+			<< quoteString(fieldAccesser->field) << ";\n"; 
+		line() << "static const DishShape* shape" << site << " = nullptr;\n"; 
+		line() << "static int slot" << site << " = 0;\n"; 
+		line() << "DishValue* " << dish << " = resolveDishField(" << object << ", field" << site 
+			<< ", shape" << site << ", slot" << site << ");\n"; 
+		return "slot" + site; 
+	}
+	std::string Transpiler::transpileAssignmentExpr(AssignmentExpr* assignmentExpr) {
+		if (assignmentExpr->assigne->nodeType == NodeType::FieldAccesser) {
+			FieldAccesser* fieldAccesser = dynamic_cast<FieldAccesser*>(assignmentExpr->assigne); 
+
+			// The dish's noodle can't be frozen
+			if (fieldAccesser->object->nodeType == NodeType::Identifier) {
+				const std::string& name = dynamic_cast<const Identifier*>(fieldAccesser->object)->name; 
+
+				line() << "verifyVariableAssignable(" << loadVariable(name) << ", \"" << name 
+					<< "\");\n"; 
+			}
+
+			std::string dish; 
+			const std::string slot = transpileFieldAccesser(fieldAccesser, dish); 
+
+			line() << "verifyFieldAssignable(" << dish << ", " << slot << ", " 
+				<< quoteString(fieldAccesser->field) << ");\n"; 
+
+			const std::string value = transpileAssignedValue(assignmentExpr->value); 
+
+			line() << dish << "->slots[" << slot << "] = " << value << ";\n"; 
+			return value; 
+		}
+		else if (assignmentExpr->assigne->nodeType != NodeType::Identifier) {
+			line() << "throw Error(Error::Location::Interpreter, 6, " 
+				<< "\"Invalid assigne referenced in assignment expression.\");\n"; 
+
+			const std::string value = allocateValue(); 
+			line() << "RuntimeValue* " << value << " = nullptr;\n"; 
+			return value; 
+		}
+
+		const std::string& name = dynamic_cast<const Identifier*>(assignmentExpr->assigne)->name; 
+		const std::string value = transpileAssignedValue(assignmentExpr->value); 
+
+		line() << "verifyVariableAssignable(" << loadVariable(name) << ", \"" << name << "\");\n"; 
+		line() << findVariable(name) << "->runtimeValue = " << value << ";\n"; 
+		return value; 
+	}
+	std::string Transpiler::transpileFuncCall(FuncCall* funcCall, bool tailPosition) {
+		const int nativeIndex = findNativeFunc(funcCall->caller); 
+		const std::string callee = allocateValue(); 
+		const std::string value = allocateValue(); 
+
+		line() << "RuntimeValue* " << callee << " = " << loadVariable(funcCall->caller) 
+			<< "->runtimeValue;\n"; 
+		line() << "RuntimeValue* " << value << ";\n"; 
+
+		// Recipes can shadow natives, so whether the native is called is only known once the
+		// noodle is looked up
+		if (nativeIndex != -1) {
+			line() << "if (isCompiledNative(" << callee << ", " << nativeIndex << ")) {\n"; 
+			function->indentation++; 
+
+			const std::string result = transpileNativeFuncCall(funcCall, nativeIndex); 
+			line() << value << " = " << result << ";\n"; 
+			function->indentation--; 
+			line() << "}\n"; 
+			line() << "else {\n"; 
+			function->indentation++; 
+		}
+
+		const std::string arguments = transpileArguments(funcCall->arguments, callee); 
+
+		line() << value << " = " << (tailPosition ? "tailCallCompiledRecipe(" : "callCompiledRecipe(") 
+			<< callee << ", \"" << funcCall->caller << "\", " << arguments << ", " 
+				<< funcCall->arguments.size() << ", scope);\n"; 
+
+		if (nativeIndex != -1) {
+			function->indentation--; 
+			line() << "}\n"; 
+		}
+
+		return value; 
+	}
+	std::string Transpiler::transpileInlinedCall(InlinedCall* inlinedCall) {
+		std::vector<std::string> arguments; 
+
+		// Every argument is evaluated before any parameter is bound, as they may read them
+		for (auto* argument : inlinedCall->arguments)
+			arguments.push_back(transpileStoredValue(argument)); 
+
+		for (size_t argumentIndex = 0; argumentIndex < arguments.size(); argumentIndex++) {
+			const std::string& parameter = inlinedCall->parameters[argumentIndex]; 
+
+			line() << "bindCompiledVariable(scope, \"" << parameter << "\", " 
+				<< arguments[argumentIndex] << ", " << findVariable(parameter) << ");\n"; 
+		}
+
+		const std::string value = allocateValue(); 
+
+		line() << "RuntimeValue* " << value << ";\n"; 
+		transpileStatements(inlinedCall->statements, value); 
+		return value; 
+	}
+	std::string Transpiler::transpileNativeFuncCall(FuncCall* funcCall, int nativeIndex) {
+		const size_t argumentCount = funcCall->arguments.size(); 
+		const int arity = nativeFuncArities[nativeIndex]; 
+
+		if (arity != -1 && static_cast<int>(argumentCount) != arity) {
+			line() << "verifyNativeArgumentCount(" << nativeIndex << ", \"" << funcCall->caller 
+				<< "\", " << argumentCount << ");\n"; 
+		}
+
+		if (nativeIndex == 0) { // serve
+			// Each argument is printed before the next one is evaluated
+			for (auto* argument : funcCall->arguments) {
+				const std::string value = transpileStatement(argument); 
+				line() << "serveRuntimeValue(" << value << ");\n"; 
+			}
+
+			return "globalMemory->create<NullValue>()"; 
+		}
+		else if (nativeIndex == 1) { // serveRaw
+			std::ostringstream source; 
+
+			for (auto* argument : funcCall->arguments) 
+				source << argument; 
+
+			line() << "std::cout << " << quoteString(source.str()) << ";\n"; 
+			return "globalMemory->create<NullValue>()"; 
+		}
+		// receive ignores its arguments, so they're never evaluated
+		else if (arity == -1)
+			return "callNativeFunc(" + std::to_string(nativeIndex) + ", nullptr, 0, nullptr)"; 
+
+		Expr* firstArgument = argumentCount > 0 ? funcCall->arguments[0] : nullptr; 
+		std::string storeStringArgument = "nullptr"; 
+
+		if (checksFrozenArgument(nativeIndex) && firstArgument->nodeType == NodeType::Identifier) {
+			const std::string& name = dynamic_cast<const Identifier*>(firstArgument)->name; 
+
+			line() << "verifyVariableAssignable(" << loadVariable(name) << ", \"" << name 
+				<< "\");\n"; 
+		}
+
+		if (storesStringArgument(nativeIndex) && firstArgument->nodeType == NodeType::Identifier) {
+			const std::string& name = dynamic_cast<const Identifier*>(firstArgument)->name; 
+
+			storeStringArgument = "[&](StringValue* ownedStringValue) -> void { " 
+				"Scope::assignVariable(" + loadVariable(name) + ", \"" + name 
+					+ "\", ownedStringValue); }"; 
+		}
+
+		std::vector<std::string> arguments; 
+
+		for (size_t argumentIndex = 0; argumentIndex < argumentCount; argumentIndex++) {
+			Expr* argument = funcCall->arguments[argumentIndex]; 
+
+			// Strings in dish fields are stored back into the dish they were read from
+			if (argumentIndex == 0 && storesStringArgument(nativeIndex) 
+				&& argument->nodeType == NodeType::FieldAccesser) 
+			{
+				std::string dish; 
+				const std::string slot = transpileFieldAccesser(
+					dynamic_cast<FieldAccesser*>(argument), dish
+				); 
+
+				arguments.push_back(dish + "->slots[" + slot + "]"); 
+				storeStringArgument = "[&](StringValue* ownedStringValue) -> void { " + dish 
+					+ "->slots[" + slot + "] = ownedStringValue; }"; 
+			}
+			else
+				arguments.push_back(transpileStoredValue(argument)); 
+		}
+
+		std::string argumentArray = "nullptr"; 
+
+		if (argumentCount > 0) {
+			argumentArray = "arguments" + std::to_string(function->valueCount++); 
+			line() << "RuntimeValue* " << argumentArray << "[] = {"; 
+
+			for (size_t argumentIndex = 0; argumentIndex < argumentCount; argumentIndex++)
+				function->code << (argumentIndex == 0 ? " " : ", ") << arguments[argumentIndex]; 
+
+			function->code << " };\n"; 
+		}
+
+		return "callNativeFunc(" + std::to_string(nativeIndex) + ", " + argumentArray + ", " 
+			+ std::to_string(argumentCount) + ", " + storeStringArgument + ")"; 
+	}
+	std::string Transpiler::transpileArguments(
+		const std::vector<Expr*>& arguments, const std::string& callee) 
+	{
+		if (arguments.empty())
+			return "nullptr"; 
+
+		const std::string argumentArray = "arguments" + std::to_string(function->valueCount++); 
+		const std::string argumentCount = argumentArray + "Count"; 
+
+		line() << "RuntimeValue* " << argumentArray << "[" << arguments.size() << "] = {};\n"; 
+		line() << "const size_t " << argumentCount << " = countCompiledArguments(" << callee 
+			<< ", " << arguments.size() << ");\n"; 
+
+		// Each argument is only evaluated if the ones before it were, so the locals they declare
+		// stay in scope for the arguments after them
+		for (size_t argumentIndex = 0; argumentIndex < arguments.size(); argumentIndex++) {
+			line() << "if (" << argumentCount << " > " << argumentIndex << ") {\n"; 
+			function->indentation++; 
+
+			const std::string value = transpileStoredValue(arguments[argumentIndex]); 
+			line() << argumentArray << "[" << argumentIndex << "] = " << value << ";\n"; 
+		}
+
+		for (size_t argumentIndex = 0; argumentIndex < arguments.size(); argumentIndex++) {
+			function->indentation--; 
+			line() << "}\n"; 
+		}
+
+		return argumentArray; 
+	}
+
+	std::ostream& Transpiler::line() {
+		for (int indentation = 0; indentation < function->indentation; indentation++)
+			function->code << '\t'; 
+
+		return function->code; 
+	}
+	std::string Transpiler::allocateValue() {
+		return "value" + std::to_string(function->valueCount++); 
+	}
+	std::string Transpiler::addConstant(const std::string& creation) {
+		const std::string constant = "constants[" + std::to_string(constantCount++) + "]"; 
+
+		constants << "\t" << constant << " = " << creation << ";\n"; 
+		return constant; 
+	}
+	std::string Transpiler::findVariable(const std::string& name) {
+		if (function->nameSet.insert(name).second)
+			function->names.push_back(name); 
+
+		return variableLocal(name); 
+	}
+	std::string Transpiler::loadVariable(const std::string& name) {
+		return "loadVariable(scope, \"" + name + "\", " + findVariable(name) + ")"; 
+	}
+
+	bool Transpiler::isConstant(const std::string& value) {
+		return value.compare(0, 10, "constants[") == 0; 
+	}
+	std::string Transpiler::variableLocal(const std::string& name) {
+		const size_t separator = name.find(':'); 
+
+		if (separator == std::string::npos)
+			return "noodle_" + name; 
+
+		return "inlined" + std::to_string(separator) + "_" + name.substr(0, separator) + "_" 
+			+ name.substr(separator + 1); 
+	}
+	std::string Transpiler::quoteString(const std::string& string) {
+		std::ostringstream quoted; 
+
+		quoted << '"'; 
+
+		for (const char chr : string) {
+			if (chr == '"' || chr == '\\')
+				quoted << '\\' << chr; 
+			else if (chr >= ' ' && chr <= '~')
+				quoted << chr; 
+			// Other characters are written as octal escapes, which never run into the next
+			else {
+				quoted << '\\' << std::oct << std::setw(3) << std::setfill('0') 
+					<< static_cast<int>(static_cast<unsigned char>(chr)) << std::dec; 
+			}
+		}
+
+		quoted << '"'; 
+		return quoted.str(); 
+	}
+}
\ No newline at end of file
@@ -1,759 +1,461 @@
-#include "../../../hdr/runtime/eval/Expressions.hpp"
-#include "../../../hdr/util/Error.hpp"
-
-namespace ns {
-	RuntimeValue* evaluateFuncCallExpr(FuncCall* funcCall, Scope* scope) {
-		FuncValue* funcValue = dynamic_cast<FuncValue*>(
-			scope->getVariableValue(funcCall->caller)
-		); 
-		
-		// Handle native functions seperately
-		if (funcValue->nativeFunc) 
-			return evaluateNativeFuncCallExpr(funcValue, funcCall, scope); 
-		
-		Scope* funcScope = globalMemory->create<Scope>(); 
-
-		funcScope->assignParent(scope); 
-
-		// Declare all of the parameters in the function scope
-		for (int parameterIndex = 0; parameterIndex < funcValue->parameters.size(); 
-			parameterIndex++) 
-		{
-			const std::string& parameter = funcValue->parameters[parameterIndex]; 
-			Expr* argument = funcCall->arguments[parameterIndex]; 
-
-			funcScope->declareVariable(parameter, evaluateASTNode(argument, scope)); 
-		}
-
-		RuntimeValue* result = globalMemory->create<NullValue>(); 
-
-		// Evaluate each function statement
-		for (auto& statement : funcValue->statements)
-			result = evaluateASTNode(statement, funcScope); 
-
-		return result; 
-	}
-	RuntimeValue* evaluateNativeFuncCallExpr(
-		FuncValue* funcValue, FuncCall* funcCall, Scope* scope) 
-	{
-		auto verifyArgumentCount = [&](int count) -> void {
-			const int argumentCount = funcCall->arguments.size(); 
-
-			// Throw error if argument counts aren't equal
-			if (argumentCount != count) {
-				throw Error(
-					Error::Location::Interpreter,
-					14,
-					"Cannot call recipe " + funcCall->caller + " with " 
-						+ std::to_string(argumentCount) 
-							+ (argumentCount == 1 ? " argument" : " arguments")
-				);
-			}
-		}; 
-
-		RuntimeValue* result = globalMemory->create<NullValue>(); 
-		
-		if (funcValue->name == nativeFuncNames[0]) { // serve
-			auto printEvaluatedArgument = [](const RuntimeValue* evaluatedArgument) -> void {
-				auto printEvaluatedArgumentImpl = [](const RuntimeValue* evaluatedArgument, 
-					auto& caller) -> void 
-				{
-					switch (evaluatedArgument->valueType) {
-					case ValueType::Number:
-					{
-						const NumValue* numberValue = dynamic_cast<const NumValue*>(
-							evaluatedArgument
-						);
-						std::cout << numberValue->value;
-						break;
-					}
-					case ValueType::Bool:
-					{
-						const BoolValue* boolValue = dynamic_cast<const BoolValue*>(evaluatedArgument);
-						std::cout << (boolValue->state ? "true" : "false");
-						break;
-					}
-					case ValueType::String:
-					{
-						const StringValue* stringValue = dynamic_cast<const StringValue*>(
-							evaluatedArgument
-						);
-						std::cout << stringValue->value;
-						break;
-					}
-					case ValueType::List:
-					{
-						const ListValue* listValue = dynamic_cast<const ListValue*>(evaluatedArgument);
-
-						std::cout << "[";
-
-						for (int elementIndex = 0; elementIndex < listValue->elements.size(); 
-							elementIndex++) 
-						{
-							const RuntimeValue* element = listValue->elements[elementIndex]; 
-							caller(element, caller); 
-
-							if (elementIndex < listValue->elements.size() - 1)
-								std::cout << " ";
-						}
-
-						std::cout << "]";
-						break;
-					}
-					}
-				}; 
-
-				printEvaluatedArgumentImpl(evaluatedArgument, printEvaluatedArgumentImpl); 
-			}; 
-
-			// Loop through the argument list and call local lambda
-			for (auto* argument : funcCall->arguments) {
-				const RuntimeValue* evaluatedArgument = evaluateASTNode(argument, scope); 
-				printEvaluatedArgument(evaluatedArgument); 
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[1]) { // serveRaw
-			for (auto* argument : funcCall->arguments) 
-				std::cout << argument;
-		}
-		else if (funcValue->name == nativeFuncNames[2]) { // receive
-			std::string input; 
-			std::getline(std::cin, input); 
-
-			StringValue* stringValue = globalMemory->create<StringValue>(); 
-
-			stringValue->value = input; 
-			result = stringValue; 
-		}
-		else if (funcValue->name == nativeFuncNames[3]) { // floor
-			verifyArgumentCount(1); 
-
-			const RuntimeValue* evaluatedArgument = evaluateASTNode(funcCall->arguments[0], scope);
-
-			switch (evaluatedArgument->valueType) {
-			case ValueType::Number:
-			{
-				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-					evaluatedArgument
-				); 
-
-				NumValue* numberValue = globalMemory->create<NumValue>(); 
-
-				numberValue->value = std::floor(evaluatedNumValue->value); 
-				result = numberValue; 
-			}
-				break;
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[4]) { // ceil
-			verifyArgumentCount(1);
-
-			const RuntimeValue* evaluatedArgument = evaluateASTNode(funcCall->arguments[0], scope);
-
-			switch (evaluatedArgument->valueType) {
-			case ValueType::Number:
-			{
-				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-					evaluatedArgument
-				);
-
-				NumValue* numberValue = globalMemory->create<NumValue>();
-
-				numberValue->value = std::ceil(evaluatedNumValue->value);
-				result = numberValue;
-			}
-				break;
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[5]) { // round
-			verifyArgumentCount(1);
-
-			const RuntimeValue* evaluatedArgument = evaluateASTNode(funcCall->arguments[0], scope);
-
-			switch (evaluatedArgument->valueType) {
-			case ValueType::Number:
-			{
-				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-					evaluatedArgument
-				);
-
-				NumValue* numberValue = globalMemory->create<NumValue>();
-
-				numberValue->value = std::round(evaluatedNumValue->value);
-				result = numberValue;
-			}
-				break;
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[6]) { // int
-			verifyArgumentCount(1);
-
-			const RuntimeValue* evaluatedArgument = evaluateASTNode(funcCall->arguments[0], scope);
-
-			switch (evaluatedArgument->valueType) {
-			case ValueType::Number:
-			{
-				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-					evaluatedArgument
-				);
-
-				NumValue* numberValue = globalMemory->create<NumValue>();
-
-				numberValue->value = evaluatedNumValue->value;
-				result = numberValue;
-				break;
-			}
-			case ValueType::String:
-			{
-				const StringValue* evaluatedStringValue = dynamic_cast<const StringValue*>(
-					evaluatedArgument
-				);
-
-				NumValue* numberValue = globalMemory->create<NumValue>(); 
-				numberValue->value = 0; 
-				result = numberValue; 
-
-				try {
-					numberValue->value = std::stod(evaluatedStringValue->value); 
-				}
-				catch (...) {}
-
-				break;
-			}
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[7]) { // bool
-			verifyArgumentCount(1);
-
-			const RuntimeValue* evaluatedArgument = evaluateASTNode(funcCall->arguments[0], scope);
-
-			switch (evaluatedArgument->valueType) {
-			case ValueType::Number:
-			{
-				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-					evaluatedArgument
-				);
-
-				BoolValue* boolValue = globalMemory->create<BoolValue>();
-
-				boolValue->state = evaluatedNumValue->value > 0;
-				result = boolValue;
-				break;
-			}
-			case ValueType::String:
-			{
-				const StringValue* evaluatedStringValue = dynamic_cast<const StringValue*>(
-					evaluatedArgument
-				);
-
-				BoolValue* boolValue = globalMemory->create<BoolValue>();
-
-				boolValue->state = evaluatedStringValue->value == "true"; 
-				result = boolValue;
-				break;
-			}
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[8]) { // str
-			verifyArgumentCount(1);
-
-			const RuntimeValue* evaluatedArgument = evaluateASTNode(funcCall->arguments[0], scope);
-
-			switch (evaluatedArgument->valueType) {
-			case ValueType::Number:
-			{
-				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-					evaluatedArgument
-				);
-
-				StringValue* stringValue = globalMemory->create<StringValue>();
-
-				stringValue->value = std::to_string(evaluatedNumValue->value); 
-				result = stringValue;
-				break;
-			}
-			case ValueType::Bool:
-			{
-				const BoolValue* evaluatedBoolValue = dynamic_cast<const BoolValue*>(
-					evaluatedArgument
-				);
-
-				StringValue* stringValue = globalMemory->create<StringValue>();
-
-				stringValue->value= evaluatedBoolValue->state ? "true" : "false"; 
-				result = stringValue;
-				break;
-			}
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[9]) { // pow
-			verifyArgumentCount(2);
-
-			const RuntimeValue* evaluatedArgument1 = evaluateASTNode(funcCall->arguments[0], scope);
-			const RuntimeValue* evaluatedArgument2 = evaluateASTNode(funcCall->arguments[1], scope);
-
-			if (evaluatedArgument1->valueType == ValueType::Number
-				&& evaluatedArgument2->valueType == ValueType::Number)
-			{
-				const NumValue* evaluatedNumValue1 = dynamic_cast<const NumValue*>(
-					evaluatedArgument1
-				);
-				const NumValue* evaluatedNumValue2 = dynamic_cast<const NumValue*>(
-					evaluatedArgument2
-				);
-
-				NumValue* numberValue = globalMemory->create<NumValue>(); 
-
-				numberValue->value = std::pow(
-					evaluatedNumValue1->value, evaluatedNumValue2->value
-				); 
-				result = numberValue; 
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[10]) { // sqrt
-			verifyArgumentCount(1);
-
-			const RuntimeValue* evaluatedArgument = evaluateASTNode(funcCall->arguments[0], scope);
-
-			if (evaluatedArgument->valueType == ValueType::Number) {
-				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-					evaluatedArgument
-				);
-		
-				NumValue* numberValue = globalMemory->create<NumValue>();
-
-				numberValue->value = std::sqrt(evaluatedNumValue->value); 
-				result = numberValue;
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[11]) { // len
-			verifyArgumentCount(1);
-
-			const RuntimeValue* evaluatedArgument = evaluateASTNode(funcCall->arguments[0], scope);
-			
-			if (evaluatedArgument->valueType == ValueType::String) {
-				const StringValue* evaluatedStringValue = dynamic_cast<const StringValue*>(
-					evaluatedArgument
-				);
-
-				NumValue* numberValue = globalMemory->create<NumValue>();
-
-				numberValue->value = evaluatedStringValue->value.size(); 
-				result = numberValue;
-			}
-			else if (evaluatedArgument->valueType == ValueType::List) {
-				const ListValue* evaluatedListValue = dynamic_cast<const ListValue*>(
-					evaluatedArgument
-				);
-
-				NumValue* numberValue = globalMemory->create<NumValue>();
-
-				numberValue->value = evaluatedListValue->elements.size(); 
-				result = numberValue;
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[12]) { // append
-			verifyArgumentCount(2);
-
-			RuntimeValue* evaluatedArgument1 = evaluateASTNode(funcCall->arguments[0], scope);
-			RuntimeValue* evaluatedArgument2 = evaluateASTNode(funcCall->arguments[1], scope);
-
-			if (evaluatedArgument1->valueType == ValueType::String) {
-				StringValue* evaluatedStringValue1 = dynamic_cast<StringValue*>(
-					evaluatedArgument1
-				);
-
-				if (evaluatedArgument2->valueType == ValueType::String) {
-					const StringValue* evaluatedStringValue2 = dynamic_cast<const StringValue*>(
-						evaluatedArgument2
-					);
-
-					evaluatedStringValue1->value += evaluatedStringValue2->value; 
-					result = evaluatedArgument1; 
-				}
-			}
-			else if (evaluatedArgument1->valueType == ValueType::List) {
-				ListValue* evaluatedListValue = dynamic_cast<ListValue*>(
-					evaluatedArgument1
-				);
-
-				evaluatedListValue->elements.push_back(evaluatedArgument2); 
-				result = evaluatedArgument1; 
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[13]) { // at
-			verifyArgumentCount(2); 
-
-			RuntimeValue* evaluatedArgument1 = evaluateASTNode(funcCall->arguments[0], scope);
-			RuntimeValue* evaluatedArgument2 = evaluateASTNode(funcCall->arguments[1], scope);
-
-			if (evaluatedArgument1->valueType == ValueType::String) {
-				StringValue* evaluatedStringValue = dynamic_cast<StringValue*>(
-					evaluatedArgument1
-				);
-
-				if (evaluatedArgument2->valueType == ValueType::Number) {
-					const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-						evaluatedArgument2
-					);
-
-					StringValue* resultStringValue = globalMemory->create<StringValue>(); 
-
-					resultStringValue->value = evaluatedStringValue->value[evaluatedNumValue->value]; 
-					result = resultStringValue; 
-				}
-			}
-			else if (evaluatedArgument1->valueType == ValueType::List) {
-				ListValue* evaluatedListValue = dynamic_cast<ListValue*>(
-					evaluatedArgument1
-				);
-
-				if (evaluatedArgument2->valueType == ValueType::Number) {
-					const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-						evaluatedArgument2
-					);
-
-					return evaluatedListValue->elements[evaluatedNumValue->value]; 
-				}
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[14]) { // set 
-			verifyArgumentCount(3);
-
-			if (funcCall->arguments[0]->nodeType == NodeType::Identifier) {
-				const Identifier* identifier = dynamic_cast<const Identifier*>(
-					funcCall->arguments[0]
-				);
-				
-				// If the variable is const, try to assign a value to it to throw an error
-				if (scope->isVariableConst(identifier->name)) 
-					scope->assignVariable(identifier->name, nullptr); 
-			}
-
-			RuntimeValue* evaluatedArgument1 = evaluateASTNode(funcCall->arguments[0], scope);
-			RuntimeValue* evaluatedArgument2 = evaluateASTNode(funcCall->arguments[1], scope);
-			RuntimeValue* evaluatedArgument3 = evaluateASTNode(funcCall->arguments[2], scope);
-
-			if (evaluatedArgument1->valueType == ValueType::String) {
-				StringValue* evaluatedStringValue = dynamic_cast<StringValue*>(
-					evaluatedArgument1
-				);
-
-				if (evaluatedArgument2->valueType == ValueType::Number) {
-					const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-						evaluatedArgument2
-					);
-
-					if (evaluatedArgument3->valueType == ValueType::String) {
-						const StringValue* evaluatedStringValue2 = dynamic_cast<StringValue*>(
-							evaluatedArgument3
-						);
-
-						evaluatedStringValue->value[evaluatedNumValue->value] = 
-							evaluatedStringValue2->value[0]; 
-					}
-				}
-			}
-			else if (evaluatedArgument1->valueType == ValueType::List) {
-				ListValue* evaluatedListValue = dynamic_cast<ListValue*>(evaluatedArgument1);
-
-				if (evaluatedArgument2->valueType == ValueType::Number) {
-					const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-						evaluatedArgument2
-					);
-
-					evaluatedListValue->elements[evaluatedNumValue->value] = 
-						cloneRuntimeValue(evaluatedArgument3); 
-				}
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[15]) { // pop
-			verifyArgumentCount(2); 
-
-			if (funcCall->arguments[0]->nodeType == NodeType::Identifier) {
-				const Identifier* identifier = dynamic_cast<const Identifier*>(
-					funcCall->arguments[0]
-				);
-
-				// If the variable is const, try to assign a value to it to throw an error
-				if (scope->isVariableConst(identifier->name))
-					scope->assignVariable(identifier->name, nullptr);
-			}
-
-			RuntimeValue* evaluatedArgument1 = evaluateASTNode(funcCall->arguments[0], scope);
-			RuntimeValue* evaluatedArgument2 = evaluateASTNode(funcCall->arguments[1], scope);
-
-			if (evaluatedArgument1->valueType == ValueType::String) {
-				StringValue* evaluatedStringValue = dynamic_cast<StringValue*>(
-					evaluatedArgument1
-				);
-
-				if (evaluatedArgument2->valueType == ValueType::Number) {
-					const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-						evaluatedArgument2
-					);
-					const int popIndex = evaluatedNumValue->value; 
-
-					StringValue* resultStringValue = globalMemory->create<StringValue>(); 
-					resultStringValue->value = evaluatedStringValue->value[popIndex]; 
-					evaluatedStringValue->value.erase(
-						evaluatedStringValue->value.begin() + popIndex
-					);
-					result = resultStringValue; 
-				}
-			}
-			else if (evaluatedArgument1->valueType == ValueType::List) {
-				ListValue* evaluatedListValue = dynamic_cast<ListValue*>(evaluatedArgument1);
-
-				if (evaluatedArgument2->valueType == ValueType::Number) {
-					const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-						evaluatedArgument2
-					);
-					const int popIndex = evaluatedNumValue->value; 
-
-					result = evaluatedListValue->elements[popIndex]; 
-					evaluatedListValue->elements.erase(
-						evaluatedListValue->elements.begin() + popIndex
-					); 
-				}
-			}
-		}
-		else if (funcValue->name == nativeFuncNames[16]) { // abs
-			verifyArgumentCount(1); 
-
-			const RuntimeValue* evaluatedArgument = evaluateASTNode(funcCall->arguments[0], scope); 
-
-			if (evaluatedArgument->valueType == ValueType::Number) {
-				const NumValue* evaluatedNumValue = dynamic_cast<const NumValue*>(
-					evaluatedArgument
-				); 
-				
-				NumValue* resultNumValue = globalMemory->create<NumValue>(); 
-
-				resultNumValue->value = std::abs(evaluatedNumValue->value); 
-				result = resultNumValue; 
-			}
-		}
-
-		return result;	
-	}
-	RuntimeValue* evaluateAssignmentExpr(AssignmentExpr* assignmentExpr, Scope* scope) {
-		if (assignmentExpr->assigne->nodeType != NodeType::Identifier)
-			throw Error(
-				Error::Location::Interpreter,
-				6,
-				"Invalid assigne referenced in assignment expression."
-			); 
-
-		const Identifier* identifier = dynamic_cast<const Identifier*>(assignmentExpr->assigne);
-		return scope->assignVariable(
-			identifier->name, cloneRuntimeValue(evaluateASTNode(assignmentExpr->value, scope))
-		);
-	}
-	RuntimeValue* evaluateUnaryExprNode(UnaryExpr* unaryExpr, Scope* scope) {
-		RuntimeValue* nodeEvaluated = evaluateASTNode(unaryExpr->expr, scope); 
-
-		if (nodeEvaluated->valueType == ValueType::Number) {
-			Identifier* identifier = dynamic_cast<Identifier*>(unaryExpr->expr);
-			NumValue* numberValue = dynamic_cast<NumValue*>(
-				scope->getVariableValue(identifier->name)
-			);
-
-			return evaluateNumericUnaryExpr(numberValue, unaryExpr->operation);
-		}
-		else if (nodeEvaluated->valueType == ValueType::Bool) {
-			BoolValue* boolValue = dynamic_cast<BoolValue*>(nodeEvaluated); 
-
-			return evaluateConditionalUnaryExpr(boolValue, unaryExpr->operation); 
-		}
-
-		return globalMemory->create<NullValue>(); 
-	}
-	RuntimeValue* evaluateNumericUnaryExpr(NumValue* numberValue, const std::string& operation) {
-		double& result = numberValue->value; 
-
-		if (operation == "-") {
-			NumValue* numberValueResult = globalMemory->create<NumValue>(); 
-			numberValueResult->value = -result;
-			return numberValueResult; 
-		}
-		else if (operation == "++")
-			result += 1.0;
-		else if (operation == "--")
-			result -= 1.0; 
-
-		return numberValue; 
-	}
-	RuntimeValue* evaluateConditionalUnaryExpr(BoolValue* boolValue, const std::string& operation) {
-		bool& state = boolValue->state; 
-
-		if (operation == "!") {
-			BoolValue* boolValueResult = globalMemory->create<BoolValue>(); 
-			boolValueResult->state = !state; 
-			return boolValueResult; 
-		}
-
-		return globalMemory->create<NullValue>();
-	}
-	RuntimeValue* evaluateBinaryExprNode(BinaryExpr* binaryExpr, Scope* scope) {
-		RuntimeValue* leftNodeEvaluated = evaluateASTNode(binaryExpr->leftExpr, scope);
-		RuntimeValue* rightNodeEvaluated = evaluateASTNode(binaryExpr->rightExpr, scope);
-
-		const ValueType leftNodeValueType = leftNodeEvaluated->valueType; 
-		const ValueType rightNodeValueType = rightNodeEvaluated->valueType; 
-
-		// Evaluates numeric binary expressions
-		if (leftNodeValueType == ValueType::Number && rightNodeValueType == ValueType::Number) {
-			NumValue* leftNumValue = dynamic_cast<NumValue*>(leftNodeEvaluated);
-			NumValue* rightNumValue = dynamic_cast<NumValue*>(rightNodeEvaluated);
-
-			return evaluateNumericBinaryExpr(
-				leftNumValue, rightNumValue, binaryExpr->operation
-			);
-		}
-		// Evaluates conditional binary expressions
-		else if (leftNodeValueType == ValueType::Bool && rightNodeValueType == ValueType::Bool) {
-			BoolValue* leftBoolValue = dynamic_cast<BoolValue*>(leftNodeEvaluated); 
-			BoolValue* rightBoolValue = dynamic_cast<BoolValue*>(rightNodeEvaluated); 
-
-			return evaluateConditionalBinaryExpr(
-				leftBoolValue, rightBoolValue, binaryExpr->operation
-			);
-		}
-		// Evaluates string binary expressions
-		else if (leftNodeValueType == ValueType::String 
-			&& rightNodeValueType == ValueType::String) 
-		{
-			StringValue* leftStringValue = dynamic_cast<StringValue*>(leftNodeEvaluated); 
-			StringValue* rightStringValue = dynamic_cast<StringValue*>(rightNodeEvaluated); 
-
-			return evaluateStringBinaryExpr(
-				leftStringValue, rightStringValue, binaryExpr->operation
-			); 
-		}
-
-		return globalMemory->create<NullValue>();
-	}
-	RuntimeValue* evaluateNumericBinaryExpr(
-		NumValue* leftNumValue, NumValue* rightNumValue, const std::string& operation)
-	{
-		RuntimeValue* result = globalMemory->create<NullValue>(); 
-
-		if (operation == "+") {
-			NumValue* numberResult = globalMemory->create<NumValue>(); 
-			numberResult->value = leftNumValue->value + rightNumValue->value;
-			result = numberResult; 
-		}
-		else if (operation == "-") {
-			NumValue* numberResult = globalMemory->create<NumValue>();
-			numberResult->value = leftNumValue->value - rightNumValue->value;
-			result = numberResult;
-		}
-		else if (operation == "*") {
-			NumValue* numberResult = globalMemory->create<NumValue>();
-			numberResult->value = leftNumValue->value * rightNumValue->value;
-			result = numberResult;
-		}
-		else if (operation == "/") {
-			NumValue* numberResult = globalMemory->create<NumValue>();
-
-			// Check if denominator is zero. If so, just return zero
-			if (rightNumValue->value == 0.0) {
-				numberResult = globalMemory->create<NumValue>();
-				numberResult->value = 0.0;
-			}
-			else {
-				numberResult = globalMemory->create<NumValue>();
-				numberResult->value = leftNumValue->value / rightNumValue->value;
-			}
-
-			result = numberResult;
-		}
-		else if (operation == "%") {
-			NumValue* numberResult = globalMemory->create<NumValue>();
-
-			// Check if denominator is zero. If so, just return zero
-			if (rightNumValue->value == 0.0) numberResult->value = 0.0;
-			else numberResult->value = std::fmod(leftNumValue->value, rightNumValue->value);
-
-			result = numberResult;
-		} 
-		else if (operation == "==") {
-			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
-			boolResult->state = leftNumValue->value == rightNumValue->value;
-			result = boolResult; 
-		}
-		else if (operation == "!=") {
-			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
-			boolResult->state = leftNumValue->value != rightNumValue->value; 
-			result = boolResult; 
-		}
-		else if (operation == ">") {
-			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
-			boolResult->state = leftNumValue->value > rightNumValue->value; 
-			result = boolResult; 
-		}
-		else if (operation == "<") {
-			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
-			boolResult->state = leftNumValue->value < rightNumValue->value; 
-			result = boolResult; 
-		}
-		else if (operation == ">=") {
-			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
-			boolResult->state = leftNumValue->value >= rightNumValue->value; 
-			result = boolResult; 
-		}
-		else if (operation == "<=") {
-			BoolValue* boolResult = globalMemory->create<BoolValue>();
-			boolResult->state = leftNumValue->value <= rightNumValue->value;
-			result = boolResult;
-		}
-		else if (operation == "**") {
-			NumValue* numberResult = globalMemory->create<NumValue>(); 
-			numberResult->value = std::pow(leftNumValue->value, rightNumValue->value); 
-			result = numberResult; 
-		}
-
-		return result;
-	}
-	RuntimeValue* evaluateConditionalBinaryExpr(
-		BoolValue* leftBoolValue, BoolValue* rightBoolValue, const std::string& operation) 
-	{
-		BoolValue* result = globalMemory->create<BoolValue>(); 
-		
-		if (operation == "&&")
-			result->state = leftBoolValue->state && rightBoolValue->state;
-		else if (operation == "||")
-			result->state = leftBoolValue->state || rightBoolValue->state; 
-		 
-		return result;
-	}
-	RuntimeValue* evaluateStringBinaryExpr(
-		StringValue* leftStringValue, StringValue* rightStringValue, 
-		const std::string& operation) 
-	{
-		RuntimeValue* result = globalMemory->create<NullValue>();
-
-		if (operation == "+") {
-			StringValue* stringResult = globalMemory->create<StringValue>();
-		    stringResult->value = leftStringValue->value + rightStringValue->value;
-			result = stringResult; 
-		}
-		else if (operation == "==") {
-			BoolValue* boolResult = globalMemory->create<BoolValue>(); 
-			boolResult->state = leftStringValue->value == rightStringValue->value; 
-			result = boolResult; 
-		}
-		else if (operation == "!=") {
-			BoolValue* boolResult = globalMemory->create<BoolValue>();
-			boolResult->state = leftStringValue->value != rightStringValue->value;
-			result = boolResult;
-		}
-
-		return result; 
-	}
-	RuntimeValue* evaluateIdentifier(Identifier* identifier, Scope* scope) {
-		RuntimeValue* value = scope->getVariableValue(identifier->name); 
-		return value; 
-	}
+#include "../../../hdr/runtime/eval/Expressions.hpp"
+#include "../../../hdr/runtime/vm/VirtualMachine.hpp"
+#include "../../../hdr/util/Error.hpp"
+
+#include <algorithm>
+
+namespace ns {
+	RuntimeValue* evaluateFuncCallExpr(FuncCall* funcCall, Scope* scope) {
+		FuncValue* funcValue = dynamic_cast<FuncValue*>(
+			scope->getVariableValue(funcCall->caller)
+		); 
+		
+		// Handle native functions seperately
+		if (funcValue->nativeFunc) 
+			return evaluateNativeFuncCallExpr(funcValue, funcCall, scope); 
+		else if (funcValue->dishShape != nullptr)
+			return evaluateDishConstruction(funcValue, funcCall, scope); 
+
+		enterRecipeCall(funcCall->caller, true); 
+
+		Scope* funcScope = createCallScope(funcValue, funcCall, scope); 
+		std::string cacheKey; 
+		const bool cachesResult = funcValue->cache != nullptr 
+			&& makeCallCacheKey(funcValue, funcScope, cacheKey); 
+
+		if (cachesResult) {
+			RuntimeValue* cachedResult = findCachedResult(funcValue, cacheKey); 
+
+			if (cachedResult != nullptr) {
+				leaveRecipeCall(); 
+				return cachedResult; 
+			}
+		}
+
+		// Recipes declared by bytecode keep running as bytecode when called by the tree walker
+		RuntimeValue* result = funcValue->chunk != nullptr 
+			? executeChunk(funcValue->chunk, funcScope) : evaluateRecipeBody(funcValue, funcScope); 
+
+		if (cachesResult)
+			storeCachedResult(funcValue, cacheKey, result); 
+
+		leaveRecipeCall(); 
+		return result; 
+	}
+	RuntimeValue* evaluateRecipeBody(FuncValue* funcValue, Scope* funcScope) {
+		while (true) {
+			FuncCall* tailCall = nullptr; 
+			RuntimeValue* result = evaluateTailStatements(funcValue->statements, funcScope, tailCall); 
+
+			// Return statements end the body with their value
+			pendingTransfer = ControlTransfer::None; 
+
+			if (tailCall == nullptr)
+				return result; 
+
+			FuncValue* callee = dynamic_cast<FuncValue*>(
+				funcScope->getVariableValue(tailCall->caller)
+			); 
+
+			// Natives, dishes and recipes running as bytecode are called like in any other position
+			if (callee == nullptr || callee->nativeFunc || callee->dishShape != nullptr 
+				|| callee->chunk != nullptr) 
+			{
+				return evaluateFuncCallExpr(tailCall, funcScope); 
+			}
+
+			funcScope = createCallScope(
+				callee, tailCall, funcScope, callee == funcValue && callee->reusesScope
+			); 
+			funcValue = callee; 
+
+			// Tail calls only look their result up, as the call that started the body stores 
+			// the result it ends with
+			std::string cacheKey; 
+
+			if (funcValue->cache != nullptr && makeCallCacheKey(funcValue, funcScope, cacheKey)) {
+				RuntimeValue* cachedResult = findCachedResult(funcValue, cacheKey); 
+
+				if (cachedResult != nullptr)
+					return cachedResult; 
+			}
+		}
+	}
+	RuntimeValue* evaluateTailStatements(
+		const std::vector<Statement*>& statements, Scope* scope, FuncCall*& tailCall) 
+	{
+		RuntimeValue* result = globalMemory->create<NullValue>(); 
+
+		if (statements.empty())
+			return result; 
+
+		for (size_t statementIndex = 0; statementIndex < statements.size() - 1; statementIndex++) {
+			result = evaluateASTNode(statements[statementIndex], scope); 
+
+			if (pendingTransfer != ControlTransfer::None)
+				return result; 
+		}
+
+		Statement* lastStatement = statements.back(); 
+
+		// Returning the call leaves it in tail position, like the call on its own
+		if (lastStatement->nodeType == NodeType::ReturnStatement 
+			&& dynamic_cast<ReturnStatement*>(lastStatement)->expr->nodeType == NodeType::FuncCall)
+		{
+			lastStatement = dynamic_cast<ReturnStatement*>(lastStatement)->expr; 
+		}
+
+		if (lastStatement->nodeType == NodeType::FuncCall) {
+			tailCall = dynamic_cast<FuncCall*>(lastStatement); 
+			return nullptr; 
+		}
+		// The last statement of a branch is in tail position when the if statement is
+		else if (lastStatement->nodeType == NodeType::IfStatement) {
+			const IfStatement* ifStatement = dynamic_cast<const IfStatement*>(lastStatement); 
+			const RuntimeValue* condition = evaluateASTNode(ifStatement->condition, scope); 
+
+			if (condition->valueType != ValueType::Bool)
+				return globalMemory->create<NullValue>(); 
+
+			return evaluateTailStatements(
+				static_cast<const BoolValue*>(condition)->state 
+					? ifStatement->ifStatements : ifStatement->elseStatements, 
+				scope, 
+				tailCall
+			); 
+		}
+
+		return evaluateASTNode(lastStatement, scope); 
+	}
+	Scope* createCallScope(FuncValue* funcValue, FuncCall* funcCall, Scope* scope, bool reusesScope) {
+		const size_t parameterCount = funcValue->parameters.size(); 
+
+		if (funcCall->arguments.size() < parameterCount) {
+			throw Error(
+				Error::Location::Interpreter,
+				14,
+				"Cannot call recipe " + funcCall->caller + " with "
+					+ std::to_string(funcCall->arguments.size())
+						+ (funcCall->arguments.size() == 1 ? " argument" : " arguments")
+			);
+		}
+		else if (reusesScope) {
+			// Every argument is evaluated before the parameters are assigned, as they may read them
+			std::vector<RuntimeValue*> arguments; 
+
+			for (size_t parameterIndex = 0; parameterIndex < parameterCount; parameterIndex++)
+				arguments.push_back(evaluateASTNode(funcCall->arguments[parameterIndex], scope)); 
+
+			for (size_t parameterIndex = 0; parameterIndex < parameterCount; parameterIndex++) {
+				scope->findVariable(funcValue->parameters[parameterIndex])->runtimeValue = 
+					arguments[parameterIndex]; 
+			}
+
+			return scope; 
+		}
+
+		Scope* funcScope = globalMemory->create<Scope>(); 
+
+		funcScope->assignParent(scope); 
+
+		// Declare all of the parameters in the function scope
+		for (size_t parameterIndex = 0; parameterIndex < parameterCount; parameterIndex++) {
+			funcScope->declareVariable(
+				funcValue->parameters[parameterIndex], 
+				evaluateASTNode(funcCall->arguments[parameterIndex], scope)
+			); 
+		}
+
+		return funcScope; 
+	}
+	bool makeCallCacheKey(FuncValue* funcValue, Scope* funcScope, std::string& key) {
+		std::vector<RuntimeValue*> arguments; 
+
+		for (auto& parameter : funcValue->parameters)
+			arguments.push_back(funcScope->findVariable(parameter)->runtimeValue); 
+
+		return makeRecipeCacheKey(arguments.data(), arguments.size(), key); 
+	}
+	RuntimeValue* evaluateNativeFuncCallExpr(
+		FuncValue* funcValue, FuncCall* funcCall, Scope* scope) 
+	{
+		const int nativeIndex = findNativeFunc(funcValue->name); 
+		const size_t argumentCount = funcCall->arguments.size(); 
+
+		verifyNativeArgumentCount(nativeIndex, funcCall->caller, argumentCount); 
+
+		if (nativeIndex == 0) { // serve
+			// Each argument is printed before the next one is evaluated
+			for (auto* argument : funcCall->arguments) 
+				serveRuntimeValue(evaluateASTNode(argument, scope)); 
+
+			return globalMemory->create<NullValue>(); 
+		}
+		else if (nativeIndex == 1) { // serveRaw
+			for (auto* argument : funcCall->arguments) 
+				std::cout << argument;
+
+			return globalMemory->create<NullValue>(); 
+		}
+		// receive ignores its arguments, so they're never evaluated
+		else if (nativeFuncArities[nativeIndex] == -1)
+			return callNativeFunc(nativeIndex, nullptr, 0, nullptr); 
+
+		if (checksFrozenArgument(nativeIndex) 
+			&& funcCall->arguments[0]->nodeType == NodeType::Identifier) 
+		{
+			const Identifier* identifier = dynamic_cast<const Identifier*>(funcCall->arguments[0]); 
+
+			// If the variable is const, try to assign a value to it to throw an error
+			if (scope->isVariableConst(identifier->name))
+				scope->assignVariable(identifier->name, nullptr); 
+		}
+
+		// Natives take at most three arguments
+		RuntimeValue* arguments[3]; 
+
+		for (size_t argumentIndex = 0; argumentIndex < argumentCount; argumentIndex++)
+			arguments[argumentIndex] = evaluateASTNode(funcCall->arguments[argumentIndex], scope); 
+
+		return callNativeFunc(
+			nativeIndex, arguments, argumentCount, [&](StringValue* ownedStringValue) -> void {
+				Expr* argument = funcCall->arguments[0]; 
+
+				if (argument->nodeType == NodeType::Identifier) {
+					const Identifier* identifier = dynamic_cast<const Identifier*>(argument); 
+					scope->assignVariable(identifier->name, ownedStringValue); 
+				}
+				else if (argument->nodeType == NodeType::FieldAccesser) {
+					int slot; 
+					DishValue* dishValue = evaluateFieldObject(
+						dynamic_cast<FieldAccesser*>(argument), scope, slot
+					); 
+
+					dishValue->slots[slot] = ownedStringValue; 
+				}
+			}
+		); 
+	}
+	RuntimeValue* evaluateDishConstruction(FuncValue* funcValue, FuncCall* funcCall, Scope* scope) {
+		std::vector<RuntimeValue*> arguments; 
+
+		arguments.reserve(funcCall->arguments.size()); 
+
+		for (auto* argument : funcCall->arguments)
+			arguments.push_back(evaluateASTNode(argument, scope)); 
+
+		return createDishValue(funcValue->dishShape, arguments.data(), arguments.size());
+	}
+	RuntimeValue* evaluateInlinedCall(InlinedCall* inlinedCall, Scope* scope) {
+		std::vector<RuntimeValue*> arguments;
+
+		arguments.reserve(inlinedCall->arguments.size());
+
+		// Like a call, every argument is evaluated before any parameter is bound
+		for (auto* argument : inlinedCall->arguments)
+			arguments.push_back(evaluateASTNode(argument, scope));
+
+		for (size_t parameterIndex = 0; parameterIndex < arguments.size(); parameterIndex++)
+			scope->bindVariable(inlinedCall->parameters[parameterIndex], arguments[parameterIndex]);
+
+		RuntimeValue* result = globalMemory->create<NullValue>();
+
+		for (auto* statement : inlinedCall->statements)
+			result = evaluateASTNode(statement, scope);
+
+		return result;
+	}
+	RuntimeValue* evaluateAssignmentExpr(AssignmentExpr* assignmentExpr, Scope* scope) {
+		if (assignmentExpr->assigne->nodeType == NodeType::FieldAccesser) {
+			FieldAccesser* fieldAccesser = dynamic_cast<FieldAccesser*>(assignmentExpr->assigne); 
+
+			if (fieldAccesser->object->nodeType == NodeType::Identifier) {
+				const Identifier* identifier = dynamic_cast<const Identifier*>(fieldAccesser->object); 
+
+				// If the variable is const, try to assign a value to it to throw an error
+				if (scope->isVariableConst(identifier->name))
+					scope->assignVariable(identifier->name, nullptr);
+			}
+
+			int slot; 
+			DishValue* dishValue = evaluateFieldObject(fieldAccesser, scope, slot); 
+
+			if (dishValue->shape->constantFields[slot]) {
+				throw Error(
+					Error::Location::Interpreter,
+					3,
+					"Cannot redeclare noodle " + fieldAccesser->field + " as it is a frozen noodle."
+				); 
+			}
+
+			RuntimeValue* value = cloneRuntimeValue(evaluateASTNode(assignmentExpr->value, scope)); 
+
+			dishValue->slots[slot] = value; 
+			return value; 
+		}
+		else if (assignmentExpr->assigne->nodeType != NodeType::Identifier)
+			throw Error(
+				Error::Location::Interpreter,
+				6,
+				"Invalid assigne referenced in assignment expression."
+			); 
+
+		const Identifier* identifier = dynamic_cast<const Identifier*>(assignmentExpr->assigne);
+		return scope->assignVariable(
+			identifier->name, cloneRuntimeValue(evaluateASTNode(assignmentExpr->value, scope))
+		);
+	}
+	RuntimeValue* evaluateUnaryExprNode(UnaryExpr* unaryExpr, Scope* scope) {
+		return evaluateUnaryValue(evaluateASTNode(unaryExpr->expr, scope), unaryExpr->operation); 
+	}
+	RuntimeValue* evaluateBinaryExprNode(BinaryExpr* binaryExpr, Scope* scope) {
+		// Operations only read their operands, so numbers read from numeric lists are unboxed 
+		// into values of this evaluation rather than new ones
+		NumValue leftElement; 
+		NumValue rightElement; 
+		RuntimeValue* leftNodeEvaluated = evaluateOperandNode(
+			binaryExpr->leftExpr, scope, &leftElement
+		);
+		RuntimeValue* rightNodeEvaluated = evaluateOperandNode(
+			binaryExpr->rightExpr, scope, &rightElement
+		);
+		const ValueType leftNodeValueType = leftNodeEvaluated->valueType; 
+		const ValueType rightNodeValueType = rightNodeEvaluated->valueType; 
+		const BinaryOperation operation = binaryExpr->binaryOperation; 
+
+		// Specialized expressions skip dispatching on the operand types and the operation's 
+		// name, as long as their operands keep the types they were specialized for
+		switch (binaryExpr->specialization) {
+		case BinaryExpr::Specialization::Unspecialized:
+			specializeBinaryExpr(binaryExpr, leftNodeEvaluated, rightNodeEvaluated); 
+			break; 
+		case BinaryExpr::Specialization::Number:
+			if (leftNodeValueType == ValueType::Number && rightNodeValueType == ValueType::Number) {
+				return evaluateNumberOperation(
+					static_cast<NumValue*>(leftNodeEvaluated), 
+					static_cast<NumValue*>(rightNodeEvaluated), 
+					operation
+				); 
+			}
+
+			binaryExpr->specialization = BinaryExpr::Specialization::Generic; 
+			break; 
+		case BinaryExpr::Specialization::Bool:
+			if (leftNodeValueType == ValueType::Bool && rightNodeValueType == ValueType::Bool) {
+				const bool leftState = static_cast<BoolValue*>(leftNodeEvaluated)->state; 
+				const bool rightState = static_cast<BoolValue*>(rightNodeEvaluated)->state; 
+				BoolValue* boolResult = globalMemory->create<BoolValue>(); 
+
+				boolResult->state = operation == BinaryOperation::And 
+					? leftState && rightState : leftState || rightState; 
+				return boolResult; 
+			}
+
+			binaryExpr->specialization = BinaryExpr::Specialization::Generic; 
+			break; 
+		case BinaryExpr::Specialization::String:
+			if (leftNodeValueType == ValueType::String && rightNodeValueType == ValueType::String) {
+				StringValue* leftStringValue = static_cast<StringValue*>(leftNodeEvaluated); 
+				StringValue* rightStringValue = static_cast<StringValue*>(rightNodeEvaluated); 
+
+				if (operation == BinaryOperation::Add)
+					return concatStringValues(leftStringValue, rightStringValue); 
+
+				BoolValue* boolResult = globalMemory->create<BoolValue>(); 
+				boolResult->state = equalStringValues(leftStringValue, rightStringValue) 
+					== (operation == BinaryOperation::Equal); 
+				return boolResult; 
+			}
+
+			binaryExpr->specialization = BinaryExpr::Specialization::Generic; 
+			break; 
+		default:
+			break; 
+		}
+
+		return evaluateBinaryValues(leftNodeEvaluated, rightNodeEvaluated, binaryExpr->operation); 
+	}
+	RuntimeValue* evaluateOperandNode(Expr* operand, Scope* scope, NumValue* element) {
+		FuncCall* funcCall = operand->nodeType == NodeType::FuncCall 
+			? static_cast<FuncCall*>(operand) : nullptr; 
+
+		if (funcCall == nullptr || funcCall->arguments.size() != 2 
+			|| funcCall->caller != nativeFuncNames[13]) 
+		{
+			return evaluateASTNode(operand, scope); 
+		}
+
+		FuncValue* funcValue = dynamic_cast<FuncValue*>(scope->getVariableValue(funcCall->caller)); 
+
+		if (funcValue == nullptr || !funcValue->nativeFunc)
+			return evaluateFuncCallExpr(funcCall, scope); 
+
+		RuntimeValue* arguments[2] = { 
+			evaluateASTNode(funcCall->arguments[0], scope), 
+			evaluateASTNode(funcCall->arguments[1], scope) 
+		}; 
+
+		if (arguments[0]->valueType == ValueType::List 
+			&& arguments[1]->valueType == ValueType::Number) 
+		{
+			return static_cast<ListValue*>(arguments[0])->at(
+				static_cast<NumValue*>(arguments[1])->toInteger(), element
+			); 
+		}
+
+		return callNativeFunc(13, arguments, 2, nullptr); 
+	}
+	void specializeBinaryExpr(
+		BinaryExpr* binaryExpr, const RuntimeValue* leftNodeEvaluated, 
+		const RuntimeValue* rightNodeEvaluated) 
+	{
+		const ValueType valueType = leftNodeEvaluated->valueType; 
+		const int operationIndex = std::find(
+			binaryOperationNames, binaryOperationNames + 14, binaryExpr->operation
+		) - binaryOperationNames; 
+		const BinaryOperation operation = static_cast<BinaryOperation>(operationIndex); 
+
+		// Expressions only specialize for operations the operand types support, as anything 
+		// else results in null
+		binaryExpr->specialization = BinaryExpr::Specialization::Generic; 
+		binaryExpr->binaryOperation = operation; 
+
+		if (operationIndex == 14 || valueType != rightNodeEvaluated->valueType)
+			return; 
+		else if (valueType == ValueType::Number 
+			&& operation != BinaryOperation::And && operation != BinaryOperation::Or)
+		{
+			binaryExpr->specialization = BinaryExpr::Specialization::Number; 
+		}
+		else if (valueType == ValueType::Bool 
+			&& (operation == BinaryOperation::And || operation == BinaryOperation::Or))
+		{
+			binaryExpr->specialization = BinaryExpr::Specialization::Bool; 
+		}
+		else if (valueType == ValueType::String && (operation == BinaryOperation::Add 
+			|| operation == BinaryOperation::Equal || operation == BinaryOperation::NotEqual))
+		{
+			binaryExpr->specialization = BinaryExpr::Specialization::String; 
+		}
+	}
+	RuntimeValue* evaluateIdentifier(Identifier* identifier, Scope* scope) {
+		RuntimeValue* value = scope->getVariableValue(identifier->name); 
+		return value; 
+	}
+	RuntimeValue* evaluateFieldAccesser(FieldAccesser* fieldAccesser, Scope* scope) {
+		int slot; 
+		const DishValue* dishValue = evaluateFieldObject(fieldAccesser, scope, slot); 
+		return dishValue->slots[slot]; 
+	}
+	DishValue* evaluateFieldObject(FieldAccesser* fieldAccesser, Scope* scope, int& slot) {
+		return resolveFieldSlot(fieldAccesser, evaluateASTNode(fieldAccesser->object, scope), slot); 
+	}
+	DishValue* resolveFieldSlot(FieldAccesser* fieldAccesser, RuntimeValue* object, int& slot) {
+		DishValue* dishValue = resolveDishField(
+			object, fieldAccesser->field, fieldAccesser->cachedShape, fieldAccesser->cachedSlot
+		); 
+
+		slot = fieldAccesser->cachedSlot; 
+		return dishValue; 
+	}
 }
\ No newline at end of file
@@ -1,168 +1,363 @@
-#include "../../../hdr/runtime/eval/Statements.hpp"
-#include "../../../hdr/runtime/eval/Expressions.hpp"
-#include "../../../hdr/util/Error.hpp"
-
-namespace ns {
-	RuntimeValue* evaluateProgramNode(Program* program, Scope* scope) {
-		RuntimeValue* lastNodeEvaluated = globalMemory->create<NullValue>(); 
-
-		// Evaluate each statement and keep track of the previous runtime value
-		for (auto& statement : program->statements) 
-			lastNodeEvaluated = evaluateASTNode(statement, scope);
-
-		return lastNodeEvaluated;
-	}
-	RuntimeValue* evaluateVarDeclarationNode(VarDeclaration* varDeclaration, Scope* scope) {
-		RuntimeValue* value = varDeclaration->expr->nodeType != NodeType::NullLiteral
-			? evaluateASTNode(varDeclaration->expr, scope) : globalMemory->create<NullValue>(); 
-		return scope->declareVariable(varDeclaration->identifier, value, varDeclaration->constant);
-	}
-	RuntimeValue* evaluateFuncDeclaration(FuncDeclaration* funcDeclaration, Scope* scope) {
-		FuncValue* funcValue = globalMemory->create<FuncValue>(); 
-
-		funcValue->name = funcDeclaration->name; 
-		funcValue->nativeFunc = funcDeclaration->nativeFunc; 
-		funcValue->parameters = funcDeclaration->parameters; 
-		funcValue->statements = funcDeclaration->statements;
-		funcValue->scope = scope; 
-
-		scope->declareVariable(funcValue->name, funcValue, true); 
-
-		return funcValue; 
-	}
-	RuntimeValue* evaluateIfStatementNode(IfStatement* ifStatement, Scope* scope) {
-		const RuntimeValue* evaluatedCondition = evaluateASTNode(ifStatement->condition, scope);
-
-		RuntimeValue* result = globalMemory->create<NullValue>();
-
-		// Make sure the evaluated condition is a bool
-		if (evaluatedCondition->valueType == ValueType::Bool) {
-			const BoolValue* condition = dynamic_cast<const BoolValue*>(evaluatedCondition);
-
-			// If condition is true, evaluate its if statements
-			if (condition->state) {
-				for (auto& statement : ifStatement->ifStatements)
-					result = evaluateASTNode(statement, scope);
-			}
-			// Otherwise, evaluate its else statements
-			else {
-				for (auto& statement : ifStatement->elseStatements)
-					result = evaluateASTNode(statement, scope);
-			}
-		}
-
-		return result; 
-	}
-	RuntimeValue* evaluateWhileStatementNode(WhileStatement* whileStatement, Scope* scope) {
-		RuntimeValue* result = globalMemory->create<NullValue>(); 
-
-		while (true) { 
-			const RuntimeValue* evaluatedCondition = evaluateASTNode(whileStatement->condition, scope); 
-			
-			// Make sure the evaluated condition is a bool
-			if (evaluatedCondition->valueType == ValueType::Bool) {
-				const BoolValue* condition = dynamic_cast<const BoolValue*>(evaluatedCondition); 
-
-				// If condition is true, evaluate its statements
-				if (condition->state) {
-					for (auto& statement : whileStatement->statements) 
-						result = evaluateASTNode(statement, scope); 
-				}
-				else break; 
-			}
-		}
-
-		return result;
-	}
-	RuntimeValue* evaluateASTNode(Statement* astNode, Scope* scope) {
-		switch (astNode->nodeType) {
-		case NodeType::Program:
-		{
-			Program* program = dynamic_cast<Program*>(astNode);
-			return evaluateProgramNode(program, scope);
-		}
-		case NodeType::VarDeclaration:
-		{
-			VarDeclaration* varDeclaration = dynamic_cast<VarDeclaration*>(astNode);
-			return evaluateVarDeclarationNode(varDeclaration, scope);
-		}
-		case NodeType::FuncDeclaration:
-		{
-			FuncDeclaration* funcDeclaration = dynamic_cast<FuncDeclaration*>(astNode); 
-			return evaluateFuncDeclaration(funcDeclaration, scope); 
-		}
-		case NodeType::IfStatement:
-		{
-			IfStatement* ifStatement = dynamic_cast<IfStatement*>(astNode); 
-			return evaluateIfStatementNode(ifStatement, scope); 
-		}
-		case NodeType::WhileStatement:
-		{
-			WhileStatement* whileStatement = dynamic_cast<WhileStatement*>(astNode); 
-			return evaluateWhileStatementNode(whileStatement, scope); 
-		}
-		case NodeType::NullLiteral:
-		{
-			const NullLiteral* nullLiteral = dynamic_cast<const NullLiteral*>(astNode); 
-			return globalMemory->create<NullValue>();
-		}
-		case NodeType::NumLiteral:
-		{
-			const NumLiteral* numLiteral = dynamic_cast<const NumLiteral*>(astNode);
-			NumValue* numberValue = globalMemory->create<NumValue>();
-			numberValue->value = numLiteral->value;
-			return numberValue;
-		}
-		case NodeType::StringLiteral:
-		{
-			const StringLiteral* stringLiteral = dynamic_cast<const StringLiteral*>(astNode); 
-			StringValue* stringValue = globalMemory->create<StringValue>(); 
-			stringValue->value = stringLiteral->value.substr(1); 
-			return stringValue; 
-		}
-		case NodeType::ListLiteral:
-		{
-			const ListLiteral* listLiteral = dynamic_cast<const ListLiteral*>(astNode); 
-			ListValue* listValue = globalMemory->create<ListValue>(); 
-
-			// Add each expression to the list once evaluated
-			for (auto runtimeValue : listLiteral->elements)
-				listValue->elements.push_back(evaluateASTNode(runtimeValue, scope)); 
-
-			return listValue; 
-		}
-		case NodeType::FuncCall: 
-		{
-			FuncCall* funcCall = dynamic_cast<FuncCall*>(astNode); 
-			return evaluateFuncCallExpr(funcCall, scope); 
-		}
-		case NodeType::Identifier:
-		{
-			Identifier* identifier = dynamic_cast<Identifier*>(astNode);
-			return evaluateIdentifier(identifier, scope);
-		}
-		case NodeType::UnaryExpr:
-		{
-			UnaryExpr* unaryExpr = dynamic_cast<UnaryExpr*>(astNode); 
-			return evaluateUnaryExprNode(unaryExpr, scope); 
-		}
-		case NodeType::BinaryExpr:
-		{
-			BinaryExpr* binaryExpr = dynamic_cast<BinaryExpr*>(astNode);
-			return evaluateBinaryExprNode(binaryExpr, scope);
-		}
-		case NodeType::AssignmentExpr:
-		{
-			AssignmentExpr* assignmentExpr = dynamic_cast<AssignmentExpr*>(astNode);
-			return evaluateAssignmentExpr(assignmentExpr, scope);
-		}
-		default:
-			throw Error(
-				Error::Location::Interpreter,
-				5,
-				"Unimplemented AST node " + std::to_string(static_cast<int>(astNode->nodeType)) 
-					+ " found."
-			);
-		}
-	}
+#include "../../../hdr/runtime/eval/Statements.hpp"
+#include "../../../hdr/runtime/eval/Expressions.hpp"
+#include "../../../hdr/util/Error.hpp"
+
+namespace ns {
+	ControlTransfer pendingTransfer = ControlTransfer::None; 
+
+	RuntimeValue* evaluateProgramNode(Program* program, Scope* scope) {
+		return evaluateStatements(program->statements, scope); 
+	}
+	RuntimeValue* evaluateVarDeclarationNode(VarDeclaration* varDeclaration, Scope* scope) {
+		RuntimeValue* value = varDeclaration->expr->nodeType != NodeType::NullLiteral
+			? evaluateASTNode(varDeclaration->expr, scope) : globalMemory->create<NullValue>(); 
+		return scope->declareVariable(varDeclaration->identifier, value, varDeclaration->constant);
+	}
+	RuntimeValue* evaluateFuncDeclaration(FuncDeclaration* funcDeclaration, Scope* scope) {
+		FuncValue* funcValue = globalMemory->create<FuncValue>(); 
+
+		funcValue->name = funcDeclaration->name; 
+		funcValue->nativeFunc = funcDeclaration->nativeFunc; 
+		funcValue->parameters = funcDeclaration->parameters; 
+		funcValue->statements = funcDeclaration->statements;
+		funcValue->scope = scope; 
+		funcValue->reusesScope = !declaresNoodles(funcValue->statements); 
+
+		if (funcDeclaration->pure)
+			funcValue->cache = globalMemory->create<RecipeCache>(); 
+
+		scope->declareVariable(funcValue->name, funcValue, true); 
+
+		return funcValue; 
+	}
+	RuntimeValue* evaluateDishDeclaration(DishDeclaration* dishDeclaration, Scope* scope) {
+		DishShape* dishShape = globalMemory->create<DishShape>(); 
+
+		dishShape->name = dishDeclaration->name; 
+		dishShape->scope = scope; 
+		dishShape->evaluateDefault = [](const DishShape* dishShape, size_t slot) -> RuntimeValue* {
+			Expr* defaultExpr = dishShape->defaultExprs[slot]; 
+
+			return defaultExpr->nodeType != NodeType::NullLiteral 
+				? evaluateASTNode(defaultExpr, dishShape->scope) : nullptr; 
+		}; 
+
+		for (auto* field : dishDeclaration->fields) {
+			if (dishShape->findSlot(field->identifier) != -1) {
+				throw Error(
+					Error::Location::Interpreter,
+					2,
+					"Cannot create noodle " + field->identifier + " as it is already defined in dish "
+						+ dishShape->name
+				);
+			}
+
+			dishShape->fields.push_back(field->identifier); 
+			dishShape->constantFields.push_back(field->constant); 
+			dishShape->defaultExprs.push_back(field->expr); 
+		}
+
+		// Dishes are created by calling their name like a recipe
+		FuncValue* funcValue = globalMemory->create<FuncValue>(); 
+
+		funcValue->name = dishShape->name; 
+		funcValue->scope = scope; 
+		funcValue->dishShape = dishShape; 
+
+		scope->declareVariable(funcValue->name, funcValue, true); 
+
+		return funcValue; 
+	}
+	RuntimeValue* evaluateIfStatementNode(IfStatement* ifStatement, Scope* scope) {
+		const RuntimeValue* evaluatedCondition = evaluateASTNode(ifStatement->condition, scope);
+
+		// Make sure the evaluated condition is a bool
+		if (evaluatedCondition->valueType == ValueType::Bool) {
+			const BoolValue* condition = dynamic_cast<const BoolValue*>(evaluatedCondition);
+
+			// If condition is true, evaluate its if statements, and its else statements otherwise
+			return evaluateStatements(
+				condition->state ? ifStatement->ifStatements : ifStatement->elseStatements, scope
+			); 
+		}
+
+		return globalMemory->create<NullValue>(); 
+	}
+	RuntimeValue* evaluateWhileStatementNode(WhileStatement* whileStatement, Scope* scope) {
+		RuntimeValue* result = globalMemory->create<NullValue>(); 
+
+		while (true) { 
+			const RuntimeValue* evaluatedCondition = evaluateASTNode(whileStatement->condition, scope); 
+			
+			// Make sure the evaluated condition is a bool
+			if (evaluatedCondition->valueType == ValueType::Bool) {
+				const BoolValue* condition = dynamic_cast<const BoolValue*>(evaluatedCondition); 
+
+				// If condition is true, evaluate its statements
+				if (condition->state) {
+					result = evaluateStatements(whileStatement->statements, scope); 
+
+					// Returns leave the loop with the transfer still pending, until the recipe 
+					// is reached
+					if (pendingTransfer == ControlTransfer::Return)
+						break; 
+					else if (pendingTransfer == ControlTransfer::Break) {
+						pendingTransfer = ControlTransfer::None; 
+						break; 
+					}
+
+					pendingTransfer = ControlTransfer::None; 
+				}
+				else break; 
+			}
+			else
+				throwLoopConditionError(); 
+		}
+
+		return result;
+	}
+	RuntimeValue* evaluateForStatementNode(ForStatement* forStatement, Scope* scope) {
+		RuntimeValue* result = globalMemory->create<NullValue>(); 
+		// Evaluates the body, returning whether the loop goes on to its next iteration
+		auto evaluateBody = [&]() -> bool {
+			result = evaluateStatements(forStatement->statements, scope); 
+
+			// Returns leave the loop with the transfer still pending, until the recipe is reached
+			if (pendingTransfer == ControlTransfer::Return)
+				return false; 
+			else if (pendingTransfer == ControlTransfer::Break) {
+				pendingTransfer = ControlTransfer::None; 
+				return false; 
+			}
+
+			pendingTransfer = ControlTransfer::None; 
+			return true; 
+		}; 
+
+		// Each iteration first moves the loop on to its next number or element, and assigns it
+		// to the noodle
+		if (forStatement->iterable != nullptr) {
+			const ListValue* list = expectIterable(evaluateASTNode(forStatement->iterable, scope)); 
+			Scope::Variable* variable = scope->declareLoopVariable(
+				forStatement->identifier, globalMemory->create<NullValue>()
+			); 
+			RuntimeValue* ownedValue = nullptr; 
+			int64_t index = 0; 
+
+			while (advanceElement(variable->runtimeValue, ownedValue, list, index)) {
+				if (!evaluateBody())
+					break; 
+			}
+
+			return result; 
+		}
+
+		RuntimeValue* start = evaluateASTNode(forStatement->start, scope); 
+		RuntimeValue* end = evaluateASTNode(forStatement->end, scope); 
+		RuntimeValue* step = evaluateASTNode(forStatement->step, scope); 
+
+		prepareRange(start, end, step); 
+
+		// The count is kept apart from the noodle, so assigning the noodle doesn't change it
+		NumValue* count = static_cast<NumValue*>(start); 
+		Scope::Variable* variable = scope->declareLoopVariable(
+			forStatement->identifier, cloneRuntimeValue(count)
+		); 
+		RuntimeValue* ownedValue = variable->runtimeValue; 
+
+		while (advanceRange(variable->runtimeValue, ownedValue, count, 
+			static_cast<const NumValue*>(end), static_cast<const NumValue*>(step)))
+		{
+			if (!evaluateBody())
+				break; 
+		}
+
+		return result; 
+	}
+	RuntimeValue* evaluateReturnStatement(ReturnStatement* returnStatement, Scope* scope) {
+		RuntimeValue* value = evaluateASTNode(returnStatement->expr, scope); 
+
+		pendingTransfer = ControlTransfer::Return; 
+		return value; 
+	}
+	RuntimeValue* evaluateStatements(const std::vector<Statement*>& statements, Scope* scope) {
+		if (statements.empty())
+			return globalMemory->create<NullValue>(); 
+
+		RuntimeValue* result = nullptr; 
+
+		for (auto* statement : statements) {
+			result = evaluateASTNode(statement, scope); 
+
+			if (pendingTransfer != ControlTransfer::None)
+				break; 
+		}
+
+		return result; 
+	}
+	RuntimeValue* evaluateASTNode(Statement* astNode, Scope* scope) {
+		switch (astNode->nodeType) {
+		case NodeType::Program:
+		{
+			Program* program = dynamic_cast<Program*>(astNode);
+			return evaluateProgramNode(program, scope);
+		}
+		case NodeType::VarDeclaration:
+		{
+			VarDeclaration* varDeclaration = dynamic_cast<VarDeclaration*>(astNode);
+			return evaluateVarDeclarationNode(varDeclaration, scope);
+		}
+		case NodeType::FuncDeclaration:
+		{
+			FuncDeclaration* funcDeclaration = dynamic_cast<FuncDeclaration*>(astNode); 
+			return evaluateFuncDeclaration(funcDeclaration, scope); 
+		}
+		case NodeType::DishDeclaration:
+		{
+			DishDeclaration* dishDeclaration = dynamic_cast<DishDeclaration*>(astNode); 
+			return evaluateDishDeclaration(dishDeclaration, scope); 
+		}
+		case NodeType::IfStatement:
+		{
+			IfStatement* ifStatement = dynamic_cast<IfStatement*>(astNode); 
+			return evaluateIfStatementNode(ifStatement, scope); 
+		}
+		case NodeType::WhileStatement:
+		{
+			WhileStatement* whileStatement = dynamic_cast<WhileStatement*>(astNode); 
+			return evaluateWhileStatementNode(whileStatement, scope); 
+		}
+		case NodeType::ForStatement:
+		{
+			ForStatement* forStatement = dynamic_cast<ForStatement*>(astNode); 
+			return evaluateForStatementNode(forStatement, scope); 
+		}
+		case NodeType::BreakStatement:
+			pendingTransfer = ControlTransfer::Break; 
+			return globalMemory->create<NullValue>(); 
+		case NodeType::ContinueStatement:
+			pendingTransfer = ControlTransfer::Continue; 
+			return globalMemory->create<NullValue>(); 
+		case NodeType::ReturnStatement:
+		{
+			ReturnStatement* returnStatement = dynamic_cast<ReturnStatement*>(astNode); 
+			return evaluateReturnStatement(returnStatement, scope); 
+		}
+		case NodeType::NullLiteral:
+		{
+			const NullLiteral* nullLiteral = dynamic_cast<const NullLiteral*>(astNode); 
+			return globalMemory->create<NullValue>();
+		}
+		case NodeType::NumLiteral:
+		{
+			const NumLiteral* numLiteral = dynamic_cast<const NumLiteral*>(astNode);
+			NumValue* numberValue = globalMemory->create<NumValue>();
+
+			if (numLiteral->integral)
+				numberValue->setInteger(numLiteral->integer); 
+			else
+				numberValue->value = numLiteral->value;
+
+			return numberValue;
+		}
+		case NodeType::StringLiteral:
+		{
+			const StringLiteral* stringLiteral = dynamic_cast<const StringLiteral*>(astNode); 
+
+			// The literal's value starts with its opening quote
+			if (stringLiteral->value.size() == 2)
+				return internChrValue(stringLiteral->value[1]); 
+
+			StringValue* stringValue = globalMemory->create<StringValue>(); 
+			stringValue->value = stringLiteral->value.substr(1); 
+			return stringValue; 
+		}
+		case NodeType::ListLiteral:
+		{
+			const ListLiteral* listLiteral = dynamic_cast<const ListLiteral*>(astNode); 
+			ListValue* listValue = globalMemory->create<ListValue>(); 
+
+			// Add each expression to the list once evaluated
+			for (auto runtimeValue : listLiteral->elements)
+				listValue->append(evaluateASTNode(runtimeValue, scope)); 
+
+			return listValue; 
+		}
+		case NodeType::FuncCall: 
+		{
+			FuncCall* funcCall = dynamic_cast<FuncCall*>(astNode); 
+			return evaluateFuncCallExpr(funcCall, scope); 
+		}
+		case NodeType::InlinedCall:
+		{
+			InlinedCall* inlinedCall = dynamic_cast<InlinedCall*>(astNode); 
+			return evaluateInlinedCall(inlinedCall, scope); 
+		}
+		case NodeType::Identifier:
+		{
+			Identifier* identifier = dynamic_cast<Identifier*>(astNode);
+			return evaluateIdentifier(identifier, scope);
+		}
+		case NodeType::FieldAccesser:
+		{
+			FieldAccesser* fieldAccesser = dynamic_cast<FieldAccesser*>(astNode); 
+			return evaluateFieldAccesser(fieldAccesser, scope); 
+		}
+		case NodeType::UnaryExpr:
+		{
+			UnaryExpr* unaryExpr = dynamic_cast<UnaryExpr*>(astNode); 
+			return evaluateUnaryExprNode(unaryExpr, scope); 
+		}
+		case NodeType::BinaryExpr:
+		{
+			BinaryExpr* binaryExpr = dynamic_cast<BinaryExpr*>(astNode);
+			return evaluateBinaryExprNode(binaryExpr, scope);
+		}
+		case NodeType::AssignmentExpr:
+		{
+			AssignmentExpr* assignmentExpr = dynamic_cast<AssignmentExpr*>(astNode);
+			return evaluateAssignmentExpr(assignmentExpr, scope);
+		}
+		default:
+			throw Error(
+				Error::Location::Interpreter,
+				5,
+				"Unimplemented AST node " + std::to_string(static_cast<int>(astNode->nodeType)) 
+					+ " found."
+			);
+		}
+	}
+	bool declaresNoodles(const std::vector<Statement*>& statements) {
+		for (auto* statement : statements) {
+			switch (statement->nodeType) {
+			case NodeType::VarDeclaration:
+			case NodeType::FuncDeclaration:
+			case NodeType::DishDeclaration:
+				return true; 
+			case NodeType::IfStatement:
+			{
+				const IfStatement* ifStatement = dynamic_cast<const IfStatement*>(statement); 
+
+				if (declaresNoodles(ifStatement->ifStatements) 
+					|| declaresNoodles(ifStatement->elseStatements))
+				{
+					return true; 
+				}
+
+				break; 
+			}
+			case NodeType::WhileStatement:
+				if (declaresNoodles(dynamic_cast<const WhileStatement*>(statement)->statements))
+					return true; 
+
+				break; 
+			case NodeType::ForStatement:
+				return true; 
+			default:
+				break; 
+			}
+		}
+
+		return false; 
+	}
 }
\ No newline at end of file
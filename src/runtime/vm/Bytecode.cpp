@@ -0,0 +1,233 @@
+#include "../../../hdr/runtime/vm/Bytecode.hpp"
+
+namespace ns {
+	const char* opCodeNames[] = {
+		"Move",
+		"Clone",
+		"LoadNull",
+		"DeclareVariable",
+		"AssignVariable",
+		"BindVariable",
+		"DeclareRecipe",
+		"Evaluate",
+		"Negate",
+		"Increment",
+		"Decrement",
+		"Not",
+		"Add",
+		"Subtract",
+		"Multiply",
+		"Divide",
+		"Modulo",
+		"Power",
+		"Equal",
+		"NotEqual",
+		"Greater",
+		"Less",
+		"GreaterEqual",
+		"LessEqual",
+		"And",
+		"Or",
+		"MakeList",
+		"GetField",
+		"LoadCallee",
+		"Call",
+		"TailCall",
+		"CallNative",
+		"Jump",
+		"JumpIfFalse",
+		"JumpUnlessEqual",
+		"JumpUnlessNotEqual",
+		"JumpUnlessGreater",
+		"JumpUnlessLess",
+		"JumpUnlessGreaterEqual",
+		"JumpUnlessLessEqual",
+		"IncrementVariable",
+		"DecrementVariable",
+		"LoadElement",
+		"StoreElement",
+		"PrepareRange",
+		"NextInRange",
+		"PrepareElements",
+		"NextElement",
+		"FailLoopCondition",
+		"Return"
+	};
+	const char* operationNames[] = {
+		"-", "++", "--", "!",
+		"+", "-", "*", "/", "%", "**", "==", "!=", ">", "<", ">=", "<=", "&&", "||"
+	};
+
+	namespace {
+		const int A = 1, B = 2, C = 4;
+	}
+
+	const int registerOperands[] = {
+		A | B,		// Move
+		A | B,		// Clone
+		A,			// LoadNull
+		B,			// DeclareVariable
+		A | C,		// AssignVariable
+		B,			// BindVariable
+		A,			// DeclareRecipe
+		A,			// Evaluate
+		A | B,		// Negate
+		A | B,		// Increment
+		A | B,		// Decrement
+		A | B,		// Not
+		A | B | C,	// Add
+		A | B | C,	// Subtract
+		A | B | C,	// Multiply
+		A | B | C,	// Divide
+		A | B | C,	// Modulo
+		A | B | C,	// Power
+		A | B | C,	// Equal
+		A | B | C,	// NotEqual
+		A | B | C,	// Greater
+		A | B | C,	// Less
+		A | B | C,	// GreaterEqual
+		A | B | C,	// LessEqual
+		A | B | C,	// And
+		A | B | C,	// Or
+		A | B,		// MakeList
+		A | B,		// GetField
+		A | B | C,	// LoadCallee
+		A | C,		// Call
+		A | C,		// TailCall
+		A,			// CallNative
+		0,			// Jump
+		A,			// JumpIfFalse
+		A | B,		// JumpUnlessEqual
+		A | B,		// JumpUnlessNotEqual
+		A | B,		// JumpUnlessGreater
+		A | B,		// JumpUnlessLess
+		A | B,		// JumpUnlessGreaterEqual
+		A | B,		// JumpUnlessLessEqual
+		A | B,		// IncrementVariable
+		A | B,		// DecrementVariable
+		A | B | C,	// LoadElement
+		A | B | C,	// StoreElement
+		A,			// PrepareRange
+		A,			// NextInRange
+		A,			// PrepareElements
+		A,			// NextElement
+		0,			// FailLoopCondition
+		A			// Return
+	};
+
+	Chunk::Chunk() :
+		temporaryCount(0),
+		threaded(false),
+		tier(Tier::Counting),
+		hotness(0),
+		nativeCode(nullptr)
+	{
+	}
+
+	int Chunk::firstConstant() const {
+		return names.size();
+	}
+	int Chunk::firstTemporary() const {
+		return names.size() + constants.size();
+	}
+	int Chunk::registerCount() const {
+		return firstTemporary() + temporaryCount;
+	}
+
+	std::ostream& operator<<(std::ostream& ostream, const Chunk* chunk) {
+		// Shows noodles by name, constants by their value and temporaries by their index
+		auto showRegister = [&](int index) {
+			if (index < chunk->firstConstant())
+				ostream << " " << chunk->names[index];
+			else if (index < chunk->firstTemporary()) {
+				const RuntimeValue* constant = chunk->constants[index - chunk->firstConstant()];
+
+				if (constant->valueType == ValueType::String)
+					ostream << " \"" << static_cast<const StringValue*>(constant)->value << "\"";
+				else if (constant->valueType == ValueType::Number)
+					ostream << " " << static_cast<const NumValue*>(constant)->value;
+				else
+					ostream << " k" << index - chunk->firstConstant();
+			}
+			else
+				ostream << " r" << index - chunk->firstTemporary();
+		};
+
+		for (size_t instructionIndex = 0; instructionIndex < chunk->instructions.size();
+			instructionIndex++)
+		{
+			const Instruction& instruction = chunk->instructions[instructionIndex];
+			const int opCode = static_cast<int>(instruction.opCode);
+			const int operands[] = { instruction.a, instruction.b, instruction.c };
+
+			ostream << " " << instructionIndex << ": " << opCodeNames[opCode];
+
+			for (int operandIndex = 0; operandIndex < 3; operandIndex++) {
+				if (registerOperands[opCode] & (1 << operandIndex))
+					showRegister(operands[operandIndex]);
+			}
+
+			// Shows what the remaining operands refer to
+			switch (instruction.opCode) {
+			case OpCode::DeclareVariable:
+			case OpCode::BindVariable:
+			case OpCode::AssignVariable:
+				ostream << " -> " << chunk->names[instruction.opCode != OpCode::AssignVariable
+					? instruction.a : instruction.b];
+				break;
+			case OpCode::DeclareRecipe:
+				ostream << " " << chunk->recipes[instruction.b].funcDeclaration->name;
+				break;
+			case OpCode::LoadCallee:
+				ostream << " " << instruction.d;
+				break;
+			case OpCode::Call:
+			case OpCode::TailCall:
+				ostream << " (" << dynamic_cast<const FuncCall*>(
+					chunk->nodes[instruction.b])->arguments.size() << " arguments)";
+				break;
+			case OpCode::CallNative:
+				ostream << " " << chunk->names[instruction.c];
+				break;
+			case OpCode::MakeList:
+				ostream << " (" << instruction.c << " elements)";
+				break;
+			case OpCode::Jump:
+				ostream << " " << instruction.a;
+				break;
+			case OpCode::JumpIfFalse:
+			case OpCode::JumpUnlessEqual:
+			case OpCode::JumpUnlessNotEqual:
+			case OpCode::JumpUnlessGreater:
+			case OpCode::JumpUnlessLess:
+			case OpCode::JumpUnlessGreaterEqual:
+			case OpCode::JumpUnlessLessEqual:
+				ostream << " " << instruction.c << " " << instruction.d;
+				break;
+			case OpCode::LoadElement:
+			case OpCode::StoreElement:
+				ostream << " " << chunk->names[instruction.e];
+				break;
+			case OpCode::PrepareRange:
+			case OpCode::PrepareElements:
+				ostream << " -> " << chunk->names[instruction.b];
+				break;
+			case OpCode::NextInRange:
+			case OpCode::NextElement:
+				ostream << " -> " << chunk->names[instruction.b] << " " << instruction.c;
+				break;
+			default:
+				break;
+			}
+
+			ostream << "\n";
+		}
+
+		for (auto& recipe : chunk->recipes) {
+			ostream << "\n Recipe " << recipe.funcDeclaration->name << ":\n";
+			ostream << recipe.chunk;
+		}
+
+		return ostream;
+	}
+}
\ No newline at end of file
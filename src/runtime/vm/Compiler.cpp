@@ -0,0 +1,776 @@
+#include "../../../hdr/runtime/vm/Compiler.hpp"
+#include "../../../hdr/runtime/Optimizer.hpp"
+
+#include <algorithm>
+
+namespace ns {
+	Compiler::Compiler(bool shouldUseSuperinstructions, bool shouldUseJit) :
+		chunk(nullptr),
+		nextTemporary(0),
+		shouldUseSuperinstructions(shouldUseSuperinstructions),
+		shouldUseJit(shouldUseJit)
+	{
+	}
+
+	Chunk* Compiler::compileProgram(Program* program) {
+		return compileChunk(program->statements);
+	}
+	Chunk* Compiler::compileRecipe(FuncDeclaration* funcDeclaration) {
+		return compileChunk(funcDeclaration->statements);
+	}
+
+	Chunk* Compiler::compileChunk(const std::vector<Statement*>& statements) {
+		chunk = globalMemory->create<Chunk>();
+		nameSlots.clear();
+
+		if (!shouldUseJit)
+			chunk->tier = Chunk::Tier::Interpreted;
+		nextTemporary = 0;
+
+		const int result = allocateTemporary();
+
+		compileStatements(statements, result);
+		emit(OpCode::Return, result);
+		relocateRegisters();
+		markTailCalls();
+		return chunk;
+	}
+	void Compiler::compileStatements(const std::vector<Statement*>& statements, int target) {
+		if (statements.empty()) {
+			if (target != discarded)
+				emit(OpCode::LoadNull, target);
+
+			return;
+		}
+
+		const int firstCommonTemporary = nextTemporary;
+		const std::vector<const Expr*> commonExprs = Optimizer::findCommonExprs(statements);
+
+		for (auto* commonExpr : commonExprs)
+			commonRegisters[commonExpr] = allocateTemporary();
+
+		// Only the value of the last statement is kept
+		for (size_t statementIndex = 0; statementIndex < statements.size(); statementIndex++) {
+			const int firstTemporary = nextTemporary;
+
+			compileStatement(
+				statements[statementIndex],
+				statementIndex == statements.size() - 1 ? target : discarded
+			);
+
+			nextTemporary = firstTemporary;
+		}
+
+		// Expressions that were evaluated are no longer reserved, and are only read in the list
+		for (auto* commonExpr : commonExprs) {
+			if (commonRegisters.erase(commonExpr) == 0)
+				reusedRegisters.erase(commonExpr);
+		}
+
+		nextTemporary = firstCommonTemporary;
+	}
+	int Compiler::compileStatement(Statement* statement, int target) {
+		auto reusedRegister = reusedRegisters.find(statement);
+		auto commonRegister = commonRegisters.find(statement);
+
+		// Common expressions are evaluated the first time they're reached, and read afterwards
+		if (reusedRegister == reusedRegisters.end() && commonRegister != commonRegisters.end()) {
+			const int common = commonRegister->second;
+
+			commonRegisters.erase(commonRegister);
+			compileStatement(statement, common);
+			reusedRegister = reusedRegisters.emplace(statement, common).first;
+		}
+
+		if (reusedRegister != reusedRegisters.end()) {
+			if (target < 0)
+				return reusedRegister->second;
+
+			emit(OpCode::Move, target, reusedRegister->second);
+			return target;
+		}
+
+		switch (statement->nodeType) {
+		case NodeType::Program:
+		{
+			Program* program = dynamic_cast<Program*>(statement);
+			target = resolveTarget(target);
+			compileStatements(program->statements, target);
+			return target;
+		}
+		case NodeType::VarDeclaration:
+		{
+			VarDeclaration* varDeclaration = dynamic_cast<VarDeclaration*>(statement);
+			int value = compileStatement(
+				varDeclaration->expr, target == discarded ? -1 : target
+			);
+
+			// The noodle gets its own value, unless it's declared with another noodle's
+			if (isConstantRegister(value)) {
+				const int copy = resolveTarget(target);
+				emitCopy(copy, value);
+				value = copy;
+			}
+
+			emit(
+				OpCode::DeclareVariable,
+				findNameSlot(varDeclaration->identifier),
+				value,
+				varDeclaration->constant
+			);
+			return value;
+		}
+		case NodeType::FuncDeclaration:
+		{
+			FuncDeclaration* funcDeclaration = dynamic_cast<FuncDeclaration*>(statement);
+			Compiler recipeCompiler(shouldUseSuperinstructions, shouldUseJit);
+
+			chunk->recipes.push_back({
+				funcDeclaration, recipeCompiler.compileRecipe(funcDeclaration)
+			});
+			target = resolveTarget(target);
+			emit(
+				OpCode::DeclareRecipe,
+				target,
+				chunk->recipes.size() - 1,
+				findNameSlot(funcDeclaration->name)
+			);
+			return target;
+		}
+		case NodeType::IfStatement:
+			target = resolveTarget(target);
+			compileIfStatement(dynamic_cast<IfStatement*>(statement), target);
+			return target;
+		case NodeType::WhileStatement:
+			target = resolveTarget(target);
+			compileWhileStatement(dynamic_cast<WhileStatement*>(statement), target);
+			return target;
+		// Loops whose value is never used don't keep the value of their body either
+		case NodeType::ForStatement:
+			if (target != discarded)
+				target = resolveTarget(target);
+
+			compileForStatement(dynamic_cast<ForStatement*>(statement), target);
+			return target;
+		case NodeType::BreakStatement:
+		case NodeType::ContinueStatement:
+			return compileLoopControlStatement(statement);
+		case NodeType::ReturnStatement:
+		{
+			// Calls that are returned become tail calls, as they're followed by the return
+			const int firstTemporary = nextTemporary;
+			const int value = allocateTemporary();
+
+			compileStatement(dynamic_cast<ReturnStatement*>(statement)->expr, value);
+			emit(OpCode::Return, value);
+			nextTemporary = firstTemporary;
+			return value;
+		}
+		case NodeType::NullLiteral:
+			target = resolveTarget(target);
+			emit(OpCode::LoadNull, target);
+			return target;
+		case NodeType::NumLiteral:
+		case NodeType::StringLiteral:
+		{
+			RuntimeValue* constant;
+
+			if (statement->nodeType == NodeType::NumLiteral) {
+				const NumLiteral* numLiteral = dynamic_cast<const NumLiteral*>(statement);
+				NumValue* numberValue = globalMemory->create<NumValue>();
+
+				if (numLiteral->integral)
+					numberValue->setInteger(numLiteral->integer);
+				else
+					numberValue->value = numLiteral->value;
+
+				constant = numberValue;
+			}
+			else {
+				const StringLiteral* stringLiteral = dynamic_cast<const StringLiteral*>(statement);
+
+				// The literal's value starts with its opening quote
+				StringValue* stringValue = stringLiteral->value.size() == 2
+					? internChrValue(stringLiteral->value[1]) : globalMemory->create<StringValue>();
+
+				if (!stringValue->interned)
+					stringValue->value = stringLiteral->value.substr(1);
+
+				constant = stringValue;
+			}
+
+			const int constantRegister = constantOffset + addConstant(constant);
+
+			if (target < 0)
+				return constantRegister;
+
+			emitCopy(target, constantRegister);
+			return target;
+		}
+		case NodeType::ListLiteral:
+		{
+			ListLiteral* listLiteral = dynamic_cast<ListLiteral*>(statement);
+			target = resolveTarget(target);
+
+			const int firstTemporary = nextTemporary;
+			const int elementCount = listLiteral->elements.size();
+			const int firstElement = allocateTemporaries(elementCount);
+
+			for (int elementIndex = 0; elementIndex < elementCount; elementIndex++)
+				compileStatement(listLiteral->elements[elementIndex], firstElement + elementIndex);
+
+			emit(OpCode::MakeList, target, firstElement, elementCount);
+			nextTemporary = firstTemporary;
+			return target;
+		}
+		case NodeType::Identifier:
+		{
+			const Identifier* identifier = dynamic_cast<const Identifier*>(statement);
+			const int slot = findNameSlot(identifier->name);
+
+			if (target < 0)
+				return slot;
+
+			emit(OpCode::Move, target, slot);
+			return target;
+		}
+		case NodeType::FieldAccesser:
+		{
+			FieldAccesser* fieldAccesser = dynamic_cast<FieldAccesser*>(statement);
+			target = resolveTarget(target);
+
+			const int firstTemporary = nextTemporary;
+			const int object = compileStatement(fieldAccesser->object);
+
+			emit(OpCode::GetField, target, object, addNode(fieldAccesser));
+			nextTemporary = firstTemporary;
+			return target;
+		}
+		case NodeType::UnaryExpr:
+		{
+			UnaryExpr* unaryExpr = dynamic_cast<UnaryExpr*>(statement);
+			const int operation = std::find_if(
+				operationNames, operationNames + 4,
+				[&](const char* name) -> bool { return unaryExpr->operation == name; }
+			) - operationNames;
+			target = resolveTarget(target);
+
+			// Noodles are incremented and decremented without looking up the operation
+			if (shouldUseSuperinstructions && unaryExpr->expr->nodeType == NodeType::Identifier
+				&& (unaryExpr->operation == "++" || unaryExpr->operation == "--"))
+			{
+				emit(
+					unaryExpr->operation == "++"
+						? OpCode::IncrementVariable : OpCode::DecrementVariable,
+					target,
+					findNameSlot(dynamic_cast<const Identifier*>(unaryExpr->expr)->name)
+				);
+				return target;
+			}
+
+			const int firstTemporary = nextTemporary;
+			const int operand = compileStatement(unaryExpr->expr);
+
+			emit(
+				static_cast<OpCode>(static_cast<int>(OpCode::Negate) + operation),
+				target,
+				operand
+			);
+			nextTemporary = firstTemporary;
+			return target;
+		}
+		case NodeType::BinaryExpr:
+		{
+			BinaryExpr* binaryExpr = dynamic_cast<BinaryExpr*>(statement);
+			const int operation = std::find_if(
+				operationNames + 4, operationNames + 18,
+				[&](const char* name) -> bool { return binaryExpr->operation == name; }
+			) - operationNames - 4;
+			target = resolveTarget(target);
+
+			const int firstTemporary = nextTemporary;
+			int left = compileStatement(binaryExpr->leftExpr);
+
+			// Both sides are always evaluated, as the tree walker doesn't short-circuit. The
+			// left side is read before the right is evaluated, so a noodle assigned by the
+			// right side keeps its old value.
+			if (isNameRegister(left) && mayAssignVariables(binaryExpr->rightExpr)) {
+				const int temporary = allocateTemporary();
+				emit(OpCode::Move, temporary, left);
+				left = temporary;
+			}
+
+			const int right = compileStatement(binaryExpr->rightExpr);
+
+			emit(
+				static_cast<OpCode>(static_cast<int>(OpCode::Add) + operation),
+				target,
+				left,
+				right
+			);
+			nextTemporary = firstTemporary;
+			return target;
+		}
+		case NodeType::AssignmentExpr:
+		{
+			AssignmentExpr* assignmentExpr = dynamic_cast<AssignmentExpr*>(statement);
+
+			// Field assignments check whether the dish's noodle is frozen, which is left to
+			// the tree walker
+			if (assignmentExpr->assigne->nodeType != NodeType::Identifier)
+				return emitEvaluate(assignmentExpr, target);
+
+			const Identifier* identifier = dynamic_cast<const Identifier*>(
+				assignmentExpr->assigne
+			);
+			target = resolveTarget(target);
+
+			const int firstTemporary = nextTemporary;
+			const int value = compileStatement(assignmentExpr->value);
+
+			emit(OpCode::AssignVariable, target, findNameSlot(identifier->name), value);
+			nextTemporary = firstTemporary;
+			return target;
+		}
+		case NodeType::FuncCall:
+			return compileFuncCall(dynamic_cast<FuncCall*>(statement), target);
+		case NodeType::InlinedCall:
+			return compileInlinedCall(dynamic_cast<InlinedCall*>(statement), target);
+		case NodeType::DishDeclaration:
+			return emitEvaluate(statement, target, true);
+		default:
+			return emitEvaluate(statement, target);
+		}
+	}
+	void Compiler::compileIfStatement(IfStatement* ifStatement, int target) {
+		const int conditionJump = compileConditionJump(ifStatement->condition);
+
+		compileStatements(ifStatement->ifStatements, target);
+
+		const int ifEndJump = emit(OpCode::Jump);
+
+		// Conditions that aren't bools skip both branches
+		chunk->instructions[conditionJump].d = nextInstructionIndex();
+		emit(OpCode::LoadNull, target);
+
+		const int nullEndJump = emit(OpCode::Jump);
+
+		chunk->instructions[conditionJump].c = nextInstructionIndex();
+		compileStatements(ifStatement->elseStatements, target);
+		patchJump(ifEndJump);
+		patchJump(nullEndJump);
+	}
+	void Compiler::compileWhileStatement(WhileStatement* whileStatement, int target) {
+		// Holds the value of the last statement evaluated, which is null if the body never runs
+		emit(OpCode::LoadNull, target);
+
+		loops.push_back({ target, {}, {} });
+
+		if (!whileStatement->invariants.empty()) {
+			const int firstTemporary = nextTemporary;
+			const int entryJump = compileConditionJump(whileStatement->condition);
+
+			// Invariants are only evaluated once the loop is known to run, as the body would
+			for (auto* invariant : whileStatement->invariants) {
+				const int hoisted = allocateTemporary();
+
+				compileStatement(invariant, hoisted);
+				reusedRegisters[invariant] = hoisted;
+			}
+
+			const int bodyIndex = nextInstructionIndex();
+
+			compileStatements(whileStatement->statements, target);
+
+			const int conditionIndex = nextInstructionIndex();
+			const int conditionJump = compileConditionJump(whileStatement->condition);
+
+			emit(OpCode::Jump, bodyIndex);
+
+			for (auto* invariant : whileStatement->invariants)
+				reusedRegisters.erase(invariant);
+
+			nextTemporary = firstTemporary;
+
+			// Conditions that aren't bools throw, like they do in the tree walker
+			const int failIndex = emit(OpCode::FailLoopCondition);
+
+			for (int jumpIndex : { entryJump, conditionJump }) {
+				chunk->instructions[jumpIndex].c = nextInstructionIndex();
+				chunk->instructions[jumpIndex].d = failIndex;
+			}
+
+			finishLoop(conditionIndex);
+			return;
+		}
+
+		const int conditionIndex = nextInstructionIndex();
+		const int conditionJump = compileConditionJump(whileStatement->condition);
+
+		compileStatements(whileStatement->statements, target);
+		emit(OpCode::Jump, conditionIndex);
+
+		// Conditions that aren't bools throw, like they do in the tree walker
+		const int failIndex = emit(OpCode::FailLoopCondition);
+
+		chunk->instructions[conditionJump].c = nextInstructionIndex();
+		chunk->instructions[conditionJump].d = failIndex;
+		finishLoop(conditionIndex);
+	}
+	void Compiler::compileForStatement(ForStatement* forStatement, int target) {
+		const int firstTemporary = nextTemporary;
+		const int noodle = findNameSlot(forStatement->identifier);
+		const bool countsRange = forStatement->iterable == nullptr;
+		// The loop's count and bounds, or its list and index, which the body must not reuse
+		const int state = allocateTemporaries(countsRange ? 3 : 2);
+
+		if (countsRange) {
+			compileStatement(forStatement->start, state);
+			compileStatement(forStatement->end, state + 1);
+			compileStatement(forStatement->step, state + 2);
+			emit(OpCode::PrepareRange, state, noodle);
+		}
+		else {
+			compileStatement(forStatement->iterable, state);
+			emit(OpCode::PrepareElements, state, noodle);
+		}
+
+		// Holds the value of the last statement evaluated, which is null if the body never runs
+		if (target != discarded)
+			emit(OpCode::LoadNull, target);
+
+		loops.push_back({ target, {}, {} });
+
+		const int nextIndex = emit(
+			countsRange ? OpCode::NextInRange : OpCode::NextElement, state, noodle
+		);
+
+		compileStatements(forStatement->statements, target);
+		emit(OpCode::Jump, nextIndex);
+		chunk->instructions[nextIndex].c = nextInstructionIndex();
+		nextTemporary = firstTemporary;
+		finishLoop(nextIndex);
+	}
+	int Compiler::compileLoopControlStatement(Statement* statement) {
+		Loop& loop = loops.back();
+
+		// The loop results in null, like the statement does in the tree walker
+		if (loop.target != discarded)
+			emit(OpCode::LoadNull, loop.target);
+
+		const int jump = emit(OpCode::Jump);
+
+		if (statement->nodeType == NodeType::BreakStatement)
+			loop.breakJumps.push_back(jump);
+		else
+			loop.continueJumps.push_back(jump);
+
+		return loop.target;
+	}
+	void Compiler::finishLoop(int conditionIndex) {
+		for (int jumpIndex : loops.back().breakJumps)
+			patchJump(jumpIndex);
+		for (int jumpIndex : loops.back().continueJumps)
+			chunk->instructions[jumpIndex].a = conditionIndex;
+
+		loops.pop_back();
+	}
+	int Compiler::compileConditionJump(Expr* condition) {
+		const int firstTemporary = nextTemporary;
+		int conditionJump;
+
+		// Comparisons branch on their result directly, rather than storing it as a bool, unless
+		// it's evaluated once and read again
+		if (shouldUseSuperinstructions && condition->nodeType == NodeType::BinaryExpr
+			&& !reusedRegisters.count(condition) && !commonRegisters.count(condition))
+		{
+			BinaryExpr* binaryExpr = dynamic_cast<BinaryExpr*>(condition);
+			const int operation = std::find_if(
+				operationNames + 10, operationNames + 16,
+				[&](const char* name) -> bool { return binaryExpr->operation == name; }
+			) - operationNames - 10;
+
+			if (operation < 6) {
+				int left = compileStatement(binaryExpr->leftExpr);
+
+				if (isNameRegister(left) && mayAssignVariables(binaryExpr->rightExpr)) {
+					const int temporary = allocateTemporary();
+					emit(OpCode::Move, temporary, left);
+					left = temporary;
+				}
+
+				const int right = compileStatement(binaryExpr->rightExpr);
+
+				nextTemporary = firstTemporary;
+				return emit(
+					static_cast<OpCode>(static_cast<int>(OpCode::JumpUnlessEqual) + operation),
+					left,
+					right
+				);
+			}
+		}
+
+		conditionJump = emit(OpCode::JumpIfFalse, compileStatement(condition));
+		nextTemporary = firstTemporary;
+		return conditionJump;
+	}
+	int Compiler::compileFuncCall(FuncCall* funcCall, int target) {
+		if (shouldUseSuperinstructions) {
+			const int elementAccess = compileElementAccess(funcCall, target);
+
+			if (elementAccess != -1)
+				return elementAccess;
+		}
+
+		const int nodeIndex = addNode(funcCall);
+		const int callerSlot = findNameSlot(funcCall->caller);
+		target = resolveTarget(target);
+
+		// Natives evaluate their own arguments, as some of them modify the noodle passed in
+		for (const char* nativeFuncName : nativeFuncNames) {
+			if (funcCall->caller == nativeFuncName) {
+				emit(OpCode::CallNative, target, nodeIndex, callerSlot);
+				return target;
+			}
+		}
+
+		// The recipe is followed by its arguments, each in their own temporary
+		const int firstTemporary = nextTemporary;
+		const int argumentCount = funcCall->arguments.size();
+		const int callee = allocateTemporaries(argumentCount + 1);
+
+		// Calls the tree walker makes instead skip past the arguments
+		const int loadIndex = emit(OpCode::LoadCallee, target, callerSlot, callee, -1, nodeIndex);
+
+		for (int argumentIndex = 0; argumentIndex < argumentCount; argumentIndex++)
+			compileStatement(funcCall->arguments[argumentIndex], callee + 1 + argumentIndex);
+
+		emit(OpCode::Call, target, nodeIndex, callee);
+		chunk->instructions[loadIndex].d = nextInstructionIndex();
+		nextTemporary = firstTemporary;
+		return target;
+	}
+
+	int Compiler::compileElementAccess(FuncCall* funcCall, int target) {
+		const std::vector<Expr*>& arguments = funcCall->arguments;
+		const bool loads = funcCall->caller == nativeFuncNames[13];
+		const bool stores = funcCall->caller == nativeFuncNames[14];
+
+		// Calls the superinstructions can't handle are passed to the native with their
+		// arguments evaluated again, so they can't have side effects
+		if (!(loads && arguments.size() == 2) && !(stores && arguments.size() == 3))
+			return -1;
+		else if (!std::all_of(arguments.begin(), arguments.end(), isPure))
+			return -1;
+		// Stores check whether the list's noodle is frozen
+		else if (stores && arguments[0]->nodeType != NodeType::Identifier)
+			return -1;
+
+		const int nodeIndex = addNode(funcCall);
+		const int callerSlot = findNameSlot(funcCall->caller);
+
+		// Setting an element results in null, which is only loaded if it's used
+		if (loads || target != discarded)
+			target = resolveTarget(target);
+
+		const int firstTemporary = nextTemporary;
+
+		if (loads) {
+			const int list = compileStatement(arguments[0]);
+			const int index = compileStatement(arguments[1]);
+
+			emit(OpCode::LoadElement, target, list, index, nodeIndex, callerSlot);
+		}
+		else {
+			const int list = findNameSlot(dynamic_cast<const Identifier*>(arguments[0])->name);
+			const int index = compileStatement(arguments[1]);
+			const int element = compileStatement(arguments[2]);
+
+			emit(OpCode::StoreElement, list, index, element, nodeIndex, callerSlot);
+
+			if (target != discarded)
+				emit(OpCode::LoadNull, target);
+		}
+
+		nextTemporary = firstTemporary;
+		return target;
+	}
+
+	int Compiler::compileInlinedCall(InlinedCall* inlinedCall, int target) {
+		target = resolveTarget(target);
+
+		// Every argument is evaluated before any parameter is bound, as they may read them
+		const int firstTemporary = nextTemporary;
+		const int argumentCount = inlinedCall->arguments.size();
+		const int firstArgument = allocateTemporaries(argumentCount);
+
+		for (int argumentIndex = 0; argumentIndex < argumentCount; argumentIndex++)
+			compileStatement(inlinedCall->arguments[argumentIndex], firstArgument + argumentIndex);
+
+		for (int argumentIndex = 0; argumentIndex < argumentCount; argumentIndex++) {
+			emit(
+				OpCode::BindVariable,
+				findNameSlot(inlinedCall->parameters[argumentIndex]),
+				firstArgument + argumentIndex
+			);
+		}
+
+		compileStatements(inlinedCall->statements, target);
+		nextTemporary = firstTemporary;
+		return target;
+	}
+
+	int Compiler::emit(OpCode opCode, int a, int b, int c, int d, int e) {
+		chunk->instructions.push_back({ opCode, a, b, c, d, e, nullptr });
+		return chunk->instructions.size() - 1;
+	}
+	int Compiler::emitEvaluate(Statement* node, int target, bool declares) {
+		target = resolveTarget(target);
+		emit(OpCode::Evaluate, target, addNode(node), declares);
+		return target;
+	}
+	void Compiler::emitCopy(int target, int source) {
+		if (target != source)
+			emit(isConstantRegister(source) ? OpCode::Clone : OpCode::Move, target, source);
+	}
+	int Compiler::findNameSlot(const std::string& name) {
+		auto foundSlot = nameSlots.find(name);
+
+		if (foundSlot != nameSlots.end())
+			return foundSlot->second;
+
+		chunk->names.push_back(name);
+		nameSlots[name] = chunk->names.size() - 1;
+		return chunk->names.size() - 1;
+	}
+	int Compiler::addConstant(RuntimeValue* constant) {
+		chunk->constants.push_back(constant);
+		return chunk->constants.size() - 1;
+	}
+	int Compiler::addNode(Statement* node) {
+		chunk->nodes.push_back(node);
+		return chunk->nodes.size() - 1;
+	}
+	int Compiler::allocateTemporary() {
+		return allocateTemporaries(1);
+	}
+	int Compiler::allocateTemporaries(int count) {
+		const int firstTemporary = nextTemporary;
+
+		nextTemporary += count;
+		chunk->temporaryCount = std::max(chunk->temporaryCount, nextTemporary);
+		return temporaryOffset + firstTemporary;
+	}
+	int Compiler::resolveTarget(int target) {
+		return target < 0 ? allocateTemporary() : target;
+	}
+	void Compiler::patchJump(int jumpIndex) {
+		chunk->instructions[jumpIndex].a = nextInstructionIndex();
+	}
+	int Compiler::nextInstructionIndex() const {
+		return chunk->instructions.size();
+	}
+	void Compiler::relocateRegisters() {
+		for (auto& instruction : chunk->instructions) {
+			int* operands[] = { &instruction.a, &instruction.b, &instruction.c };
+
+			for (int operandIndex = 0; operandIndex < 3; operandIndex++) {
+				if (!(registerOperands[static_cast<int>(instruction.opCode)] & (1 << operandIndex)))
+					continue;
+
+				int& operand = *operands[operandIndex];
+
+				if (operand >= temporaryOffset)
+					operand += chunk->firstTemporary() - temporaryOffset;
+				else if (operand >= constantOffset)
+					operand += chunk->firstConstant() - constantOffset;
+			}
+		}
+	}
+	void Compiler::markTailCalls() {
+		std::vector<Instruction>& instructions = chunk->instructions;
+
+		for (auto& instruction : instructions) {
+			if (instruction.opCode != OpCode::Call)
+				continue;
+
+			// Calls at the end of an if statement's branch jump to the return, rather than
+			// being followed by it
+			size_t nextIndex = &instruction - instructions.data() + 1;
+
+			for (size_t jumpCount = 0; instructions[nextIndex].opCode == OpCode::Jump
+				&& jumpCount < instructions.size(); jumpCount++)
+			{
+				nextIndex = instructions[nextIndex].a;
+			}
+
+			// Calls stored in a noodle still have to assign it
+			if (instructions[nextIndex].opCode == OpCode::Return
+				&& instructions[nextIndex].a == instruction.a
+					&& instruction.a >= chunk->firstTemporary())
+			{
+				instruction.opCode = OpCode::TailCall;
+			}
+		}
+	}
+
+	bool Compiler::isNameRegister(int index) {
+		return index < constantOffset;
+	}
+	bool Compiler::isConstantRegister(int index) {
+		return index >= constantOffset && index < temporaryOffset;
+	}
+	bool Compiler::mayAssignVariables(const Statement* statement) {
+		switch (statement->nodeType) {
+		case NodeType::NullLiteral:
+		case NodeType::NumLiteral:
+		case NodeType::StringLiteral:
+		case NodeType::Identifier:
+			return false;
+		case NodeType::FieldAccesser:
+			return mayAssignVariables(
+				dynamic_cast<const FieldAccesser*>(statement)->object
+			);
+		case NodeType::UnaryExpr:
+			return mayAssignVariables(dynamic_cast<const UnaryExpr*>(statement)->expr);
+		case NodeType::BinaryExpr:
+		{
+			const BinaryExpr* binaryExpr = dynamic_cast<const BinaryExpr*>(statement);
+			return mayAssignVariables(binaryExpr->leftExpr)
+				|| mayAssignVariables(binaryExpr->rightExpr);
+		}
+		case NodeType::ListLiteral:
+		{
+			const ListLiteral* listLiteral = dynamic_cast<const ListLiteral*>(statement);
+			return std::any_of(
+				listLiteral->elements.begin(), listLiteral->elements.end(), mayAssignVariables
+			);
+		}
+		// Recipes can assign to the noodles of their callers
+		default:
+			return true;
+		}
+	}
+	bool Compiler::isPure(const Statement* statement) {
+		switch (statement->nodeType) {
+		case NodeType::NullLiteral:
+		case NodeType::NumLiteral:
+		case NodeType::StringLiteral:
+		case NodeType::Identifier:
+			return true;
+		case NodeType::UnaryExpr:
+		{
+			const UnaryExpr* unaryExpr = dynamic_cast<const UnaryExpr*>(statement);
+			return (unaryExpr->operation == "-" || unaryExpr->operation == "!")
+				&& isPure(unaryExpr->expr);
+		}
+		case NodeType::BinaryExpr:
+		{
+			const BinaryExpr* binaryExpr = dynamic_cast<const BinaryExpr*>(statement);
+			return isPure(binaryExpr->leftExpr) && isPure(binaryExpr->rightExpr);
+		}
+		default:
+			return false;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,1389 @@
+#include "../../../hdr/runtime/vm/Jit.hpp"
+#include "../../../hdr/runtime/eval/Expressions.hpp"
+
+#include <cstddef>
+#include <cstring>
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace ns {
+	namespace {
+		enum Register {
+			Rax, Rcx, Rdx, Rbx, Rsp, Rbp, Rsi, Rdi, R8, R9, R10, R11, R12, R13, R14, R15
+		};
+		// Condition codes of jcc, which are added to its op code
+		enum Condition {
+			IfOverflow = 0x0,
+			IfBelow = 0x2,
+			IfAboveEqual = 0x3,
+			IfEqual = 0x4,
+			IfNotEqual = 0x5,
+			IfBelowEqual = 0x6,
+			IfAbove = 0x7,
+			IfParity = 0xA,
+			IfLess = 0xC,
+			IfGreaterEqual = 0xD,
+			IfLessEqual = 0xE,
+			IfGreater = 0xF
+		};
+
+		// Encodes the few x86-64 instructions native code needs. Memory operands are always a
+		// base register with a 32 bit displacement.
+		class Assembler {
+		public:
+			std::vector<uint8_t> code;
+
+			int createLabel() {
+				labels.push_back(-1);
+				return labels.size() - 1;
+			}
+			void bind(int label) {
+				labels[label] = code.size();
+			}
+			// Points every jump at its label, once they're all bound
+			void link() {
+				for (auto& fixup : fixups) {
+					const int32_t displacement = labels[fixup.second] - (fixup.first + 4);
+					std::memcpy(&code[fixup.first], &displacement, 4);
+				}
+			}
+
+			// mov target, [base + displacement]
+			void load(Register target, Register base, int displacement) {
+				prefix(true, target, base);
+				emit(0x8B);
+				memory(target, base, displacement);
+			}
+			// mov [base + displacement], source
+			void store(Register base, int displacement, Register source) {
+				prefix(true, source, base);
+				emit(0x89);
+				memory(source, base, displacement);
+			}
+			void move(Register target, Register source) {
+				prefix(true, source, target);
+				emit(0x89);
+				emit(0xC0 | (source & 7) << 3 | (target & 7));
+			}
+			void moveImmediate(Register target, int64_t value) {
+				prefix(true, 0, target);
+				emit(0xB8 + (target & 7));
+				emitBytes(&value, 8);
+			}
+			void moveImmediate32(Register target, int32_t value) {
+				prefix(false, 0, target);
+				emit(0xB8 + (target & 7));
+				emitBytes(&value, 4);
+			}
+			void test(Register left, Register right) {
+				prefix(true, right, left);
+				emit(0x85);
+				emit(0xC0 | (right & 7) << 3 | (left & 7));
+			}
+			// test al, al
+			void testByte() {
+				emit(0x84);
+				emit(0xC0);
+			}
+			// cmp dword [base + displacement], value
+			void compare32(Register base, int displacement, int32_t value) {
+				prefix(false, 0, base);
+				emit(0x81);
+				memory(7, base, displacement);
+				emitBytes(&value, 4);
+			}
+			// mov byte [base + displacement], value
+			void storeByte(Register base, int displacement, int8_t value) {
+				prefix(false, 0, base);
+				emit(0xC6);
+				memory(0, base, displacement);
+				emit(value);
+			}
+			// movzx target, byte [base + displacement]
+			void loadByte(Register target, Register base, int displacement) {
+				prefix(false, target, base);
+				emit(0x0F);
+				emit(0xB6);
+				memory(target, base, displacement);
+			}
+			// mov byte [base + displacement], source, whose low byte needs no REX prefix
+			void storeByte(Register base, int displacement, Register source) {
+				prefix(false, source, base);
+				emit(0x88);
+				memory(source, base, displacement);
+			}
+			// cmp target, value
+			void compareImmediate(Register target, int8_t value) {
+				prefix(true, 0, target);
+				emit(0x83);
+				emit(0xC0 | 7 << 3 | (target & 7));
+				emit(value);
+			}
+			// Signed division of Rdx:Rax sign extended from Rax, leaving the remainder in Rdx
+			void divide(Register divisor) {
+				prefix(true, 0, 0);
+				emit(0x99);
+				prefix(true, 0, divisor);
+				emit(0xF7);
+				emit(0xC0 | 7 << 3 | (divisor & 7));
+			}
+			// cmp byte [base + displacement], value
+			void compareByte(Register base, int displacement, int8_t value) {
+				prefix(false, 0, base);
+				emit(0x80);
+				memory(7, base, displacement);
+				emit(value);
+			}
+			// Applies add, sub or cmp to target and [base + displacement]
+			void add(Register target, Register base, int displacement) {
+				arithmetic(0x03, target, base, displacement);
+			}
+			void subtract(Register target, Register base, int displacement) {
+				arithmetic(0x2B, target, base, displacement);
+			}
+			void compare(Register target, Register base, int displacement) {
+				arithmetic(0x3B, target, base, displacement);
+			}
+			void multiply(Register target, Register base, int displacement) {
+				prefix(true, target, base);
+				emit(0x0F);
+				emit(0xAF);
+				memory(target, base, displacement);
+			}
+			// add target, 1 or sub target, 1
+			void step(Register target, bool increments) {
+				prefix(true, 0, target);
+				emit(0x83);
+				emit(0xC0 | (increments ? 0 : 5) << 3 | (target & 7));
+				emit(1);
+			}
+			// Scalar double instructions on xmm0 and [base + displacement], such as movsd and
+			// addsd
+			void scalarDouble(int opCode, Register base, int displacement) {
+				emit(0xF2);
+				prefix(false, 0, base);
+				emit(0x0F);
+				emit(opCode);
+				memory(0, base, displacement);
+			}
+			// ucomisd xmm0, [base + displacement]
+			void compareDouble(Register base, int displacement) {
+				emit(0x66);
+				prefix(false, 0, base);
+				emit(0x0F);
+				emit(0x2E);
+				memory(0, base, displacement);
+			}
+			// cvtsi2sd xmm0, source
+			void convertToDouble(Register source) {
+				emit(0xF2);
+				prefix(true, 0, source);
+				emit(0x0F);
+				emit(0x2A);
+				emit(0xC0 | (source & 7));
+			}
+			void jump(int label) {
+				emit(0xE9);
+				addFixup(label);
+			}
+			void jumpIf(Condition condition, int label) {
+				emit(0x0F);
+				emit(0x80 | condition);
+				addFixup(label);
+			}
+			void jumpTo(Register target) {
+				prefix(false, 0, target);
+				emit(0xFF);
+				emit(0xE0 | (target & 7));
+			}
+			void call(const void* function) {
+				moveImmediate(Rax, reinterpret_cast<int64_t>(function));
+				emit(0xFF);
+				emit(0xD0);
+			}
+			void push(Register source) {
+				prefix(false, 0, source);
+				emit(0x50 + (source & 7));
+			}
+			void pop(Register target) {
+				prefix(false, 0, target);
+				emit(0x58 + (target & 7));
+			}
+			void ret() {
+				emit(0xC3);
+			}
+		private:
+			// Each label is the offset it's bound to, or -1 until then
+			std::vector<int> labels;
+			// Offsets of jump displacements, with the labels they jump to
+			std::vector<std::pair<int, int>> fixups;
+
+			void emit(int byte) {
+				code.push_back(static_cast<uint8_t>(byte));
+			}
+			void emitBytes(const void* bytes, size_t count) {
+				const uint8_t* first = static_cast<const uint8_t*>(bytes);
+				code.insert(code.end(), first, first + count);
+			}
+			// REX prefix, which is left out when nothing in it is set
+			void prefix(bool wide, int reg, int base) {
+				const int rex = 0x40 | (wide ? 8 : 0) | (reg >> 3) << 2 | (base >> 3);
+
+				if (rex != 0x40)
+					emit(rex);
+			}
+			void memory(int reg, int base, int displacement) {
+				emit(0x80 | (reg & 7) << 3 | (base & 7));
+
+				// Rsp and R12 can only be used as a base through a SIB byte
+				if ((base & 7) == Rsp)
+					emit(0x24);
+
+				emitBytes(&displacement, 4);
+			}
+			void arithmetic(int opCode, Register target, Register base, int displacement) {
+				prefix(true, target, base);
+				emit(opCode);
+				memory(target, base, displacement);
+			}
+			void addFixup(int label) {
+				fixups.emplace_back(code.size(), label);
+				emitBytes("\0\0\0\0", 4);
+			}
+		};
+
+		// Offsets of the fields native code reads and writes
+		struct ValueLayout {
+			int valueType;
+			int number;
+			int integral;
+			int integer;
+			int state;
+
+			ValueLayout() {
+				NumValue numValue;
+				BoolValue boolValue;
+				const char* numBase = reinterpret_cast<const char*>(&numValue);
+				const char* boolBase = reinterpret_cast<const char*>(&boolValue);
+
+				valueType = reinterpret_cast<const char*>(&numValue.valueType) - numBase;
+				number = reinterpret_cast<const char*>(&numValue.value) - numBase;
+				integral = reinterpret_cast<const char*>(&numValue.integral) - numBase;
+				integer = reinterpret_cast<const char*>(&numValue.integer) - numBase;
+				state = reinterpret_cast<const char*>(&boolValue.state) - boolBase;
+			}
+		};
+
+		// Helpers called by native code, which never let an error unwind through it
+		RuntimeValue** findRegister(NativeFrame* frame, int index) {
+			if (frame->registers[index] == nullptr) {
+				frame->variables[index] = frame->scope->findVariable(frame->chunk->names[index]);
+				frame->registers[index] = &frame->variables[index]->runtimeValue;
+			}
+
+			return frame->registers[index];
+		}
+		RuntimeValue** bindRegister(NativeFrame* frame, int index) {
+			try {
+				return findRegister(frame, index);
+			}
+			catch (...) {
+				frame->exception = std::current_exception();
+				return nullptr;
+			}
+		}
+		// Whether the register holds a number, for the checks made when native code is entered.
+		// Noodles that aren't declared don't, rather than throwing.
+		bool holdsNumber(NativeFrame* frame, int index) {
+			if (frame->registers[index] == nullptr) {
+				Scope::Variable* variable = frame->scope->lookupVariable(
+					frame->chunk->names[index]
+				);
+
+				if (variable == nullptr)
+					return false;
+
+				frame->variables[index] = variable;
+				frame->registers[index] = &variable->runtimeValue;
+			}
+
+			const RuntimeValue* value = *frame->registers[index];
+
+			return value != nullptr && value->valueType == ValueType::Number;
+		}
+		// Runs instructions that don't only work on numbers like the interpreter does, and
+		// returns whether they succeeded
+		bool executeInstruction(NativeFrame* frame, int instructionIndex) {
+			const Instruction& instruction = frame->chunk->instructions[instructionIndex];
+			const std::vector<std::string>& names = frame->chunk->names;
+
+			#define REGISTER(index) (*findRegister(frame, index))
+
+			try {
+				switch (instruction.opCode) {
+				case OpCode::Clone:
+					REGISTER(instruction.a) = cloneRuntimeValue(REGISTER(instruction.b));
+					break;
+				case OpCode::LoadNull:
+					REGISTER(instruction.a) = globalMemory->create<NullValue>();
+					break;
+				case OpCode::FailLoopCondition:
+					throwLoopConditionError();
+					break;
+				case OpCode::DeclareVariable:
+					frame->scope->declareVariable(
+						names[instruction.a], REGISTER(instruction.b), instruction.c
+					);
+					frame->variables[instruction.a] = frame->scope->findVariable(
+						names[instruction.a]
+					);
+					frame->registers[instruction.a] =
+						&frame->variables[instruction.a]->runtimeValue;
+					break;
+				case OpCode::AssignVariable:
+				{
+					RuntimeValue* value = cloneRuntimeValue(REGISTER(instruction.c));
+
+					findRegister(frame, instruction.b);
+					Scope::assignVariable(
+						frame->variables[instruction.b], names[instruction.b], value
+					);
+					REGISTER(instruction.a) = value;
+					break;
+				}
+				case OpCode::BindVariable:
+					if (frame->variables[instruction.a] == nullptr) {
+						frame->variables[instruction.a] = frame->scope->bindVariable(
+							names[instruction.a], REGISTER(instruction.b)
+						);
+						frame->registers[instruction.a] =
+							&frame->variables[instruction.a]->runtimeValue;
+					}
+					else
+						frame->variables[instruction.a]->runtimeValue = REGISTER(instruction.b);
+
+					break;
+				case OpCode::PrepareRange:
+				{
+					const int noodle = instruction.b;
+
+					prepareRange(
+						REGISTER(instruction.a), REGISTER(instruction.a + 1),
+						REGISTER(instruction.a + 2)
+					);
+					frame->variables[noodle] = frame->scope->declareLoopVariable(
+						names[noodle], cloneRuntimeValue(REGISTER(instruction.a))
+					);
+					frame->registers[noodle] = &frame->variables[noodle]->runtimeValue;
+					frame->ownedValues[noodle] = frame->variables[noodle]->runtimeValue;
+					break;
+				}
+				case OpCode::Negate:
+				case OpCode::Increment:
+				case OpCode::Decrement:
+				case OpCode::Not:
+					REGISTER(instruction.a) = evaluateUnaryValue(
+						REGISTER(instruction.b),
+						operationNames[static_cast<int>(instruction.opCode)
+							- static_cast<int>(OpCode::Negate)]
+					);
+					break;
+				default:
+					REGISTER(instruction.a) = evaluateBinaryValues(
+						REGISTER(instruction.b),
+						REGISTER(instruction.c),
+						operationNames[static_cast<int>(instruction.opCode)
+							- static_cast<int>(OpCode::Negate)]
+					);
+					break;
+				}
+			}
+			catch (...) {
+				frame->exception = std::current_exception();
+				return false;
+			}
+
+			#undef REGISTER
+
+			return true;
+		}
+		// Runs NextInRange like the interpreter does, for counts native code doesn't step
+		// itself, and returns whether the loop goes on
+		bool advanceRangeRegisters(NativeFrame* frame, int instructionIndex) {
+			const Instruction& instruction = frame->chunk->instructions[instructionIndex];
+
+			return advanceRange(
+				*findRegister(frame, instruction.b), frame->ownedValues[instruction.b],
+				static_cast<NumValue*>(*frame->registers[instruction.a]),
+				static_cast<const NumValue*>(*frame->registers[instruction.a + 1]),
+				static_cast<const NumValue*>(*frame->registers[instruction.a + 2])
+			);
+		}
+		RuntimeValue* createInteger(int64_t integer) {
+			NumValue* numValue = globalMemory->create<NumValue>();
+			numValue->setInteger(integer);
+			return numValue;
+		}
+		RuntimeValue* createNumber(double number) {
+			NumValue* numValue = globalMemory->create<NumValue>();
+			numValue->value = number;
+			return numValue;
+		}
+
+		// Added to doubles by ++ and --
+		const double steps[] = { 1.0, -1.0 };
+		const double zero = 0.0;
+
+		template <typename Function>
+		const void* address(Function function) {
+			return reinterpret_cast<const void*>(function);
+		}
+
+		// Registers holding the instruction's operands, rather than where its result goes
+		std::vector<int> readRegisters(const Instruction& instruction) {
+			switch (instruction.opCode) {
+			case OpCode::LoadNull:
+			case OpCode::Jump:
+			case OpCode::FailLoopCondition:
+				return {};
+			case OpCode::AssignVariable:
+				return { instruction.c };
+			case OpCode::JumpIfFalse:
+			case OpCode::Return:
+				return { instruction.a };
+			case OpCode::PrepareRange:
+			case OpCode::NextInRange:
+				return { instruction.a, instruction.a + 1, instruction.a + 2 };
+			case OpCode::JumpUnlessEqual:
+			case OpCode::JumpUnlessNotEqual:
+			case OpCode::JumpUnlessGreater:
+			case OpCode::JumpUnlessLess:
+			case OpCode::JumpUnlessGreaterEqual:
+			case OpCode::JumpUnlessLessEqual:
+				return { instruction.a, instruction.b };
+			default:
+				if (isBinaryOperation(instruction.opCode))
+					return { instruction.b, instruction.c };
+
+				return { instruction.b };
+			}
+		}
+		// Whether the instruction only reads the numbers in its operands, without keeping the
+		// values holding them
+		bool onlyReadsNumbers(const Instruction& instruction) {
+			switch (instruction.opCode) {
+			case OpCode::JumpUnlessEqual:
+			case OpCode::JumpUnlessNotEqual:
+			case OpCode::JumpUnlessGreater:
+			case OpCode::JumpUnlessLess:
+			case OpCode::JumpUnlessGreaterEqual:
+			case OpCode::JumpUnlessLessEqual:
+			// Noodles are assigned a copy of the value
+			case OpCode::AssignVariable:
+			case OpCode::PrepareRange:
+			case OpCode::NextInRange:
+				return true;
+			default:
+				return isBinaryOperation(instruction.opCode)
+					&& instruction.opCode != OpCode::And && instruction.opCode != OpCode::Or;
+			}
+		}
+		// Registers native code checks to hold numbers before running the instruction, so that
+		// they're known to hold numbers once it ran
+		std::vector<int> guardedRegisters(const Instruction& instruction) {
+			switch (instruction.opCode) {
+			case OpCode::Add:
+			case OpCode::Subtract:
+			case OpCode::Multiply:
+			case OpCode::Divide:
+			case OpCode::Modulo:
+			case OpCode::Power:
+			case OpCode::Equal:
+			case OpCode::NotEqual:
+			case OpCode::Greater:
+			case OpCode::Less:
+			case OpCode::GreaterEqual:
+			case OpCode::LessEqual:
+				return { instruction.b, instruction.c };
+			case OpCode::JumpUnlessEqual:
+			case OpCode::JumpUnlessNotEqual:
+			case OpCode::JumpUnlessGreater:
+			case OpCode::JumpUnlessLess:
+			case OpCode::JumpUnlessGreaterEqual:
+			case OpCode::JumpUnlessLessEqual:
+				return { instruction.a, instruction.b };
+			case OpCode::IncrementVariable:
+			case OpCode::DecrementVariable:
+				return { instruction.b };
+			default:
+				return {};
+			}
+		}
+		// Instructions native code can continue at once the instruction ran. Comparisons that
+		// aren't between numbers never jump, as native code leaves before them.
+		std::vector<int> successors(const Instruction& instruction, int instructionIndex) {
+			switch (instruction.opCode) {
+			case OpCode::Jump:
+				return { instruction.a };
+			case OpCode::JumpIfFalse:
+				return { instructionIndex + 1, instruction.c, instruction.d };
+			case OpCode::JumpUnlessEqual:
+			case OpCode::JumpUnlessNotEqual:
+			case OpCode::JumpUnlessGreater:
+			case OpCode::JumpUnlessLess:
+			case OpCode::JumpUnlessGreaterEqual:
+			case OpCode::JumpUnlessLessEqual:
+			case OpCode::NextInRange:
+				return { instructionIndex + 1, instruction.c };
+			case OpCode::FailLoopCondition:
+			case OpCode::Return:
+				return {};
+			default:
+				return { instructionIndex + 1 };
+			}
+		}
+
+		// Native code only covers instructions working on numbers and moving values between
+		// noodles, so chunks calling recipes or using anything but numbers stay interpreted
+		bool isNumericChunk(const Chunk* chunk) {
+			for (auto& constant : chunk->constants) {
+				if (constant->valueType != ValueType::Number)
+					return false;
+			}
+
+			for (auto& instruction : chunk->instructions) {
+				switch (instruction.opCode) {
+				case OpCode::DeclareRecipe:
+				case OpCode::Evaluate:
+				case OpCode::MakeList:
+				case OpCode::GetField:
+				case OpCode::LoadCallee:
+				case OpCode::Call:
+				case OpCode::TailCall:
+				case OpCode::CallNative:
+				case OpCode::LoadElement:
+				case OpCode::StoreElement:
+				case OpCode::PrepareElements:
+				case OpCode::NextElement:
+					return false;
+				default:
+					break;
+				}
+			}
+
+			return true;
+		}
+
+		class NativeCompiler {
+		public:
+			NativeCompiler(const Chunk* chunk) : chunk(chunk) {
+			}
+
+			// Native code is entered through a prologue, which jumps to the instruction it's
+			// given after saving the registers it uses
+			std::vector<uint8_t> compile(std::vector<size_t>& entries) {
+				const int instructionCount = chunk->instructions.size();
+
+				for (int instructionIndex = 0; instructionIndex < instructionCount;
+					instructionIndex++)
+				{
+					instructionLabels.push_back(assembler.createLabel());
+				}
+
+				deoptimizeLabels.assign(instructionCount, -1);
+				findScratchValues();
+				inferNumbers();
+				exitLabel = assembler.createLabel();
+				threwLabel = assembler.createLabel();
+
+				for (Register saved : { Rbx, R12, R13, R14, R15 })
+					assembler.push(saved);
+
+				assembler.move(Rbx, Rdi);
+				assembler.load(R12, Rbx, offsetof(NativeFrame, registers));
+				assembler.jumpTo(Rsi);
+
+				for (int instructionIndex = 0; instructionIndex < instructionCount;
+					instructionIndex++)
+				{
+					entries.push_back(assembler.code.size());
+					assembler.bind(instructionLabels[instructionIndex]);
+					compileInstruction(instructionIndex);
+				}
+
+				// Where native code is entered, the registers inferred to hold numbers are
+				// checked first, and the interpreter runs the chunk when they don't
+				for (int instructionIndex = 0; instructionIndex < instructionCount;
+					instructionIndex++)
+				{
+					if (isEntry(instructionIndex)) {
+						entries[instructionIndex] = assembler.code.size();
+						compileEntryCheck(instructionIndex);
+					}
+				}
+
+				// Guards that fail hand the instruction back to the interpreter
+				for (int instructionIndex = 0; instructionIndex < instructionCount;
+					instructionIndex++)
+				{
+					if (deoptimizeLabels[instructionIndex] == -1)
+						continue;
+
+					assembler.bind(deoptimizeLabels[instructionIndex]);
+					assembler.moveImmediate32(Rax, instructionIndex);
+					assembler.jump(exitLabel);
+				}
+
+				assembler.bind(threwLabel);
+				assembler.moveImmediate32(Rax, nativeThrew);
+				assembler.bind(exitLabel);
+
+				for (Register saved : { R15, R14, R13, R12, Rbx })
+					assembler.pop(saved);
+
+				assembler.ret();
+				assembler.link();
+				return assembler.code;
+			}
+		private:
+			const Chunk* chunk;
+			Assembler assembler;
+			ValueLayout layout;
+			std::vector<int> instructionLabels;
+			std::vector<int> deoptimizeLabels;
+			// Temporaries whose numbers are only read, and never kept, are updated in place
+			// rather than being given a new value each time. Other registers have no value.
+			std::vector<NumValue*> scratchValues;
+			std::vector<bool> onlyReadAsNumbers;
+			// Registers known to hold numbers before each instruction
+			std::vector<std::vector<bool>> numberRegisters;
+			int exitLabel;
+			int threwLabel;
+
+			void findScratchValues() {
+				onlyReadAsNumbers.assign(chunk->registerCount(), true);
+
+				for (auto& instruction : chunk->instructions) {
+					for (int index : readRegisters(instruction)) {
+						if (!onlyReadsNumbers(instruction))
+							onlyReadAsNumbers[index] = false;
+					}
+				}
+
+				scratchValues.assign(chunk->registerCount(), nullptr);
+
+				for (int index = chunk->firstTemporary(); index < chunk->registerCount(); index++) {
+					if (onlyReadAsNumbers[index])
+						scratchValues[index] = globalMemory->create<NumValue>();
+				}
+			}
+			// Infers which registers hold numbers before each instruction, from every path
+			// native code can take to it. Constants and the results of arithmetic are numbers,
+			// and so are the operands of guarded instructions once they ran, as native code
+			// leaves when a guard fails. Noodles the chunk never declares, like the recipe's
+			// parameters, are assumed to be numbers if they're ever guarded, which is checked
+			// once when native code is entered.
+			void inferNumbers() {
+				const int instructionCount = chunk->instructions.size();
+				std::vector<bool> entryNumbers(chunk->registerCount(), false);
+				std::vector<bool> reached(instructionCount, false);
+				std::vector<int> worklist;
+
+				for (auto& instruction : chunk->instructions) {
+					for (int index : guardedRegisters(instruction)) {
+						if (index < chunk->firstConstant())
+							entryNumbers[index] = true;
+					}
+				}
+				for (auto& instruction : chunk->instructions) {
+					if (instruction.opCode == OpCode::DeclareVariable
+						|| instruction.opCode == OpCode::BindVariable)
+					{
+						entryNumbers[instruction.a] = false;
+					}
+					else if (instruction.opCode == OpCode::PrepareRange)
+						entryNumbers[instruction.b] = false;
+				}
+
+				numberRegisters.assign(
+					instructionCount, std::vector<bool>(chunk->registerCount(), false)
+				);
+				numberRegisters[0] = entryNumbers;
+				reached[0] = true;
+				worklist.push_back(0);
+
+				while (!worklist.empty()) {
+					const int instructionIndex = worklist.back();
+					const Instruction& instruction = chunk->instructions[instructionIndex];
+					std::vector<bool> numbers = numberRegisters[instructionIndex];
+
+					worklist.pop_back();
+					inferInstruction(instruction, numbers);
+
+					// Registers are only known to hold numbers where they do on every path
+					for (int successor : successors(instruction, instructionIndex)) {
+						std::vector<bool>& successorNumbers = numberRegisters[successor];
+						bool changed = !reached[successor];
+
+						if (!reached[successor])
+							successorNumbers = numbers;
+
+						for (int index = 0; index < chunk->registerCount(); index++) {
+							if (successorNumbers[index] && !numbers[index]) {
+								successorNumbers[index] = false;
+								changed = true;
+							}
+						}
+
+						reached[successor] = true;
+
+						if (changed)
+							worklist.push_back(successor);
+					}
+				}
+			}
+			// Updates the registers known to hold numbers once the instruction ran
+			void inferInstruction(const Instruction& instruction, std::vector<bool>& numbers) {
+				for (int index : guardedRegisters(instruction))
+					numbers[index] = true;
+
+				switch (instruction.opCode) {
+				case OpCode::Move:
+				case OpCode::Clone:
+				case OpCode::DeclareVariable:
+				case OpCode::BindVariable:
+					numbers[instruction.a] = isNumber(numbers, instruction.b);
+					break;
+				case OpCode::AssignVariable:
+					numbers[instruction.a] = isNumber(numbers, instruction.c);
+					numbers[instruction.b] = numbers[instruction.a];
+					break;
+				case OpCode::Add:
+				case OpCode::Subtract:
+				case OpCode::Multiply:
+				case OpCode::Divide:
+				case OpCode::Modulo:
+				case OpCode::Power:
+				case OpCode::IncrementVariable:
+				case OpCode::DecrementVariable:
+					numbers[instruction.a] = true;
+					break;
+				// The bounds were checked to be numbers, and the noodle is a copy of the start
+				case OpCode::PrepareRange:
+					for (int index = instruction.a; index < instruction.a + 3; index++)
+						numbers[index] = true;
+
+					numbers[instruction.b] = true;
+					break;
+				// Where the loop ends, the noodle still holds whatever the body assigned it
+				case OpCode::NextInRange:
+				case OpCode::Jump:
+				case OpCode::JumpIfFalse:
+				case OpCode::JumpUnlessEqual:
+				case OpCode::JumpUnlessNotEqual:
+				case OpCode::JumpUnlessGreater:
+				case OpCode::JumpUnlessLess:
+				case OpCode::JumpUnlessGreaterEqual:
+				case OpCode::JumpUnlessLessEqual:
+				case OpCode::FailLoopCondition:
+				case OpCode::Return:
+					break;
+				default:
+					numbers[instruction.a] = false;
+					break;
+				}
+			}
+			bool isNumber(const std::vector<bool>& numbers, int index) const {
+				return numbers[index] || isConstant(index);
+			}
+			bool isConstant(int index) const {
+				return index >= chunk->firstConstant() && index < chunk->firstTemporary();
+			}
+			// Native code is entered at the chunk's first instruction, and where loops jump
+			// back to
+			bool isEntry(int instructionIndex) const {
+				if (instructionIndex == 0)
+					return true;
+
+				for (int jumpIndex = instructionIndex;
+					jumpIndex < static_cast<int>(chunk->instructions.size()); jumpIndex++)
+				{
+					const Instruction& instruction = chunk->instructions[jumpIndex];
+
+					if (instruction.opCode == OpCode::Jump && instruction.a == instructionIndex)
+						return true;
+				}
+
+				return false;
+			}
+			int deoptimizeLabel(int instructionIndex) {
+				if (deoptimizeLabels[instructionIndex] == -1)
+					deoptimizeLabels[instructionIndex] = assembler.createLabel();
+
+				return deoptimizeLabels[instructionIndex];
+			}
+			// Leaves the address of the register's value in Rax, looking up noodles that
+			// weren't found yet
+			void compileRegisterAddress(int index) {
+				assembler.load(Rax, R12, index * sizeof(RuntimeValue**));
+
+				if (index < chunk->firstConstant()) {
+					const int foundLabel = assembler.createLabel();
+
+					assembler.test(Rax, Rax);
+					assembler.jumpIf(IfNotEqual, foundLabel);
+					assembler.move(Rdi, Rbx);
+					assembler.moveImmediate32(Rsi, index);
+					assembler.call(address(&bindRegister));
+					assembler.test(Rax, Rax);
+					assembler.jumpIf(IfEqual, threwLabel);
+					assembler.bind(foundLabel);
+				}
+			}
+			void compileLoad(Register target, int index) {
+				// Constants are never written to, so their values are known
+				if (index >= chunk->firstConstant() && index < chunk->firstTemporary()) {
+					assembler.moveImmediate(target, reinterpret_cast<int64_t>(
+						chunk->constants[index - chunk->firstConstant()]
+					));
+					return;
+				}
+
+				compileRegisterAddress(index);
+				assembler.load(target, Rax, 0);
+			}
+			// The source must be preserved across calls
+			void compileStore(int index, Register source) {
+				compileRegisterAddress(index);
+				assembler.store(Rax, 0, source);
+			}
+			// Leaves native code unless the register holds a number, which is left out where
+			// it's known to
+			void compileNumberGuard(Register value, int index, int instructionIndex) {
+				if (isNumber(numberRegisters[instructionIndex], index))
+					return;
+
+				assembler.compare32(
+					value, layout.valueType, static_cast<int32_t>(ValueType::Number)
+				);
+				assembler.jumpIf(IfNotEqual, deoptimizeLabel(instructionIndex));
+			}
+			void compileEntryCheck(int instructionIndex) {
+				for (int index = 0; index < chunk->registerCount(); index++) {
+					if (!numberRegisters[instructionIndex][index] || isConstant(index))
+						continue;
+
+					assembler.move(Rdi, Rbx);
+					assembler.moveImmediate32(Rsi, index);
+					assembler.call(address(&holdsNumber));
+					assembler.testByte();
+					assembler.jumpIf(IfEqual, deoptimizeLabel(instructionIndex));
+				}
+
+				assembler.jump(instructionLabels[instructionIndex]);
+			}
+			// Temporaries only read as numbers never let another register refer to their value
+			bool isNumberTemporary(int index) const {
+				return index >= chunk->firstTemporary() && onlyReadAsNumbers[index];
+			}
+			// Whether the instruction may keep the values of the registers it reads, so that
+			// something else refers to them
+			bool keepsValues(const Instruction& instruction) const {
+				switch (instruction.opCode) {
+				case OpCode::Clone:
+				case OpCode::JumpIfFalse:
+				case OpCode::IncrementVariable:
+				case OpCode::DecrementVariable:
+					return false;
+				case OpCode::Move:
+					return !isNumberTemporary(instruction.a);
+				default:
+					return !onlyReadsNumbers(instruction);
+				}
+			}
+			// Once something else may refer to the value native code assigned to a noodle, it's
+			// no longer updated in place
+			void compileForgetOwnedValue(int index) {
+				assembler.load(Rcx, Rbx, offsetof(NativeFrame, ownedValues));
+				assembler.moveImmediate32(Rdx, 0);
+				assembler.store(Rcx, index * sizeof(RuntimeValue*), Rdx);
+			}
+			// Jumps to the label unless both numbers are integers
+			void compileIntegerCheck(int label) {
+				assembler.compareByte(R13, layout.integral, 0);
+				assembler.jumpIf(IfEqual, label);
+				assembler.compareByte(R14, layout.integral, 0);
+				assembler.jumpIf(IfEqual, label);
+			}
+
+			void compileInstruction(int instructionIndex) {
+				const Instruction& instruction = chunk->instructions[instructionIndex];
+
+				if (keepsValues(instruction)) {
+					for (int index : readRegisters(instruction)) {
+						if (index < chunk->firstConstant())
+							compileForgetOwnedValue(index);
+					}
+				}
+
+				switch (instruction.opCode) {
+				case OpCode::Move:
+					compileLoad(R13, instruction.b);
+					compileStore(instruction.a, R13);
+					break;
+				case OpCode::Add:
+				case OpCode::Subtract:
+				case OpCode::Multiply:
+				case OpCode::Divide:
+				case OpCode::Modulo:
+				case OpCode::Power:
+				case OpCode::Equal:
+				case OpCode::NotEqual:
+				case OpCode::Greater:
+				case OpCode::Less:
+				case OpCode::GreaterEqual:
+				case OpCode::LessEqual:
+					compileNumberOperation(instruction, instructionIndex);
+					break;
+				case OpCode::Jump:
+					assembler.jump(instructionLabels[instruction.a]);
+					break;
+				case OpCode::JumpIfFalse:
+					compileLoad(R13, instruction.a);
+					assembler.compare32(
+						R13, layout.valueType, static_cast<int32_t>(ValueType::Bool)
+					);
+					assembler.jumpIf(IfNotEqual, instructionLabels[instruction.d]);
+					assembler.compareByte(R13, layout.state, 0);
+					assembler.jumpIf(IfEqual, instructionLabels[instruction.c]);
+					break;
+				case OpCode::JumpUnlessEqual:
+				case OpCode::JumpUnlessNotEqual:
+				case OpCode::JumpUnlessGreater:
+				case OpCode::JumpUnlessLess:
+				case OpCode::JumpUnlessGreaterEqual:
+				case OpCode::JumpUnlessLessEqual:
+					compileComparisonJump(instruction, instructionIndex);
+					break;
+				case OpCode::IncrementVariable:
+				case OpCode::DecrementVariable:
+				{
+					const bool increments = instruction.opCode == OpCode::IncrementVariable;
+					const int doubleLabel = assembler.createLabel();
+					const int resultLabel = assembler.createLabel();
+
+					// Numbers are updated in place, and integers that would overflow are left
+					// to the interpreter
+					compileLoad(R13, instruction.b);
+					compileNumberGuard(R13, instruction.b, instructionIndex);
+					assembler.compareByte(R13, layout.integral, 0);
+					assembler.jumpIf(IfEqual, doubleLabel);
+					assembler.load(Rcx, R13, layout.integer);
+					assembler.step(Rcx, increments);
+					assembler.jumpIf(IfOverflow, deoptimizeLabel(instructionIndex));
+					assembler.store(R13, layout.integer, Rcx);
+					assembler.convertToDouble(Rcx);
+					assembler.scalarDouble(0x11, R13, layout.number);
+					assembler.jump(resultLabel);
+
+					assembler.bind(doubleLabel);
+					assembler.moveImmediate(Rcx, reinterpret_cast<int64_t>(
+						&steps[increments ? 0 : 1]
+					));
+					assembler.scalarDouble(0x10, R13, layout.number);
+					assembler.scalarDouble(0x58, Rcx, 0);
+					assembler.scalarDouble(0x11, R13, layout.number);
+					assembler.bind(resultLabel);
+					compileStore(instruction.a, R13);
+
+					// The result refers to the noodle's value
+					if (!isNumberTemporary(instruction.a))
+						compileForgetOwnedValue(instruction.b);
+
+					break;
+				}
+				case OpCode::AssignVariable:
+					compileAssignment(instruction, instructionIndex);
+					break;
+				case OpCode::NextInRange:
+					compileRangeStep(instruction, instructionIndex);
+					break;
+				case OpCode::Return:
+					compileLoad(R13, instruction.a);
+					assembler.store(Rbx, offsetof(NativeFrame, result), R13);
+					assembler.moveImmediate32(Rax, nativeReturned);
+					assembler.jump(exitLabel);
+					break;
+				default:
+					compileInstructionCall(instructionIndex);
+					break;
+				}
+			}
+			// Runs the instruction like the interpreter does
+			void compileInstructionCall(int instructionIndex) {
+				assembler.move(Rdi, Rbx);
+				assembler.moveImmediate32(Rsi, instructionIndex);
+				assembler.call(address(&executeInstruction));
+				assembler.testByte();
+				assembler.jumpIf(IfEqual, threwLabel);
+			}
+			// Noodles are assigned a copy of the number, which the first assignment allocates.
+			// As long as nothing else refers to that copy, later assignments update it in place,
+			// so the noodle's number stays unboxed in the same value.
+			void compileAssignment(const Instruction& instruction, int instructionIndex) {
+				const int ownedOffset = instruction.b * sizeof(RuntimeValue*);
+				const int copyLabel = assembler.createLabel();
+				const int resultLabel = assembler.createLabel();
+
+				// Where the result is kept, the noodle's value is no longer its own
+				if (!isNumberTemporary(instruction.a)) {
+					compileInstructionCall(instructionIndex);
+					compileForgetOwnedValue(instruction.b);
+					return;
+				}
+
+				compileLoad(R13, instruction.c);
+
+				if (!isNumber(numberRegisters[instructionIndex], instruction.c)) {
+					assembler.compare32(
+						R13, layout.valueType, static_cast<int32_t>(ValueType::Number)
+					);
+					assembler.jumpIf(IfNotEqual, copyLabel);
+				}
+
+				compileRegisterAddress(instruction.b);
+				assembler.load(R15, Rax, 0);
+				assembler.load(Rcx, Rbx, offsetof(NativeFrame, ownedValues));
+				assembler.compare(R15, Rcx, ownedOffset);
+				assembler.jumpIf(IfNotEqual, copyLabel);
+				assembler.load(Rcx, R13, layout.number);
+				assembler.store(R15, layout.number, Rcx);
+				assembler.load(Rcx, R13, layout.integer);
+				assembler.store(R15, layout.integer, Rcx);
+				assembler.loadByte(Rcx, R13, layout.integral);
+				assembler.storeByte(R15, layout.integral, Rcx);
+				compileStore(instruction.a, R15);
+				assembler.jump(resultLabel);
+
+				// Numbers the interpreter copied belong to the noodle from then on
+				assembler.bind(copyLabel);
+				compileInstructionCall(instructionIndex);
+				compileRegisterAddress(instruction.b);
+				assembler.load(R15, Rax, 0);
+				assembler.compare32(
+					R15, layout.valueType, static_cast<int32_t>(ValueType::Number)
+				);
+				assembler.jumpIf(IfNotEqual, resultLabel);
+				assembler.load(Rcx, Rbx, offsetof(NativeFrame, ownedValues));
+				assembler.store(Rcx, ownedOffset, R15);
+				assembler.bind(resultLabel);
+			}
+			// Integer counts are compared, assigned to the noodle and stepped without leaving
+			// native code, as long as the noodle still holds the number assigned to it last.
+			// Other counts, and steps that would overflow, are left to the interpreter's helper.
+			void compileRangeStep(const Instruction& instruction, int instructionIndex) {
+				const int ownedOffset = instruction.b * sizeof(RuntimeValue*);
+				const int downLabel = assembler.createLabel();
+				const int inRangeLabel = assembler.createLabel();
+				const int helperLabel = assembler.createLabel();
+				const int nextLabel = assembler.createLabel();
+
+				compileLoad(R13, instruction.a);
+				compileLoad(R14, instruction.a + 1);
+				compileLoad(R15, instruction.a + 2);
+
+				for (Register bound : { R13, R14, R15 }) {
+					assembler.compareByte(bound, layout.integral, 0);
+					assembler.jumpIf(IfEqual, helperLabel);
+				}
+
+				compileRegisterAddress(instruction.b);
+				assembler.load(Rsi, Rax, 0);
+				assembler.load(Rcx, Rbx, offsetof(NativeFrame, ownedValues));
+				assembler.compare(Rsi, Rcx, ownedOffset);
+				assembler.jumpIf(IfNotEqual, helperLabel);
+
+				// Negative steps count down to the end
+				assembler.load(Rcx, R13, layout.integer);
+				assembler.load(Rdx, R15, layout.integer);
+				assembler.test(Rdx, Rdx);
+				assembler.jumpIf(IfLess, downLabel);
+				assembler.compare(Rcx, R14, layout.integer);
+				assembler.jumpIf(IfGreaterEqual, instructionLabels[instruction.c]);
+				assembler.jump(inRangeLabel);
+				assembler.bind(downLabel);
+				assembler.compare(Rcx, R14, layout.integer);
+				assembler.jumpIf(IfLessEqual, instructionLabels[instruction.c]);
+
+				assembler.bind(inRangeLabel);
+				assembler.store(Rsi, layout.integer, Rcx);
+				assembler.storeByte(Rsi, layout.integral, 1);
+				assembler.convertToDouble(Rcx);
+				assembler.scalarDouble(0x11, Rsi, layout.number);
+				assembler.add(Rcx, R15, layout.integer);
+				assembler.jumpIf(IfOverflow, helperLabel);
+				assembler.store(R13, layout.integer, Rcx);
+				assembler.convertToDouble(Rcx);
+				assembler.scalarDouble(0x11, R13, layout.number);
+				assembler.jump(nextLabel);
+
+				// The helper assigns the noodle again, which changes nothing when the step
+				// overflowed after it was assigned
+				assembler.bind(helperLabel);
+				assembler.move(Rdi, Rbx);
+				assembler.moveImmediate32(Rsi, instructionIndex);
+				assembler.call(address(&advanceRangeRegisters));
+				assembler.testByte();
+				assembler.jumpIf(IfEqual, instructionLabels[instruction.c]);
+				assembler.bind(nextLabel);
+			}
+			void compileNumberOperation(const Instruction& instruction, int instructionIndex) {
+				const OpCode opCode = instruction.opCode;
+				NumValue* scratchValue = scratchValues[instruction.a];
+				const int resultLabel = assembler.createLabel();
+
+				compileLoad(R13, instruction.b);
+				compileLoad(R14, instruction.c);
+				compileNumberGuard(R13, instruction.b, instructionIndex);
+				compileNumberGuard(R14, instruction.c, instructionIndex);
+
+				switch (opCode) {
+				case OpCode::Add:
+				case OpCode::Subtract:
+				case OpCode::Multiply:
+				{
+					const int doubleLabel = assembler.createLabel();
+
+					// Integers that overflow are operated on as doubles instead
+					compileIntegerCheck(doubleLabel);
+					assembler.load(Rdi, R13, layout.integer);
+
+					if (opCode == OpCode::Add)
+						assembler.add(Rdi, R14, layout.integer);
+					else if (opCode == OpCode::Subtract)
+						assembler.subtract(Rdi, R14, layout.integer);
+					else
+						assembler.multiply(Rdi, R14, layout.integer);
+
+					assembler.jumpIf(IfOverflow, doubleLabel);
+					compileIntegerResult(scratchValue);
+					assembler.jump(resultLabel);
+
+					assembler.bind(doubleLabel);
+					assembler.scalarDouble(0x10, R13, layout.number);
+					assembler.scalarDouble(
+						opCode == OpCode::Add ? 0x58 : opCode == OpCode::Subtract ? 0x5C : 0x59,
+						R14, layout.number
+					);
+					compileDoubleResult(scratchValue);
+					break;
+				}
+				case OpCode::Divide:
+				{
+					const int divideLabel = assembler.createLabel();
+
+					// Dividing by zero results in zero
+					assembler.moveImmediate(Rcx, reinterpret_cast<int64_t>(&zero));
+					assembler.scalarDouble(0x10, R14, layout.number);
+					assembler.compareDouble(Rcx, 0);
+					assembler.jumpIf(IfParity, divideLabel);
+					assembler.jumpIf(IfNotEqual, divideLabel);
+					assembler.scalarDouble(0x10, Rcx, 0);
+					compileDoubleResult(scratchValue);
+					assembler.jump(resultLabel);
+
+					assembler.bind(divideLabel);
+					assembler.scalarDouble(0x10, R13, layout.number);
+					assembler.scalarDouble(0x5E, R14, layout.number);
+					compileDoubleResult(scratchValue);
+					break;
+				}
+				case OpCode::Modulo:
+				{
+					const int doubleLabel = assembler.createLabel();
+					const int zeroLabel = assembler.createLabel();
+					const int integerLabel = assembler.createLabel();
+
+					compileIntegerCheck(doubleLabel);
+					assembler.load(Rax, R13, layout.integer);
+					assembler.load(Rcx, R14, layout.integer);
+					assembler.test(Rcx, Rcx);
+					assembler.jumpIf(IfEqual, zeroLabel);
+					assembler.compareImmediate(Rcx, -1);
+					assembler.jumpIf(IfEqual, zeroLabel);
+					assembler.divide(Rcx);
+					assembler.move(Rdi, Rdx);
+					assembler.jump(integerLabel);
+					assembler.bind(zeroLabel);
+					assembler.moveImmediate32(Rdi, 0);
+					assembler.bind(integerLabel);
+					compileIntegerResult(scratchValue);
+					assembler.jump(resultLabel);
+
+					assembler.bind(doubleLabel);
+					compileOperationCall(opCode);
+					break;
+				}
+				default:
+					compileOperationCall(opCode);
+					break;
+				}
+
+				assembler.bind(resultLabel);
+				compileStore(instruction.a, R15);
+			}
+			// Leaves a number holding the integer in Rdi in R15
+			void compileIntegerResult(NumValue* scratchValue) {
+				if (scratchValue == nullptr) {
+					assembler.call(address(&createInteger));
+					assembler.move(R15, Rax);
+					return;
+				}
+
+				assembler.moveImmediate(R15, reinterpret_cast<int64_t>(scratchValue));
+				assembler.store(R15, layout.integer, Rdi);
+				assembler.convertToDouble(Rdi);
+				assembler.scalarDouble(0x11, R15, layout.number);
+				assembler.storeByte(R15, layout.integral, 1);
+			}
+			// Leaves a number holding the double in xmm0 in R15
+			void compileDoubleResult(NumValue* scratchValue) {
+				if (scratchValue == nullptr) {
+					assembler.call(address(&createNumber));
+					assembler.move(R15, Rax);
+					return;
+				}
+
+				assembler.moveImmediate(R15, reinterpret_cast<int64_t>(scratchValue));
+				assembler.scalarDouble(0x11, R15, layout.number);
+				assembler.storeByte(R15, layout.integral, 0);
+			}
+			// Leaves the result of the operation on the numbers in R13 and R14 in R15
+			void compileOperationCall(OpCode opCode) {
+				assembler.move(Rdi, R13);
+				assembler.move(Rsi, R14);
+				assembler.moveImmediate32(Rdx, static_cast<int32_t>(toBinaryOperation(opCode)));
+				assembler.call(address(&evaluateNumberOperation));
+				assembler.move(R15, Rax);
+			}
+			void compileComparisonJump(const Instruction& instruction, int instructionIndex) {
+				const BinaryOperation operation = toBinaryOperation(instruction.opCode);
+				const int falseLabel = instructionLabels[instruction.c];
+				const int doubleLabel = assembler.createLabel();
+				// Conditions under which the comparison is false, for integers and for
+				// doubles compared with ucomisd, where unordered comparisons set every flag
+				Condition integerCondition;
+				Condition doubleCondition;
+				bool swapsOperands = false;
+
+				switch (operation) {
+				case BinaryOperation::Equal:
+					integerCondition = IfNotEqual;
+					doubleCondition = IfNotEqual;
+					break;
+				case BinaryOperation::NotEqual:
+					integerCondition = IfEqual;
+					doubleCondition = IfEqual;
+					break;
+				case BinaryOperation::Greater:
+					integerCondition = IfLessEqual;
+					doubleCondition = IfBelowEqual;
+					break;
+				case BinaryOperation::Less:
+					integerCondition = IfGreaterEqual;
+					doubleCondition = IfBelowEqual;
+					swapsOperands = true;
+					break;
+				case BinaryOperation::GreaterEqual:
+					integerCondition = IfLess;
+					doubleCondition = IfBelow;
+					break;
+				default:
+					integerCondition = IfGreater;
+					doubleCondition = IfBelow;
+					swapsOperands = true;
+					break;
+				}
+
+				compileLoad(R13, instruction.a);
+				compileLoad(R14, instruction.b);
+				compileNumberGuard(R13, instruction.a, instructionIndex);
+				compileNumberGuard(R14, instruction.b, instructionIndex);
+				compileIntegerCheck(doubleLabel);
+				assembler.load(Rcx, R13, layout.integer);
+				assembler.compare(Rcx, R14, layout.integer);
+				assembler.jumpIf(integerCondition, falseLabel);
+				assembler.jump(instructionLabels[instructionIndex + 1]);
+
+				assembler.bind(doubleLabel);
+				assembler.scalarDouble(0x10, swapsOperands ? R14 : R13, layout.number);
+				assembler.compareDouble(swapsOperands ? R13 : R14, layout.number);
+
+				if (operation == BinaryOperation::Equal)
+					assembler.jumpIf(IfParity, falseLabel);
+				else if (operation == BinaryOperation::NotEqual)
+					assembler.jumpIf(IfParity, instructionLabels[instructionIndex + 1]);
+
+				assembler.jumpIf(doubleCondition, falseLabel);
+			}
+		};
+	}
+
+	NativeCode* compileNativeCode(const Chunk* chunk) {
+		if (!isNumericChunk(chunk))
+			return nullptr;
+
+		NativeCode* nativeCode = new NativeCode();
+		NativeCompiler nativeCompiler(chunk);
+		const std::vector<uint8_t> code = nativeCompiler.compile(nativeCode->entries);
+		const size_t pageSize = sysconf(_SC_PAGESIZE);
+
+		nativeCode->size = (code.size() + pageSize - 1) / pageSize * pageSize;
+		nativeCode->memory = mmap(
+			nullptr, nativeCode->size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+		);
+		nativeCode->deoptimizationCount = 0;
+
+		if (nativeCode->memory == MAP_FAILED) {
+			delete nativeCode;
+			return nullptr;
+		}
+
+		// Pages are never writable and executable at once
+		std::memcpy(nativeCode->memory, code.data(), code.size());
+
+		if (mprotect(nativeCode->memory, nativeCode->size, PROT_READ | PROT_EXEC) != 0) {
+			munmap(nativeCode->memory, nativeCode->size);
+			delete nativeCode;
+			return nullptr;
+		}
+
+		return nativeCode;
+	}
+	void freeNativeCode(NativeCode* nativeCode) {
+		munmap(nativeCode->memory, nativeCode->size);
+		delete nativeCode;
+	}
+	int runNativeCode(const NativeCode* nativeCode, NativeFrame* frame, int instructionIndex) {
+		using Entry = int (*)(NativeFrame* frame, const void* instruction);
+
+		const uint8_t* code = static_cast<const uint8_t*>(nativeCode->memory);
+		const Entry entry = reinterpret_cast<Entry>(nativeCode->memory);
+
+		return entry(frame, code + nativeCode->entries[instructionIndex]);
+	}
+}
+#else
+namespace ns {
+	NativeCode* compileNativeCode(const Chunk* chunk) {
+		return nullptr;
+	}
+	void freeNativeCode(NativeCode* nativeCode) {
+	}
+	int runNativeCode(const NativeCode* nativeCode, NativeFrame* frame, int instructionIndex) {
+		return instructionIndex;
+	}
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,763 @@
+#include "../../../hdr/runtime/vm/VirtualMachine.hpp"
+#include "../../../hdr/util/Error.hpp"
+
+#include <algorithm>
+#include <deque>
+
+namespace ns {
+	namespace {
+		// Counts a call or loop iteration of the chunk, and returns whether it runs as native
+		// code
+		bool isChunkHot(const Chunk* chunk) {
+			if (chunk->tier == Chunk::Tier::Counting && ++chunk->hotness >= hotChunkThreshold) {
+				chunk->nativeCode = compileNativeCode(chunk);
+				chunk->tier = chunk->nativeCode != nullptr
+					? Chunk::Tier::Native : Chunk::Tier::Interpreted;
+			}
+
+			return chunk->tier == Chunk::Tier::Native;
+		}
+		// Returns the instruction to continue interpreting at, or nativeReturned
+		int enterNativeCode(const Chunk* chunk, NativeFrame& frame, int instructionIndex) {
+			const int resumeIndex = runNativeCode(chunk->nativeCode, &frame, instructionIndex);
+
+			if (resumeIndex == nativeThrew)
+				std::rethrow_exception(frame.exception);
+			// Guards that keep failing mean the chunk doesn't just work on numbers
+			else if (resumeIndex != nativeReturned
+				&& ++chunk->nativeCode->deoptimizationCount >= deoptimizationLimit)
+			{
+				freeNativeCode(chunk->nativeCode);
+				chunk->nativeCode = nullptr;
+				chunk->tier = Chunk::Tier::Interpreted;
+			}
+
+			return resumeIndex;
+		}
+
+		// Registers of a chunk running on the virtual machine's frame stack
+		struct CallFrame {
+			const Chunk* chunk;
+			Scope* scope;
+			// Recipe whose body the chunk is, or null for the chunk the machine was entered with
+			const FuncValue* recipe;
+			std::vector<RuntimeValue*> temporaries;
+			// Each register points to where its value is stored. Noodles point to their
+			// variable's value once they're looked up, and are null until then.
+			std::vector<RuntimeValue**> registers;
+			std::vector<Scope::Variable*> variables;
+			std::vector<RuntimeValue*> ownedValues;
+			NativeFrame nativeFrame;
+			// Once a guard fails, the rest of the call is interpreted, as it's likely to fail
+			// again
+			bool deoptimized;
+			// Instruction the recipe this frame calls returns to, and the register its result
+			// is stored in
+			const Instruction* returnInstruction;
+			int resultRegister;
+			// Pure recipe whose result is cached under the key once the frame returns. Tail calls
+			// keep it, as the result they end with is the result of the call that started them.
+			FuncValue* cachedRecipe;
+			std::string cacheKey;
+		};
+
+		// Points the frame's registers at a new call of the chunk, reusing their storage
+		void enterFrame(CallFrame& frame, const Chunk* chunk, Scope* scope, const FuncValue* recipe) {
+			frame.chunk = chunk;
+			frame.scope = scope;
+			frame.recipe = recipe;
+			frame.temporaries.assign(chunk->temporaryCount, nullptr);
+			frame.registers.assign(chunk->registerCount(), nullptr);
+			frame.variables.assign(chunk->names.size(), nullptr);
+			frame.ownedValues.assign(chunk->names.size(), nullptr);
+
+			for (size_t constantIndex = 0; constantIndex < chunk->constants.size();
+				constantIndex++)
+			{
+				frame.registers[chunk->firstConstant() + constantIndex] =
+					const_cast<RuntimeValue**>(&chunk->constants[constantIndex]);
+			}
+			for (int temporaryIndex = 0; temporaryIndex < chunk->temporaryCount; temporaryIndex++) {
+				frame.registers[chunk->firstTemporary() + temporaryIndex] =
+					&frame.temporaries[temporaryIndex];
+			}
+
+			frame.nativeFrame = {
+				chunk, scope, frame.registers.data(), frame.variables.data(),
+				frame.ownedValues.data(), nullptr, nullptr
+			};
+			frame.deoptimized = false;
+		}
+	}
+
+	RuntimeValue* executeChunk(const Chunk* chunk, Scope* scope) {
+		// Recipes called by the chunk get frames on this stack, rather than nesting on the
+		// native one. Frames are kept once they return, so later calls reuse their storage.
+		std::deque<CallFrame> frames(1);
+		size_t frameCount = 1;
+		CallFrame* frame = &frames[0];
+		const Instruction* instructions = nullptr;
+		const Instruction* instruction = nullptr;
+		RuntimeValue*** registers = nullptr;
+		Scope::Variable** variables = nullptr;
+		std::string cacheKey;
+
+		auto findVariable = [&](int slot) -> Scope::Variable* {
+			if (variables[slot] == nullptr) {
+				variables[slot] = scope->findVariable(chunk->names[slot]);
+				registers[slot] = &variables[slot]->runtimeValue;
+			}
+
+			return variables[slot];
+		};
+		auto forgetVariables = [&]() {
+			std::fill(variables, variables + chunk->names.size(), nullptr);
+			std::fill(registers, registers + chunk->names.size(), nullptr);
+		};
+
+		#define REGISTER(index) (*(registers[index] != nullptr \
+			? registers[index] : &findVariable(index)->runtimeValue))
+
+		// Compilers supporting labels as values jump straight from each instruction to the code
+		// handling the next, and others fall back to a switch
+#if defined(__GNUC__) || defined(__clang__)
+		static const void* const handlers[] = {
+			&&HandleMove, &&HandleClone, &&HandleLoadNull, &&HandleDeclareVariable,
+			&&HandleAssignVariable, &&HandleBindVariable, &&HandleDeclareRecipe, &&HandleEvaluate,
+			&&HandleNegate, &&HandleIncrement, &&HandleDecrement, &&HandleNot,
+			&&HandleAdd, &&HandleSubtract, &&HandleMultiply, &&HandleDivide, &&HandleModulo,
+			&&HandlePower, &&HandleEqual, &&HandleNotEqual, &&HandleGreater, &&HandleLess,
+			&&HandleGreaterEqual, &&HandleLessEqual, &&HandleAnd, &&HandleOr,
+			&&HandleMakeList, &&HandleGetField, &&HandleLoadCallee, &&HandleCall, &&HandleTailCall,
+			&&HandleCallNative, &&HandleJump, &&HandleJumpIfFalse,
+			&&HandleJumpUnlessEqual, &&HandleJumpUnlessNotEqual, &&HandleJumpUnlessGreater,
+			&&HandleJumpUnlessLess, &&HandleJumpUnlessGreaterEqual, &&HandleJumpUnlessLessEqual,
+			&&HandleIncrementVariable, &&HandleDecrementVariable,
+			&&HandleLoadElement, &&HandleStoreElement, &&HandlePrepareRange, &&HandleNextInRange,
+			&&HandlePrepareElements, &&HandleNextElement, &&HandleFailLoopCondition,
+			&&HandleReturn
+		};
+#endif
+
+		// Points the locals at the frame on top of the stack
+		auto loadFrame = [&]() {
+			chunk = frame->chunk;
+			scope = frame->scope;
+			instructions = chunk->instructions.data();
+			registers = frame->registers.data();
+			variables = frame->variables.data();
+
+#if defined(__GNUC__) || defined(__clang__)
+			if (!chunk->threaded) {
+				for (auto& threadedInstruction : chunk->instructions) {
+					threadedInstruction.handler =
+						handlers[static_cast<int>(threadedInstruction.opCode)];
+				}
+
+				chunk->threaded = true;
+			}
+#endif
+		};
+		// Returns the instruction the frame's chunk starts interpreting at, or nativeReturned
+		// if it ran to completion as native code
+		auto startFrame = [&]() -> int {
+			if (!isChunkHot(chunk))
+				return 0;
+
+			const int firstInstruction = enterNativeCode(chunk, frame->nativeFrame, 0);
+
+			frame->deoptimized = firstInstruction != nativeReturned;
+			return firstInstruction;
+		};
+
+		enterFrame(*frame, chunk, scope, nullptr);
+		loadFrame();
+
+		const int firstInstruction = startFrame();
+
+		if (firstInstruction == nativeReturned)
+			return frame->nativeFrame.result;
+
+		instruction = instructions + firstInstruction;
+
+#if defined(__GNUC__) || defined(__clang__)
+		#define HANDLE(opCode) Handle##opCode:
+		#define DISPATCH() goto *instruction->handler
+		#define NEXT() ++instruction; DISPATCH()
+		#define JUMP(target) instruction = instructions + (target); DISPATCH()
+		#define RESUME(target) instruction = (target); DISPATCH()
+#else
+		#define HANDLE(opCode) case OpCode::opCode:
+		#define NEXT() ++instruction; continue
+		#define JUMP(target) instruction = instructions + (target); continue
+		#define RESUME(target) instruction = (target); continue
+#endif
+
+		// Pops the frame on top, and stores the value it returns in the frame that called it,
+		// and in the cache of the pure recipe the frame was called for. The chunk the machine
+		// was entered with returns the value to its caller instead.
+		#define RETURN_FROM_FRAME(value) \
+		{ \
+			RuntimeValue* returnedValue = (value); \
+			\
+			if (frameCount == 1) \
+				return returnedValue; \
+			\
+			if (frame->cachedRecipe != nullptr) \
+				storeCachedResult(frame->cachedRecipe, frame->cacheKey, returnedValue); \
+			\
+			leaveRecipeCall(); \
+			frame = &frames[--frameCount - 1]; \
+			loadFrame(); \
+			REGISTER(frame->resultRegister) = returnedValue; \
+			RESUME(frame->returnInstruction); \
+		}
+
+#if defined(__GNUC__) || defined(__clang__)
+		DISPATCH();
+		{
+#else
+		for (;;) {
+			switch (instruction->opCode) {
+#endif
+			HANDLE(Move)
+				REGISTER(instruction->a) = REGISTER(instruction->b);
+				NEXT();
+			HANDLE(Clone)
+				// Values can be modified in place, so constants are copied before being stored
+				REGISTER(instruction->a) = cloneRuntimeValue(REGISTER(instruction->b));
+				NEXT();
+			HANDLE(LoadNull)
+				REGISTER(instruction->a) = globalMemory->create<NullValue>();
+				NEXT();
+			HANDLE(DeclareVariable)
+			{
+				const std::string& name = chunk->names[instruction->a];
+
+				scope->declareVariable(name, REGISTER(instruction->b), instruction->c);
+				variables[instruction->a] = scope->findVariable(name);
+				registers[instruction->a] = &variables[instruction->a]->runtimeValue;
+				NEXT();
+			}
+			HANDLE(AssignVariable)
+			{
+				RuntimeValue* value = cloneRuntimeValue(REGISTER(instruction->c));
+
+				Scope::assignVariable(
+					findVariable(instruction->b), chunk->names[instruction->b], value
+				);
+				REGISTER(instruction->a) = value;
+				NEXT();
+			}
+			HANDLE(BindVariable)
+			{
+				// Once bound, the parameter is only ever rebound where it was first found
+				if (variables[instruction->a] == nullptr) {
+					variables[instruction->a] = scope->bindVariable(
+						chunk->names[instruction->a], REGISTER(instruction->b)
+					);
+					registers[instruction->a] = &variables[instruction->a]->runtimeValue;
+				}
+				else
+					variables[instruction->a]->runtimeValue = REGISTER(instruction->b);
+
+				NEXT();
+			}
+			HANDLE(DeclareRecipe)
+			{
+				const CompiledRecipe& recipe = chunk->recipes[instruction->b];
+				FuncValue* funcValue = static_cast<FuncValue*>(
+					evaluateFuncDeclaration(recipe.funcDeclaration, scope)
+				);
+
+				funcValue->chunk = recipe.chunk;
+				variables[instruction->c] = scope->findVariable(funcValue->name);
+				registers[instruction->c] = &variables[instruction->c]->runtimeValue;
+				REGISTER(instruction->a) = funcValue;
+				NEXT();
+			}
+			HANDLE(Evaluate)
+			{
+				RuntimeValue* value = evaluateASTNode(chunk->nodes[instruction->b], scope);
+
+				if (instruction->c)
+					forgetVariables();
+
+				REGISTER(instruction->a) = value;
+				NEXT();
+			}
+			HANDLE(Negate)
+			HANDLE(Increment)
+			HANDLE(Decrement)
+			HANDLE(Not)
+				REGISTER(instruction->a) = evaluateUnaryValue(
+					REGISTER(instruction->b),
+					operationNames[static_cast<int>(instruction->opCode)
+						- static_cast<int>(OpCode::Negate)]
+				);
+				NEXT();
+			HANDLE(Add)
+			HANDLE(Subtract)
+			HANDLE(Multiply)
+			HANDLE(Divide)
+			HANDLE(Modulo)
+			HANDLE(Power)
+			HANDLE(Equal)
+			HANDLE(NotEqual)
+			HANDLE(Greater)
+			HANDLE(Less)
+			HANDLE(GreaterEqual)
+			HANDLE(LessEqual)
+			HANDLE(And)
+			HANDLE(Or)
+			{
+				RuntimeValue* leftValue = REGISTER(instruction->b);
+				RuntimeValue* rightValue = REGISTER(instruction->c);
+
+				if (leftValue->valueType == ValueType::Number
+					&& rightValue->valueType == ValueType::Number)
+				{
+					REGISTER(instruction->a) = evaluateNumberOperation(
+						static_cast<NumValue*>(leftValue),
+						static_cast<NumValue*>(rightValue),
+						toBinaryOperation(instruction->opCode)
+					);
+				}
+				else {
+					REGISTER(instruction->a) = evaluateBinaryValues(
+						leftValue,
+						rightValue,
+						operationNames[static_cast<int>(instruction->opCode)
+							- static_cast<int>(OpCode::Negate)]
+					);
+				}
+
+				NEXT();
+			}
+			HANDLE(MakeList)
+			{
+				ListValue* listValue = globalMemory->create<ListValue>();
+
+				for (int elementIndex = 0; elementIndex < instruction->c; elementIndex++)
+					listValue->append(REGISTER(instruction->b + elementIndex));
+
+				REGISTER(instruction->a) = listValue;
+				NEXT();
+			}
+			HANDLE(GetField)
+			{
+				int slot;
+				const DishValue* dishValue = resolveFieldSlot(
+					static_cast<FieldAccesser*>(chunk->nodes[instruction->c]),
+					REGISTER(instruction->b),
+					slot
+				);
+
+				REGISTER(instruction->a) = dishValue->slots[slot];
+				NEXT();
+			}
+			HANDLE(LoadCallee)
+			{
+				RuntimeValue* callee = REGISTER(instruction->b);
+				FuncCall* funcCall = static_cast<FuncCall*>(chunk->nodes[instruction->e]);
+
+				if (takesOtherArgumentCount(callee, funcCall->arguments.size())) {
+					REGISTER(instruction->a) = evaluateFuncCallExpr(funcCall, scope);
+					JUMP(instruction->d);
+				}
+
+				REGISTER(instruction->c) = callee;
+				NEXT();
+			}
+			HANDLE(Call)
+			HANDLE(TailCall)
+			{
+				// Temporaries are never noodles, so the arguments are stored next to each other
+				RuntimeValue** callee = registers[instruction->c];
+				FuncCall* funcCall = static_cast<FuncCall*>(chunk->nodes[instruction->b]);
+				FuncValue* funcValue = (*callee)->valueType == ValueType::FuncValue
+					? static_cast<FuncValue*>(*callee) : nullptr;
+
+				// Natives, dishes and recipes declared by the tree walker are called like
+				// before, as are calls that throw
+				if (funcValue == nullptr || funcValue->chunk == nullptr
+					|| funcCall->arguments.size() < funcValue->parameters.size())
+				{
+					REGISTER(instruction->a) = callRecipe(*callee, callee + 1, funcCall, scope);
+					NEXT();
+				}
+
+				const bool tailCall = instruction->opCode == OpCode::TailCall;
+				Scope* funcScope = scope;
+				bool cachesResult = false;
+
+				// Tail calls only look their result up, as the frame they replace stores it
+				if (funcValue->cache != nullptr && makeRecipeCacheKey(
+					callee + 1, funcValue->parameters.size(), cacheKey))
+				{
+					RuntimeValue* cachedResult = findCachedResult(funcValue, cacheKey);
+
+					if (cachedResult != nullptr && tailCall)
+						RETURN_FROM_FRAME(cachedResult);
+
+					if (cachedResult != nullptr) {
+						REGISTER(instruction->a) = cachedResult;
+						NEXT();
+					}
+
+					cachesResult = !tailCall;
+				}
+
+				// Recipes calling themselves in tail position only have their parameters
+				// assigned, as their scope holds nothing else
+				if (tailCall && funcValue == frame->recipe && funcValue->reusesScope) {
+					for (size_t parameterIndex = 0; parameterIndex < funcValue->parameters.size();
+						parameterIndex++)
+					{
+						scope->findVariable(funcValue->parameters[parameterIndex])->runtimeValue =
+							callee[1 + parameterIndex];
+					}
+
+					frame->deoptimized = false;
+				}
+				else {
+					funcScope = globalMemory->create<Scope>();
+					funcScope->assignParent(scope);
+
+					for (size_t parameterIndex = 0; parameterIndex < funcValue->parameters.size();
+						parameterIndex++)
+					{
+						funcScope->declareVariable(
+							funcValue->parameters[parameterIndex], callee[1 + parameterIndex]
+						);
+					}
+
+					// Tail calls replace the frame making them, as nothing is left for it to do
+					if (!tailCall) {
+						enterRecipeCall(funcCall->caller, false);
+						frame->returnInstruction = instruction + 1;
+						frame->resultRegister = instruction->a;
+
+						if (frameCount == frames.size())
+							frames.emplace_back();
+
+						frame = &frames[frameCount++];
+						frame->cachedRecipe = cachesResult ? funcValue : nullptr;
+
+						if (cachesResult)
+							frame->cacheKey = cacheKey;
+					}
+
+					enterFrame(*frame, funcValue->chunk, funcScope, funcValue);
+				}
+
+				loadFrame();
+
+				const int firstInstruction = startFrame();
+
+				if (firstInstruction == nativeReturned)
+					RETURN_FROM_FRAME(frame->nativeFrame.result);
+
+				JUMP(firstInstruction);
+			}
+			HANDLE(CallNative)
+			{
+				RuntimeValue* value = callNative(
+					REGISTER(instruction->c),
+					static_cast<FuncCall*>(chunk->nodes[instruction->b]),
+					scope
+				);
+
+				REGISTER(instruction->a) = value;
+				NEXT();
+			}
+			HANDLE(Jump)
+			{
+				// Loops jump backwards, and continue as native code once the chunk is hot
+				if (instruction->a <= instruction - instructions && !frame->deoptimized
+					&& isChunkHot(chunk))
+				{
+					const int resumeIndex = enterNativeCode(
+						chunk, frame->nativeFrame, instruction->a
+					);
+
+					if (resumeIndex == nativeReturned)
+						RETURN_FROM_FRAME(frame->nativeFrame.result);
+
+					frame->deoptimized = true;
+					JUMP(resumeIndex);
+				}
+
+				JUMP(instruction->a);
+			}
+			HANDLE(JumpIfFalse)
+			{
+				const RuntimeValue* condition = REGISTER(instruction->a);
+
+				if (condition->valueType != ValueType::Bool) {
+					JUMP(instruction->d);
+				}
+				else if (!static_cast<const BoolValue*>(condition)->state) {
+					JUMP(instruction->c);
+				}
+
+				NEXT();
+			}
+			HANDLE(JumpUnlessEqual)
+			HANDLE(JumpUnlessNotEqual)
+			HANDLE(JumpUnlessGreater)
+			HANDLE(JumpUnlessLess)
+			HANDLE(JumpUnlessGreaterEqual)
+			HANDLE(JumpUnlessLessEqual)
+			{
+				RuntimeValue* leftValue = REGISTER(instruction->a);
+				RuntimeValue* rightValue = REGISTER(instruction->b);
+				const BinaryOperation operation = toBinaryOperation(instruction->opCode);
+				bool state;
+
+				if (leftValue->valueType == ValueType::Number
+					&& rightValue->valueType == ValueType::Number)
+				{
+					state = compareNumbers(
+						static_cast<NumValue*>(leftValue),
+						static_cast<NumValue*>(rightValue),
+						operation
+					);
+				}
+				else {
+					const RuntimeValue* condition = evaluateBinaryValues(
+						leftValue,
+						rightValue,
+						operationNames[static_cast<int>(OpCode::Add) + static_cast<int>(operation)
+							- static_cast<int>(OpCode::Negate)]
+					);
+
+					if (condition->valueType != ValueType::Bool) {
+						JUMP(instruction->d);
+					}
+
+					state = static_cast<const BoolValue*>(condition)->state;
+				}
+
+				if (!state) {
+					JUMP(instruction->c);
+				}
+
+				NEXT();
+			}
+			HANDLE(IncrementVariable)
+			HANDLE(DecrementVariable)
+			{
+				RuntimeValue* value = REGISTER(instruction->b);
+				const bool increments = instruction->opCode == OpCode::IncrementVariable;
+
+				// Integers are updated in place, and anything else is left to the tree walker
+				if (value->valueType == ValueType::Number
+					&& static_cast<NumValue*>(value)->integral
+					&& static_cast<NumValue*>(value)->integer
+						!= (increments ? INT64_MAX : INT64_MIN))
+				{
+					NumValue* numValue = static_cast<NumValue*>(value);
+					numValue->setInteger(numValue->integer + (increments ? 1 : -1));
+				}
+				else
+					value = evaluateUnaryValue(value, increments ? "++" : "--");
+
+				REGISTER(instruction->a) = value;
+				NEXT();
+			}
+			HANDLE(LoadElement)
+			{
+				RuntimeValue* listValue = REGISTER(instruction->b);
+				RuntimeValue* indexValue = REGISTER(instruction->c);
+				RuntimeValue* callee = REGISTER(instruction->e);
+
+				if (listValue->valueType == ValueType::List
+					&& indexValue->valueType == ValueType::Number
+					&& isNativeFunc(callee, chunk->names[instruction->e]))
+				{
+					REGISTER(instruction->a) = static_cast<ListValue*>(listValue)->at(
+						static_cast<NumValue*>(indexValue)->toInteger()
+					);
+				}
+				else {
+					REGISTER(instruction->a) = callNative(
+						callee, static_cast<FuncCall*>(chunk->nodes[instruction->d]), scope
+					);
+				}
+
+				NEXT();
+			}
+			HANDLE(StoreElement)
+			{
+				RuntimeValue* listValue = REGISTER(instruction->a);
+				RuntimeValue* indexValue = REGISTER(instruction->b);
+				RuntimeValue* callee = REGISTER(instruction->e);
+
+				if (listValue->valueType == ValueType::List
+					&& indexValue->valueType == ValueType::Number
+					&& isNativeFunc(callee, chunk->names[instruction->e])
+					&& !variables[instruction->a]->constant)
+				{
+					static_cast<ListValue*>(listValue)->set(
+						static_cast<NumValue*>(indexValue)->toInteger(), REGISTER(instruction->c)
+					);
+				}
+				else {
+					callNative(
+						callee, static_cast<FuncCall*>(chunk->nodes[instruction->d]), scope
+					);
+				}
+
+				NEXT();
+			}
+			HANDLE(PrepareRange)
+			{
+				const int noodle = instruction->b;
+
+				prepareRange(
+					REGISTER(instruction->a), REGISTER(instruction->a + 1), 
+					REGISTER(instruction->a + 2)
+				);
+				variables[noodle] = scope->declareLoopVariable(
+					chunk->names[noodle], cloneRuntimeValue(REGISTER(instruction->a))
+				);
+				registers[noodle] = &variables[noodle]->runtimeValue;
+				frame->ownedValues[noodle] = variables[noodle]->runtimeValue;
+				NEXT();
+			}
+			HANDLE(NextInRange)
+			{
+				if (!advanceRange(
+					REGISTER(instruction->b), frame->ownedValues[instruction->b],
+					static_cast<NumValue*>(REGISTER(instruction->a)),
+					static_cast<const NumValue*>(REGISTER(instruction->a + 1)),
+					static_cast<const NumValue*>(REGISTER(instruction->a + 2))))
+				{
+					JUMP(instruction->c);
+				}
+
+				NEXT();
+			}
+			HANDLE(PrepareElements)
+			{
+				const int noodle = instruction->b;
+				NumValue* index = globalMemory->create<NumValue>();
+
+				expectIterable(REGISTER(instruction->a));
+				index->setInteger(0);
+				REGISTER(instruction->a + 1) = index;
+				variables[noodle] = scope->declareLoopVariable(
+					chunk->names[noodle], globalMemory->create<NullValue>()
+				);
+				registers[noodle] = &variables[noodle]->runtimeValue;
+				frame->ownedValues[noodle] = nullptr;
+				NEXT();
+			}
+			HANDLE(NextElement)
+			{
+				NumValue* index = static_cast<NumValue*>(REGISTER(instruction->a + 1));
+				int64_t nextIndex = index->integer;
+
+				if (!advanceElement(
+					REGISTER(instruction->b), frame->ownedValues[instruction->b],
+					static_cast<const ListValue*>(REGISTER(instruction->a)), nextIndex))
+				{
+					JUMP(instruction->c);
+				}
+
+				index->setInteger(nextIndex);
+				NEXT();
+			}
+			HANDLE(FailLoopCondition)
+			{
+				throwLoopConditionError();
+				NEXT();
+			}
+			HANDLE(Return)
+				RETURN_FROM_FRAME(REGISTER(instruction->a));
+#if !(defined(__GNUC__) || defined(__clang__))
+			default:
+				return nullptr;
+			}
+#endif
+		}
+
+		#undef REGISTER
+		#undef RETURN_FROM_FRAME
+		#undef RESUME
+		#undef HANDLE
+		#undef DISPATCH
+		#undef NEXT
+		#undef JUMP
+	}
+	RuntimeValue* callRecipe(
+		RuntimeValue* callee, RuntimeValue* const* arguments, FuncCall* funcCall, Scope* scope)
+	{
+		FuncValue* funcValue = dynamic_cast<FuncValue*>(callee);
+		const size_t argumentCount = funcCall->arguments.size();
+
+		if (funcValue == nullptr) {
+			throw Error(
+				Error::Location::Interpreter,
+				15,
+				"Cannot call noodle " + funcCall->caller + " as it isn't a recipe"
+			);
+		}
+		else if (funcValue->nativeFunc)
+			return evaluateNativeFuncCallExpr(funcValue, funcCall, scope);
+		else if (funcValue->dishShape != nullptr)
+			return createDishValue(funcValue->dishShape, arguments, argumentCount);
+		else if (argumentCount < funcValue->parameters.size()) {
+			throw Error(
+				Error::Location::Interpreter,
+				14,
+				"Cannot call recipe " + funcCall->caller + " with "
+					+ std::to_string(argumentCount)
+						+ (argumentCount == 1 ? " argument" : " arguments")
+			);
+		}
+
+		std::string cacheKey;
+		const bool cachesResult = funcValue->cache != nullptr
+			&& makeRecipeCacheKey(arguments, funcValue->parameters.size(), cacheKey);
+
+		if (cachesResult) {
+			RuntimeValue* cachedResult = findCachedResult(funcValue, cacheKey);
+
+			if (cachedResult != nullptr)
+				return cachedResult;
+		}
+
+		Scope* funcScope = globalMemory->create<Scope>();
+
+		funcScope->assignParent(scope);
+
+		for (size_t parameterIndex = 0; parameterIndex < funcValue->parameters.size();
+			parameterIndex++)
+		{
+			funcScope->declareVariable(
+				funcValue->parameters[parameterIndex], arguments[parameterIndex]
+			);
+		}
+
+		enterRecipeCall(funcCall->caller, true);
+
+		RuntimeValue* result = funcValue->chunk != nullptr
+			? executeChunk(funcValue->chunk, funcScope) : evaluateRecipeBody(funcValue, funcScope);
+
+		if (cachesResult)
+			storeCachedResult(funcValue, cacheKey, result);
+
+		leaveRecipeCall();
+		return result;
+	}
+	RuntimeValue* callNative(RuntimeValue* callee, FuncCall* funcCall, Scope* scope) {
+		FuncValue* funcValue = dynamic_cast<FuncValue*>(callee);
+
+		// Recipes can shadow natives, in which case the tree walker calls them instead
+		return funcValue != nullptr && funcValue->nativeFunc
+			? evaluateNativeFuncCallExpr(funcValue, funcCall, scope)
+			: evaluateFuncCallExpr(funcCall, scope);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+# Generates random programs made of numeric recipes hot enough to be compiled to native code,
+# runs each with useJit true and false, and reports those whose output differs.
+#
+# usage: python3 tests/jitDifferential.py <NoodleScript executable> [first seed] [last seed]
+
+import difflib
+import os
+import random
+import subprocess
+import sys
+import tempfile
+
+NOODLES = ['a', 'b', 'x', 'y', 'z', 'i']
+ASSIGNED = ['x', 'y', 'z']
+LITERALS = [
+    '0', '1', '2', '3', '7', '10', '0.5', '1.5', '2.25',
+    '1000000007', '4611686018427387904', '9223372036854775000'
+]
+ARGUMENTS = ['3', '0.5', 'k * 2', 'k - 1', '(0 - 2.5)', '9223372036854775000']
+
+def generateExpr(generator, depth=0):
+    if depth >= 3 or generator.random() < 0.3:
+        return generator.choice(NOODLES + LITERALS)
+
+    operation = generator.choice(['+', '-', '*', '/', '%', '**', 'negate'])
+
+    if operation == 'negate':
+        return '(-%s)' % generator.choice(NOODLES)
+    # Square roots of negative numbers and large powers give NaN and infinity
+    if operation == '**':
+        return '(%s ** %s)' % (generator.choice(NOODLES), generator.choice(['2', '3', '0.5', '400']))
+
+    return '(%s %s %s)' % (generateExpr(generator, depth + 1), operation, generateExpr(generator, depth + 1))
+
+def generateCondition(generator):
+    condition = '%s %s %s' % (
+        generateExpr(generator, 2),
+        generator.choice(['<', '>', '<=', '>=', '==', '!=']),
+        generateExpr(generator, 2)
+    )
+
+    if generator.random() < 0.2:
+        condition += ' %s %s < %s' % (
+            generator.choice(['&&', '||']), generator.choice(NOODLES), generator.choice(LITERALS)
+        )
+
+    return condition
+
+def generateStatements(generator, indent, depth):
+    padding = '    ' * indent
+    lines = []
+
+    for _ in range(generator.randint(1, 4)):
+        choice = generator.random()
+
+        if choice < 0.5 or depth >= 2:
+            lines.append('%s%s = %s' % (padding, generator.choice(ASSIGNED), generateExpr(generator)))
+        elif choice < 0.65:
+            lines.append('%s%s%s' % (padding, generator.choice(ASSIGNED), generator.choice(['++', '--'])))
+        elif choice < 0.85 or depth >= 1:
+            lines.append('%sif %s' % (padding, generateCondition(generator)))
+            lines += generateStatements(generator, indent + 1, depth + 1)
+
+            if generator.random() < 0.5:
+                lines.append('%selse' % padding)
+                lines += generateStatements(generator, indent + 1, depth + 1)
+
+            lines.append('%seat' % padding)
+        else:
+            lines.append('%sj = 0' % padding)
+            lines.append('%swhile j < %d' % (padding, generator.randint(1, 4)))
+            lines += generateStatements(generator, indent + 1, depth + 1)
+            lines.append('%s    j++' % padding)
+            lines.append('%seat' % padding)
+
+    return lines
+
+def generateProgram(seed):
+    generator = random.Random(seed)
+    recipeCount = generator.randint(1, 3)
+    lines = []
+
+    for recipe in range(recipeCount):
+        lines.append('recipe f%d(noodle a noodle b)' % recipe)
+        lines.append('    noodle i = 0')
+        lines.append('    noodle j = 0')
+
+        for noodle in ASSIGNED:
+            lines.append('    noodle %s = %s' % (noodle, generator.choice(LITERALS[:9] + ['a', 'b'])))
+
+        lines.append('    while i < %d' % generator.randint(1, 40))
+        lines += generateStatements(generator, 2, 0)
+        lines.append('        i++')
+        lines.append('    eat')
+        lines.append('    %s' % generator.choice(['x', 'y', 'z', '(x + y)', '(z - x)']))
+        lines.append('eat')
+
+    # Enough calls to compile every recipe, and a few with arguments that aren't numbers
+    lines.append('noodle k = 0')
+    lines.append('noodle r = 0')
+    lines.append('while k < %d' % generator.choice([1100, 1500, 2200]))
+
+    for recipe in range(recipeCount):
+        lines.append('    r = f%d(k + 0 %s)' % (recipe, generator.choice(ARGUMENTS)))
+        lines.append('    if k %% %d == 0' % generator.choice([97, 250, 499]))
+        lines.append('        serve(k " " r "\\n")')
+        lines.append('    eat')
+
+    lines.append('    k++')
+    lines.append('eat')
+
+    for recipe in range(recipeCount):
+        lines.append('serve(f%d(%s %s) "\\n")' % (
+            recipe, generator.choice(['1', '"s"', '2.5', 'true']), generator.choice(['1', '"t"', '7'])
+        ))
+        lines.append('serve(f%d(5 6) "\\n")' % recipe)
+
+    return '\n'.join(lines) + '\n'
+
+def runProgram(executable, path, useJit):
+    commands = 'set useJit %s\nrun %s\nexit\n' % ('true' if useJit else 'false', path)
+
+    try:
+        process = subprocess.run(
+            [executable], input=commands, capture_output=True, text=True, timeout=60
+        )
+    except subprocess.TimeoutExpired:
+        return 'timed out\n'
+
+    # Only what the program printed is compared, not the terminal confirming the setting
+    output = process.stdout + process.stderr
+    return output[output.find('NoodleScript Console'):]
+
+def main():
+    if len(sys.argv) < 2:
+        print('usage: python3 tests/jitDifferential.py <NoodleScript executable> [first seed] [last seed]')
+        return 2
+
+    executable = os.path.abspath(sys.argv[1])
+    firstSeed = int(sys.argv[2]) if len(sys.argv) > 2 else 1
+    lastSeed = int(sys.argv[3]) if len(sys.argv) > 3 else firstSeed + 99
+    mismatches = 0
+
+    for seed in range(firstSeed, lastSeed + 1):
+        program = generateProgram(seed)
+
+        with tempfile.NamedTemporaryFile('w', suffix='.ns', delete=False) as file:
+            file.write(program)
+
+        native = runProgram(executable, file.name, True)
+        interpreted = runProgram(executable, file.name, False)
+
+        if native == interpreted:
+            os.remove(file.name)
+            continue
+
+        # The program is kept, so it can be run again by hand
+        mismatches += 1
+        print('Seed %d differs, program kept in %s' % (seed, file.name))
+        sys.stdout.writelines(list(difflib.unified_diff(
+            interpreted.splitlines(True), native.splitlines(True), 'useJit false', 'useJit true'
+        ))[:20])
+
+    print('%d of %d programs differ' % (mismatches, lastSeed - firstSeed + 1))
+    return 1 if mismatches else 0
+
+if __name__ == '__main__':
+    sys.exit(main())